@@ -0,0 +1,40 @@
+//
+// Benchmark.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+
+int main(int argc, char** argv) {
+    std::string filter = std::string();
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--large") == 0) {
+            BenchmarkLarge() = true;
+        }
+        else {
+            filter = argv[i];
+        }
+    }
+
+    // Registration order between files is not defined, so run the groups in name order
+    std::vector<BenchmarkCase> cases = BenchmarkCases();
+    std::stable_sort(cases.begin(), cases.end(), [](const BenchmarkCase& a, const BenchmarkCase& b) {
+        return a.group < b.group;
+    });
+
+    for (const BenchmarkCase& benchmark : cases) {
+        std::string name = benchmark.group + "." + benchmark.name;
+        if (name.find(filter) == std::string::npos) continue;
+
+        std::printf("%s\n", name.c_str());
+        benchmark.function();
+    }
+
+    return 0;
+}
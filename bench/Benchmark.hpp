@@ -0,0 +1,78 @@
+//
+// Benchmark.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this file is to time the containers on the paths that
+ * were tuned for speed, so a change can be checked against the numbers
+ * before it. Each benchmark file registers its cases with BENCHMARK, the
+ * same way the tests use TEST, and every timing inside a case prints the
+ * time per operation. The cases are built with optimizations by the
+ * mrlib-bench target and are not part of the tests, since their timings
+ * depend on the machine.
+ *
+ * mrlib-bench [filter] [--large] runs the cases whose Group.name contains
+ * the filter. Sizes that need gigabytes of memory only run with --large.
+ */
+
+
+#ifndef MRLIB_BENCHMARK_HPP
+#define MRLIB_BENCHMARK_HPP
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Stopwatch.hpp"
+
+// Registers a case, BENCHMARK(Group, name) { ... }
+#define BENCHMARK(group, name) \
+    static void group##_##name##_Benchmark(); \
+    static BenchmarkRegistration group##_##name##_Registration(#group, #name, group##_##name##_Benchmark); \
+    static void group##_##name##_Benchmark()
+
+
+struct BenchmarkCase {
+    std::string  group;
+    std::string  name;
+    void         (*function)();
+};
+
+inline
+std::vector<BenchmarkCase>& BenchmarkCases() {
+    static std::vector<BenchmarkCase> cases;
+    return cases;
+}
+
+struct BenchmarkRegistration {
+    BenchmarkRegistration(const char* group, const char* name, void (*function)()) {
+        BenchmarkCases().push_back(BenchmarkCase{group, name, function});
+    }
+};
+
+// Set by --large
+inline
+bool& BenchmarkLarge() {
+    static bool large = false;
+    return large;
+}
+
+// Keeps results alive so the optimizer can not drop the work being timed
+static volatile size_t Sink = 0;
+
+template <typename F>
+void Benchmark(const std::string& name, size_t operations, F function) {
+    mrlib::Stopwatch stopwatch = mrlib::Stopwatch();
+    stopwatch.start();
+    function();
+    stopwatch.stop();
+
+    double nanoseconds = double(stopwatch.elapsedNanoseconds()) / double(operations);
+    std::printf("  %-48s %12.1f ns/op\n", name.c_str(), nanoseconds);
+    std::fflush(stdout);
+}
+
+#endif // MRLIB_BENCHMARK_HPP
@@ -0,0 +1,70 @@
+//
+// ArrayStream_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "Array.hpp"
+#include "Benchmark.hpp"
+
+using namespace mrlib;
+
+
+static Array<long> RangeArray(long size) {
+    Array<long> array = Array<long>();
+    for (long i = 0; i < size; ++i) {
+        array.add(i);
+    }
+
+    return array;
+}
+
+
+BENCHMARK(ArrayStream, map_filter_reduce) {
+    Array<long> array = RangeArray(4000000);
+
+    Benchmark("hand written loop", array.size(), [&array]() {
+        long sum = 0;
+        for (size_t i = 0; i < array.size(); ++i) {
+            long value = array[i] * 3;
+            if (value % 2 == 0) sum += value;
+        }
+        Sink += size_t(sum);
+    });
+
+    Benchmark("stream", array.size(), [&array]() {
+        Sink += size_t(array.stream()
+            .map([](long value) { return value * 3; })
+            .filter([](long value) { return value % 2 == 0; })
+            .reduce(0L, [](long sum, long value) { return sum + value; }));
+    });
+
+    Benchmark("parallel stream", array.size(), [&array]() {
+        Sink += size_t(array.parallelStream()
+            .map([](long value) { return value * 3; })
+            .filter([](long value) { return value % 2 == 0; })
+            .reduce(0L, [](long sum, long value) { return sum + value; }));
+    });
+}
+
+BENCHMARK(ArrayStream, any_of) {
+    Array<long> array = RangeArray(4000000);
+
+    // The match is the last element, so every element is checked
+    Benchmark("hand written loop", array.size(), [&array]() {
+        bool found = false;
+        for (size_t i = 0; i < array.size() && !found; ++i) {
+            found = array[i] == 3999999;
+        }
+        Sink += size_t(found);
+    });
+
+    Benchmark("stream", array.size(), [&array]() {
+        Sink += size_t(array.stream().anyOf([](long value) { return value == 3999999; }));
+    });
+
+    Benchmark("parallel stream", array.size(), [&array]() {
+        Sink += size_t(array.parallelStream().anyOf([](long value) { return value == 3999999; }));
+    });
+}
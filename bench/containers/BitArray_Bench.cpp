@@ -0,0 +1,133 @@
+//
+// BitArray_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "Array.hpp"
+#include "BitArray.hpp"
+#include "Benchmark.hpp"
+
+using namespace mrlib;
+
+
+#define BIT_ARRAY_BENCH_BITS (1 << 22)
+
+// Whole array operations are reported per 64 bits, one BitArray word, since per bit rounds to zero
+
+// Every third bit set
+static BitArray ThirdBits() {
+    BitArray array = BitArray(BIT_ARRAY_BENCH_BITS);
+    for (size_t i = 0; i < array.size(); i += 3) {
+        array.set(i);
+    }
+
+    return array;
+}
+
+static Array<bool> ThirdBools() {
+    Array<bool> array = Array<bool>();
+    for (size_t i = 0; i < BIT_ARRAY_BENCH_BITS; ++i) {
+        array.add(i % 3 == 0);
+    }
+
+    return array;
+}
+
+
+BENCHMARK(BitArray, count) {
+    BitArray bits = ThirdBits();
+    Array<bool> bools = ThirdBools();
+
+    Benchmark("Array<bool>, per 64 bits", bools.size() / 64, [&bools]() {
+        size_t count = 0;
+        for (size_t i = 0; i < bools.size(); ++i) {
+            count += bools._data[i];
+        }
+        Sink += count;
+    });
+
+    Benchmark("BitArray, per 64 bits", bits.size() / 64, [&bits]() {
+        Sink += bits.count();
+    });
+}
+
+BENCHMARK(BitArray, and_or_xor) {
+    BitArray first = ThirdBits();
+    BitArray second = ~ThirdBits();
+    Array<bool> bools1 = ThirdBools();
+    Array<bool> bools2 = ThirdBools();
+
+    Benchmark("Array<bool> AND, per 64 bits", bools1.size() / 64, [&bools1, &bools2]() {
+        for (size_t i = 0; i < bools1.size(); ++i) {
+            bools1._data[i] = bools1._data[i] && bools2._data[i];
+        }
+        Sink += bools1._data[0];
+    });
+
+    Benchmark("BitArray &=, |=, ^=, per 64 bits", first.size() * 3 / 64, [&first, &second]() {
+        first &= second;
+        first |= second;
+        first ^= second;
+        Sink += first._words[0];
+    });
+}
+
+BENCHMARK(BitArray, iterate_set_bits) {
+    BitArray bits = ThirdBits();
+    Array<bool> bools = ThirdBools();
+
+    Benchmark("Array<bool> index loop, per bit", bools.size(), [&bools]() {
+        size_t sum = 0;
+        for (size_t i = 0; i < bools.size(); ++i) {
+            if (bools._data[i]) sum += i;
+        }
+        Sink += sum;
+    });
+
+    Benchmark("BitArray findNext loop, per bit", bits.size(), [&bits]() {
+        size_t sum = 0;
+        for (size_t i = bits.findFirst(); i < bits.size(); i = bits.findNext(i)) {
+            sum += i;
+        }
+        Sink += sum;
+    });
+
+    Benchmark("BitArray forEachSetBit, per bit", bits.size(), [&bits]() {
+        size_t sum = 0;
+        bits.forEachSetBit([&sum](size_t index) { sum += index; });
+        Sink += sum;
+    });
+}
+
+BENCHMARK(BitArray, rank_select) {
+    BitArray array = ThirdBits();
+    size_t count = array.count();
+
+    for (int indexed = 0; indexed < 2; ++indexed) {
+        std::string suffix = indexed ? ", index" : ", no index";
+        if (indexed) array.buildRankIndex();
+
+        Benchmark("rank" + suffix, 20000, [&array]() {
+            for (size_t i = 0; i < 20000; ++i) {
+                Sink += array.rank((i * 2654435761u) % array.size());
+            }
+        });
+
+        Benchmark("select" + suffix, 20000, [&array, count]() {
+            for (size_t i = 0; i < 20000; ++i) {
+                Sink += array.select((i * 2654435761u) % count);
+            }
+        });
+    }
+
+    // Every rank follows a write, which used to drop the index
+    Benchmark("set then rank, index", 20000, [&array]() {
+        for (size_t i = 0; i < 20000; ++i) {
+            size_t index = (i * 2654435761u) % array.size();
+            array.flip(index);
+            Sink += array.rank(index);
+        }
+    });
+}
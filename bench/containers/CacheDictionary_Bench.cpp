@@ -0,0 +1,65 @@
+//
+// CacheDictionary_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "CacheDictionary.hpp"
+#include "Random.hpp"
+#include "Benchmark.hpp"
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+using namespace mrlib;
+
+
+#define CACHE_BENCH_KEYS 1000000
+#define CACHE_BENCH_LOOKUPS 4000000
+
+// Keys drawn with a Zipfian distribution, the key of rank r is drawn in proportion to 1 / r^exponent
+static std::vector<int> ZipfianTrace(double exponent) {
+    std::vector<double> cumulative = std::vector<double>(CACHE_BENCH_KEYS);
+    double total = 0.0;
+    for (size_t r = 0; r < CACHE_BENCH_KEYS; ++r) {
+        total += 1.0 / std::pow(double(r + 1), exponent);
+        cumulative[r] = total;
+    }
+
+    // Random's ranges end one before max, so this draws from [0, total)
+    Random random = Random();
+    std::vector<int> trace = std::vector<int>(CACHE_BENCH_LOOKUPS);
+    for (int& key : trace) {
+        double point = random.nextDouble(0.0, total + 1.0);
+        key = int(std::upper_bound(cumulative.begin(), cumulative.end(), point) - cumulative.begin());
+        key = std::min(key, CACHE_BENCH_KEYS - 1);
+    }
+
+    return trace;
+}
+
+static void ZipfianLookups(const char* name, CachePolicy policy, size_t capacity, const std::vector<int>& trace) {
+    CacheDictionary<int, int> cache(capacity, policy);
+    Benchmark(name, trace.size(), [&cache, &trace]() {
+        size_t sum = 0;
+        for (int key : trace) {
+            sum += cache.getOrInsert(key, [key]() { return key; });
+        }
+        Sink += sum;
+    });
+
+    std::printf("  %-48s %12.1f %%\n", (std::string(name) + " hit rate").c_str(), cache.statistics().hitRate() * 100.0);
+}
+
+
+BENCHMARK(CacheDictionary, zipfian) {
+    std::vector<int> trace = ZipfianTrace(0.9);
+
+    // The cache holds one key in a hundred
+    size_t capacity = CACHE_BENCH_KEYS / 100;
+    ZipfianLookups("LRU", CachePolicy::LRU, capacity, trace);
+    ZipfianLookups("SEGMENTED_LRU", CachePolicy::SEGMENTED_LRU, capacity, trace);
+    ZipfianLookups("TINY_LFU", CachePolicy::TINY_LFU, capacity, trace);
+}
@@ -0,0 +1,83 @@
+//
+// ConcurrentArray_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "ConcurrentArray.hpp"
+#include "Benchmark.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace mrlib;
+
+
+#define CONCURRENT_ARRAY_BENCH_ADDS 4000000
+
+// Runs function(thread, count) on each thread, splitting the adds between them
+template <typename F>
+static void RunThreads(size_t thread_count, F function) {
+    std::vector<std::thread> threads;
+    size_t count = CONCURRENT_ARRAY_BENCH_ADDS / thread_count;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&function, t, count]() { function(t, count); });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+
+BENCHMARK(ConcurrentArray, add_scaling) {
+    for (size_t thread_count = 1; thread_count <= 64; thread_count *= 2) {
+        std::string threads = std::to_string(thread_count) + " threads";
+
+        Benchmark("Array behind a mutex, " + threads, CONCURRENT_ARRAY_BENCH_ADDS, [thread_count]() {
+            Array<size_t> array = Array<size_t>();
+            std::mutex mutex;
+            RunThreads(thread_count, [&array, &mutex](size_t thread, size_t count) {
+                for (size_t i = 0; i < count; ++i) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    array.add(thread + i);
+                }
+            });
+            Sink += array.size();
+        });
+
+        Benchmark("ConcurrentArray, " + threads, CONCURRENT_ARRAY_BENCH_ADDS, [thread_count]() {
+            ConcurrentArray<size_t> array;
+            RunThreads(thread_count, [&array](size_t thread, size_t count) {
+                for (size_t i = 0; i < count; ++i) {
+                    array.add(thread + i);
+                }
+            });
+            Sink += array.size();
+        });
+    }
+}
+
+BENCHMARK(ConcurrentArray, read_while_adding) {
+    // Half the threads add while the other half sum everything published so far
+    for (size_t thread_count = 2; thread_count <= 64; thread_count *= 2) {
+        Benchmark("ConcurrentArray, " + std::to_string(thread_count) + " threads", CONCURRENT_ARRAY_BENCH_ADDS, [thread_count]() {
+            ConcurrentArray<size_t> array;
+            RunThreads(thread_count, [&array](size_t thread, size_t count) {
+                if (thread % 2 == 0) {
+                    for (size_t i = 0; i < count * 2; ++i) {
+                        array.add(i);
+                    }
+                }
+                else {
+                    size_t sum = 0;
+                    array.forEach([&sum](size_t value) { sum += value; });
+                    Sink += sum;
+                }
+            });
+            Sink += array.size();
+        });
+    }
+}
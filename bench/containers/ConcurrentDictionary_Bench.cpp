@@ -0,0 +1,90 @@
+//
+// ConcurrentDictionary_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "ConcurrentDictionary.hpp"
+#include "HashDictionary.hpp"
+#include "Benchmark.hpp"
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace mrlib;
+
+
+#define CONCURRENT_DICTIONARY_BENCH_OPERATIONS 4000000
+#define CONCURRENT_DICTIONARY_BENCH_KEYS 100000
+
+// Runs function(thread, count) on each thread, splitting the operations between them
+template <typename F>
+static void RunThreads(size_t thread_count, F function) {
+    std::vector<std::thread> threads;
+    size_t count = CONCURRENT_DICTIONARY_BENCH_OPERATIONS / thread_count;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&function, t, count]() { function(t, count); });
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+// Of every ten operations on a thread, the first writes of them are writes and the rest are reads
+static void Throughput(size_t writes) {
+    for (size_t thread_count = 1; thread_count <= 64; thread_count *= 2) {
+        std::string threads = std::to_string(thread_count) + " threads";
+
+        HashDictionary<size_t, size_t> locked = HashDictionary<size_t, size_t>();
+        std::mutex mutex;
+        Benchmark("HashDictionary behind a mutex, " + threads, CONCURRENT_DICTIONARY_BENCH_OPERATIONS, [&locked, &mutex, thread_count, writes]() {
+            RunThreads(thread_count, [&locked, &mutex, writes](size_t thread, size_t count) {
+                size_t sum = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    size_t key = (thread * 7919 + i * 104729) % CONCURRENT_DICTIONARY_BENCH_KEYS;
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (i % 10 < writes) {
+                        locked.insertOrAssign(key, i);
+                    }
+                    else {
+                        const size_t* value = locked.tryGet(key);
+                        if (value != nullptr) sum += *value;
+                    }
+                }
+                Sink += sum;
+            });
+        });
+
+        ConcurrentDictionary<size_t, size_t> sharded;
+        Benchmark("ConcurrentDictionary, " + threads, CONCURRENT_DICTIONARY_BENCH_OPERATIONS, [&sharded, thread_count, writes]() {
+            RunThreads(thread_count, [&sharded, writes](size_t thread, size_t count) {
+                size_t sum = 0;
+                size_t value = 0;
+                for (size_t i = 0; i < count; ++i) {
+                    size_t key = (thread * 7919 + i * 104729) % CONCURRENT_DICTIONARY_BENCH_KEYS;
+                    if (i % 10 < writes) {
+                        sharded.insertOrAssign(key, i);
+                    }
+                    else if (sharded.tryGet(key, value)) {
+                        sum += value;
+                    }
+                }
+                Sink += sum;
+            });
+        });
+    }
+}
+
+
+BENCHMARK(ConcurrentDictionary, read_heavy) {
+    // One write in ten
+    Throughput(1);
+}
+
+BENCHMARK(ConcurrentDictionary, write_heavy) {
+    // Nine writes in ten
+    Throughput(9);
+}
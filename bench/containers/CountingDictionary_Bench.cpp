@@ -0,0 +1,95 @@
+//
+// CountingDictionary_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "CountingDictionary.hpp"
+#include "HashDictionary.hpp"
+#include "Benchmark.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+using namespace mrlib;
+
+
+#define COUNTING_BENCH_EVENTS 10000000
+#define COUNTING_BENCH_SHARDS 8
+
+// Events over a key space of the given size, a quarter of them on the first hundred keys so there are heavy hitters
+static std::vector<uint64_t> Events(size_t keys) {
+    std::vector<uint64_t> events = std::vector<uint64_t>(COUNTING_BENCH_EVENTS);
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (uint64_t& event : events) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        event = (state & 3) == 0 ? (state >> 2) % 100 : (state >> 2) % keys;
+    }
+
+    return events;
+}
+
+static void Count(size_t keys) {
+    std::vector<uint64_t> events = Events(keys);
+    std::string distinct = std::to_string(keys) + " keys";
+
+    Benchmark("std::unordered_map increment, " + distinct, events.size(), [&events]() {
+        std::unordered_map<uint64_t, size_t> counts;
+        for (uint64_t event : events) {
+            ++counts[event];
+        }
+        Sink += counts.size();
+    });
+
+    Benchmark("HashDictionary increment, " + distinct, events.size(), [&events]() {
+        HashDictionary<uint64_t, size_t> counts = HashDictionary<uint64_t, size_t>();
+        for (uint64_t event : events) {
+            ++counts[event];
+        }
+        Sink += counts.size();
+    });
+
+    CountingDictionary<uint64_t> counts = CountingDictionary<uint64_t>();
+    Benchmark("CountingDictionary increment, " + distinct, events.size(), [&counts, &events]() {
+        counts.incrementAll(events.begin(), events.end());
+    });
+
+    Benchmark("mostCommon(100), per key", counts.size(), [&counts]() {
+        Sink += counts.mostCommon(100).size();
+    });
+
+    Benchmark("heavyHitters(0.001), per key", counts.size(), [&counts]() {
+        Sink += counts.heavyHitters(0.001).size();
+    });
+
+    // Counters kept on separate threads, each over its own part of the events, then merged into one
+    std::vector<CountingDictionary<uint64_t>> shards = std::vector<CountingDictionary<uint64_t>>(COUNTING_BENCH_SHARDS);
+    size_t part = events.size() / COUNTING_BENCH_SHARDS;
+    for (size_t s = 0; s < COUNTING_BENCH_SHARDS; ++s) {
+        shards[s].incrementAll(events.begin() + s * part, events.begin() + (s + 1) * part);
+    }
+
+    size_t merged = 0;
+    for (const CountingDictionary<uint64_t>& shard : shards) {
+        merged += shard.size();
+    }
+
+    Benchmark("merge " + std::to_string(COUNTING_BENCH_SHARDS) + " shards, per key", merged, [&shards]() {
+        CountingDictionary<uint64_t> total = CountingDictionary<uint64_t>();
+        for (const CountingDictionary<uint64_t>& shard : shards) {
+            total.merge(shard);
+        }
+        Sink += total.size();
+    });
+}
+
+
+BENCHMARK(CountingDictionary, high_cardinality) {
+    Count(100000);
+    Count(1000000);
+    Count(4000000);
+}
@@ -0,0 +1,112 @@
+//
+// DescriptionWriter_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "Array.hpp"
+#include "Dictionary.hpp"
+#include "DescriptionWriter.hpp"
+#include "Benchmark.hpp"
+
+#include <sstream>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace mrlib;
+
+
+// The way description() rendered before DescriptionWriter
+template <typename It>
+static std::string StreamSequence(It begin, size_t size) {
+    std::ostringstream oss;
+    oss << "[";
+    for (size_t i = 0; i < size; ++i, ++begin) {
+        if (i != 0) oss << ", ";
+        oss << *begin;
+    }
+
+    oss << "]";
+    return oss.str();
+}
+
+template <typename T>
+static void SequenceDescriptions(const Array<T>& array) {
+    Benchmark("ostringstream", array.size(), [&array]() {
+        Sink += StreamSequence(array._data.begin(), array.size()).size();
+    });
+
+    Benchmark("description()", array.size(), [&array]() {
+        Sink += array.description().size();
+    });
+
+    DescriptionWriter writer;
+    writer.describe(array);
+    Benchmark("reused writer", array.size(), [&array, &writer]() {
+        Sink += writer.describe(array).size();
+    });
+}
+
+
+BENCHMARK(DescriptionWriter, array_of_ints) {
+    Array<int> array = Array<int>();
+    for (int i = 0; i < 1000000; ++i) {
+        array.add(i * 37 - 500000);
+    }
+
+    SequenceDescriptions(array);
+}
+
+BENCHMARK(DescriptionWriter, array_of_doubles) {
+    Array<double> array = Array<double>();
+    for (int i = 0; i < 1000000; ++i) {
+        array.add(i * 0.37);
+    }
+
+    SequenceDescriptions(array);
+}
+
+BENCHMARK(DescriptionWriter, dictionary_of_strings) {
+    Dictionary<int, std::string> dictionary = Dictionary<int, std::string>();
+    for (int i = 0; i < 200000; ++i) {
+        dictionary[i] = "value" + std::to_string(i);
+    }
+
+    Benchmark("ostringstream", dictionary.size(), [&dictionary]() {
+        std::ostringstream oss;
+        oss << "{";
+        bool first = true;
+        for (const auto& entry : dictionary) {
+            if (!first) oss << ", ";
+            oss << entry.first << " => " << entry.second;
+            first = false;
+        }
+        oss << "}";
+        Sink += oss.str().size();
+    });
+
+    Benchmark("description()", dictionary.size(), [&dictionary]() {
+        Sink += dictionary.description().size();
+    });
+}
+
+BENCHMARK(DescriptionWriter, truncated_and_streamed) {
+    Array<int> array = Array<int>();
+    for (int i = 0; i < 10000000; ++i) {
+        array.add(i);
+    }
+
+    // Only the first and last few elements are rendered, so this is per call
+    Benchmark("description(5, 5) of 10M, per call", 1, [&array]() {
+        Sink += array.description(5, 5).size();
+    });
+
+    int fd = ::open("/dev/null", O_WRONLY);
+    Benchmark("streamed to a file descriptor", array.size(), [&array, fd]() {
+        DescriptionWriter writer(fd);
+        array.describeTo(writer);
+        writer.flush();
+    });
+    ::close(fd);
+}
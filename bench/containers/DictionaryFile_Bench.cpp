@@ -0,0 +1,68 @@
+//
+// DictionaryFile_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "DictionaryFile.hpp"
+#include "Benchmark.hpp"
+
+#include <string>
+#include <unistd.h>
+
+using namespace mrlib;
+
+
+#define DICTIONARY_FILE_BENCH_KEYS 1000000
+
+static const std::string DictionaryFileBenchPath = "/tmp/mrlib_dictionary_file_bench.bin";
+
+static Dictionary<std::string, int> BenchDictionary() {
+    Dictionary<std::string, int> dictionary = Dictionary<std::string, int>();
+    for (int i = 0; i < DICTIONARY_FILE_BENCH_KEYS; ++i) {
+        dictionary["key" + std::to_string(i)] = i;
+    }
+
+    return dictionary;
+}
+
+
+BENCHMARK(DictionaryFile, write) {
+    Dictionary<std::string, int> dictionary = BenchDictionary();
+
+    // The way write worked before, the whole file in one buffer
+    Benchmark("serialize, then one write, per key", DICTIONARY_FILE_BENCH_KEYS, [&dictionary]() {
+        std::string buffer = DictionaryFile::serialize(dictionary);
+        ArrayFileWriter writer(DictionaryFileBenchPath);
+        writer.write(buffer.data(), buffer.size());
+        writer.commit();
+    });
+
+    Benchmark("write, per key", DICTIONARY_FILE_BENCH_KEYS, [&dictionary]() {
+        DictionaryFile::write(DictionaryFileBenchPath, dictionary);
+    });
+
+    ::unlink(DictionaryFileBenchPath.c_str());
+}
+
+BENCHMARK(DictionaryFile, startup) {
+    DictionaryFile::write(DictionaryFileBenchPath, BenchDictionary());
+
+    // Ready to answer lookups, then the first thousand of them
+    Benchmark("read into a Dictionary, per open", 1, []() {
+        Dictionary<std::string, int> dictionary = DictionaryFile::read<std::string, int>(DictionaryFileBenchPath);
+        for (int i = 0; i < 1000; ++i) {
+            Sink += *dictionary.tryGet("key" + std::to_string(i * 997));
+        }
+    });
+
+    Benchmark("map, per open", 1, []() {
+        MappedDictionary<std::string, int> mapped = DictionaryFile::map<std::string, int>(DictionaryFileBenchPath);
+        for (int i = 0; i < 1000; ++i) {
+            Sink += mapped.objectForKey("key" + std::to_string(i * 997));
+        }
+    });
+
+    ::unlink(DictionaryFileBenchPath.c_str());
+}
@@ -0,0 +1,187 @@
+//
+// Dictionary_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "Dictionary.hpp"
+#include "HashDictionary.hpp"
+#include "Benchmark.hpp"
+
+#include <string>
+#include <vector>
+#include <utility>
+
+using namespace mrlib;
+
+
+#define DICTIONARY_BENCH_KEYS 1000000
+
+// The checks before a lookup are written against the storage, the way the methods did them before tryGet and upsert
+template <typename D>
+static void LookupCost(const std::string& name) {
+    D dictionary = D();
+    for (int i = 0; i < DICTIONARY_BENCH_KEYS; ++i) {
+        dictionary[i * 2] = i;
+    }
+
+    // Every other key is missing
+    Benchmark(name + " count then []", DICTIONARY_BENCH_KEYS, [&dictionary]() {
+        size_t sum = 0;
+        for (int i = 0; i < DICTIONARY_BENCH_KEYS; ++i) {
+            if (dictionary._data.count(i)) sum += dictionary._data[i];
+        }
+        Sink += sum;
+    });
+
+    Benchmark(name + " tryGet", DICTIONARY_BENCH_KEYS, [&dictionary]() {
+        size_t sum = 0;
+        for (int i = 0; i < DICTIONARY_BENCH_KEYS; ++i) {
+            const int* value = dictionary.tryGet(i);
+            if (value != nullptr) sum += *value;
+        }
+        Sink += sum;
+    });
+
+    Benchmark(name + " count then [] to update", DICTIONARY_BENCH_KEYS, [&dictionary]() {
+        for (int i = 0; i < DICTIONARY_BENCH_KEYS; ++i) {
+            int key = i * 2;
+            if (dictionary._data.count(key)) dictionary._data[key] = dictionary._data[key] + 1;
+        }
+    });
+
+    Benchmark(name + " upsert", DICTIONARY_BENCH_KEYS, [&dictionary]() {
+        for (int i = 0; i < DICTIONARY_BENCH_KEYS; ++i) {
+            dictionary.upsert(i * 2, [](int& value) { ++value; });
+        }
+    });
+
+    // Half the keys are new, both start from their own copy
+    D first = dictionary;
+    D second = dictionary;
+    Benchmark(name + " count then [] to add", DICTIONARY_BENCH_KEYS, [&first]() {
+        for (int i = 0; i < DICTIONARY_BENCH_KEYS; ++i) {
+            if (!first._data.count(i + DICTIONARY_BENCH_KEYS)) first._data[i + DICTIONARY_BENCH_KEYS] = i;
+        }
+        Sink += first.size();
+    });
+
+    Benchmark(name + " getOrInsert", DICTIONARY_BENCH_KEYS, [&second]() {
+        for (int i = 0; i < DICTIONARY_BENCH_KEYS; ++i) {
+            second.getOrInsert(i + DICTIONARY_BENCH_KEYS, [i]() { return i; });
+        }
+        Sink += second.size();
+    });
+}
+
+
+BENCHMARK(Dictionary, single_lookup) {
+    LookupCost<Dictionary<int, int>>("Dictionary");
+    LookupCost<HashDictionary<int, int>>("HashDictionary");
+}
+
+// Adds, finds and removes the same keys one at a time and in batches of batch_size
+template <typename D>
+static void BatchScaling(const std::string& name, size_t batch_size) {
+    D base = D();
+    for (int i = 0; i < DICTIONARY_BENCH_KEYS; ++i) {
+        base[i * 2] = i;
+    }
+
+    // New odd keys in a scattered order, split into batches
+    std::vector<std::vector<std::pair<int, int>>> entries;
+    std::vector<std::vector<int>> keys;
+    for (size_t i = 0; i < DICTIONARY_BENCH_KEYS; ++i) {
+        if (i % batch_size == 0) {
+            entries.emplace_back();
+            keys.emplace_back();
+        }
+
+        int key = int((i * 2654435761u) % DICTIONARY_BENCH_KEYS) * 2 + 1;
+        entries.back().emplace_back(key, int(i));
+        keys.back().push_back(key);
+    }
+
+    std::string batches = ", batches of " + std::to_string(batch_size);
+    D single = base;
+    D batched = base;
+
+    Benchmark(name + " []" + batches, DICTIONARY_BENCH_KEYS, [&single, &entries]() {
+        for (const auto& batch : entries) {
+            for (const auto& entry : batch) {
+                single[entry.first] = entry.second;
+            }
+        }
+    });
+
+    Benchmark(name + " addAll" + batches, DICTIONARY_BENCH_KEYS, [&batched, &entries]() {
+        for (const auto& batch : entries) {
+            batched.addAll(batch);
+        }
+    });
+
+    Benchmark(name + " tryGet" + batches, DICTIONARY_BENCH_KEYS, [&single, &keys]() {
+        size_t sum = 0;
+        for (const auto& batch : keys) {
+            for (int key : batch) {
+                sum += *single.tryGet(key);
+            }
+        }
+        Sink += sum;
+    });
+
+    Benchmark(name + " getMany" + batches, DICTIONARY_BENCH_KEYS, [&batched, &keys]() {
+        size_t sum = 0;
+        for (const auto& batch : keys) {
+            for (int* value : batched.getMany(batch)) {
+                sum += *value;
+            }
+        }
+        Sink += sum;
+    });
+
+    Benchmark(name + " remove" + batches, DICTIONARY_BENCH_KEYS, [&single, &keys]() {
+        for (const auto& batch : keys) {
+            for (int key : batch) {
+                single.remove(key);
+            }
+        }
+    });
+
+    Benchmark(name + " removeMany" + batches, DICTIONARY_BENCH_KEYS, [&batched, &keys]() {
+        for (const auto& batch : keys) {
+            batched.removeMany(batch);
+        }
+    });
+}
+
+
+BENCHMARK(Dictionary, batch_scaling) {
+    for (size_t batch_size = 16; batch_size <= DICTIONARY_BENCH_KEYS; batch_size *= 16) {
+        BatchScaling<Dictionary<int, int>>("Dictionary", batch_size);
+        BatchScaling<HashDictionary<int, int>>("HashDictionary", batch_size);
+    }
+}
+
+BENCHMARK(Dictionary, merge) {
+    // Half of the keys of each side are in the other
+    Dictionary<int, int> tree1 = Dictionary<int, int>();
+    Dictionary<int, int> tree2 = Dictionary<int, int>();
+    HashDictionary<int, int> hash1 = HashDictionary<int, int>();
+    HashDictionary<int, int> hash2 = HashDictionary<int, int>();
+    for (int i = 0; i < DICTIONARY_BENCH_KEYS; ++i) {
+        tree1[i * 2] = i;
+        tree2[i * 2 + DICTIONARY_BENCH_KEYS] = i;
+        hash1[i * 2] = i;
+        hash2[i * 2 + DICTIONARY_BENCH_KEYS] = i;
+    }
+
+    Benchmark("Dictionary +, per key", DICTIONARY_BENCH_KEYS * 2, [&tree1, &tree2]() {
+        Sink += (tree1 + tree2).size();
+    });
+
+    Benchmark("HashDictionary +, per key", DICTIONARY_BENCH_KEYS * 2, [&hash1, &hash2]() {
+        Sink += (hash1 + hash2).size();
+    });
+}
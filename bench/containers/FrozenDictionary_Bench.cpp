@@ -0,0 +1,70 @@
+//
+// FrozenDictionary_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "Dictionary.hpp"
+#include "HashDictionary.hpp"
+#include "FrozenDictionary.hpp"
+#include "Benchmark.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace mrlib;
+
+
+// Looks every key up in a scattered order, so consecutive lookups do not share cache lines
+template <typename D, typename K>
+static void Lookups(const std::string& name, const D& dictionary, const std::vector<K>& keys) {
+    Benchmark(name + " tryGet", keys.size(), [&dictionary, &keys]() {
+        size_t sum = 0;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            const int* value = dictionary.tryGet(keys[(i * 2654435761u) % keys.size()]);
+            if (value != nullptr) sum += *value;
+        }
+        Sink += sum;
+    });
+}
+
+template <typename K>
+static void BuildAndLookup(const std::vector<K>& keys) {
+    Dictionary<K, int> tree = Dictionary<K, int>();
+    HashDictionary<K, int> hash = HashDictionary<K, int>();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        tree[keys[i]] = int(i);
+        hash[keys[i]] = int(i);
+    }
+
+    FrozenDictionary<K, int> frozen = FrozenDictionary<K, int>();
+    Benchmark("FrozenDictionary build, per key", keys.size(), [&tree, &frozen]() {
+        frozen = FrozenDictionary<K, int>(tree);
+        Sink += frozen.size();
+    });
+
+    Lookups("Dictionary", tree, keys);
+    Lookups("HashDictionary", hash, keys);
+    Lookups("FrozenDictionary", frozen, keys);
+}
+
+
+BENCHMARK(FrozenDictionary, int_keys) {
+    std::vector<int> keys;
+    for (int i = 0; i < 1000000; ++i) {
+        keys.push_back(i * 7 + 3);
+    }
+
+    BuildAndLookup(keys);
+}
+
+BENCHMARK(FrozenDictionary, string_keys) {
+    // Route like keys, which share long prefixes
+    std::vector<std::string> keys;
+    for (int i = 0; i < 100000; ++i) {
+        keys.push_back("/api/v1/accounts/" + std::to_string(i) + "/settings");
+    }
+
+    BuildAndLookup(keys);
+}
@@ -0,0 +1,91 @@
+//
+// HashDictionary_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "Dictionary.hpp"
+#include "HashDictionary.hpp"
+#include "Benchmark.hpp"
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+using namespace mrlib;
+
+
+// Small sizes are repeated until each timing covers at least this many operations
+#define HASH_DICTIONARY_BENCH_MIN_OPERATIONS 4000000
+
+// Spreads consecutive indices over the key space (the SplitMix64 finalizer), so neither storage sees them in order
+static uint64_t ScatteredKey(size_t index) {
+    uint64_t key = uint64_t(index) + 0x9E3779B97F4A7C15ull;
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ull;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBull;
+    return key ^ (key >> 31);
+}
+
+template <typename D>
+static void InsertLookupEraseIterate(const std::string& name, size_t size) {
+    size_t rounds = std::max(size_t(1), size_t(HASH_DICTIONARY_BENCH_MIN_OPERATIONS) / size);
+    D dictionary = D();
+
+    Benchmark(name + " insert", size * rounds, [&dictionary, size, rounds]() {
+        for (size_t r = 0; r < rounds; ++r) {
+            dictionary.removeAll();
+            for (size_t i = 0; i < size; ++i) {
+                dictionary.insertOrAssign(ScatteredKey(i), i);
+            }
+        }
+        Sink += dictionary.size();
+    });
+
+    // Every other lookup misses
+    Benchmark(name + " lookup", size * rounds, [&dictionary, size, rounds]() {
+        size_t sum = 0;
+        for (size_t r = 0; r < rounds; ++r) {
+            for (size_t i = 0; i < size; ++i) {
+                const uint64_t* value = dictionary.tryGet(ScatteredKey(i / 2 + (i % 2) * size));
+                if (value != nullptr) sum += *value;
+            }
+        }
+        Sink += sum;
+    });
+
+    Benchmark(name + " iterate", size * rounds, [&dictionary, rounds]() {
+        size_t sum = 0;
+        for (size_t r = 0; r < rounds; ++r) {
+            for (const auto& entry : dictionary) {
+                sum += entry.second;
+            }
+        }
+        Sink += sum;
+    });
+
+    // Copies are made up front, so only the erasing is timed
+    std::vector<D> copies = std::vector<D>(rounds, dictionary);
+    Benchmark(name + " erase", size * rounds, [&copies, size]() {
+        for (D& copy : copies) {
+            for (size_t i = 0; i < size; ++i) {
+                copy.remove(ScatteredKey(i));
+            }
+            Sink += copy.size();
+        }
+    });
+}
+
+
+BENCHMARK(HashDictionary, insert_lookup_iterate_erase) {
+    std::vector<size_t> sizes = {1000, 100000, 1000000, 10000000};
+    if (BenchmarkLarge()) {
+        sizes.push_back(100000000);
+    }
+
+    for (size_t size : sizes) {
+        std::string entries = std::to_string(size) + " entries";
+        InsertLookupEraseIterate<Dictionary<uint64_t, uint64_t>>("Dictionary, " + entries, size);
+        InsertLookupEraseIterate<HashDictionary<uint64_t, uint64_t>>("HashDictionary, " + entries, size);
+    }
+}
@@ -0,0 +1,143 @@
+//
+// RadixDictionary_Bench.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "RadixDictionary.hpp"
+#include "Dictionary.hpp"
+#include "HashDictionary.hpp"
+#include "Benchmark.hpp"
+
+#include <string>
+#include <vector>
+#include <functional>
+
+using namespace mrlib;
+
+
+#define RADIX_BENCH_KEYS 200000
+#define RADIX_BENCH_PREFIXES 1000
+
+struct StringBenchHash {
+    size_t operator()(const String& string) const {
+        return std::hash<std::string>()(string._data);
+    }
+};
+
+// Looks every key up in a scattered order, so consecutive lookups do not share cache lines
+template <typename D>
+static void Lookups(const std::string& name, const D& dictionary, const std::vector<String>& keys) {
+    Benchmark(name + " tryGet", keys.size(), [&dictionary, &keys]() {
+        size_t sum = 0;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            const int* value = dictionary.tryGet(keys[(i * 2654435761u) % keys.size()]);
+            if (value != nullptr) sum += *value;
+        }
+        Sink += sum;
+    });
+}
+
+// Builds each dictionary from the keys, looks them all up, then visits every key under each prefix
+static void BuildAndQuery(const std::vector<String>& keys, const std::vector<String>& prefixes) {
+    Dictionary<String, int> tree = Dictionary<String, int>();
+    Benchmark("Dictionary insert", keys.size(), [&tree, &keys]() {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            tree[keys[i]] = int(i);
+        }
+    });
+
+    HashDictionary<String, int, StringBenchHash> hash = HashDictionary<String, int, StringBenchHash>();
+    Benchmark("HashDictionary insert", keys.size(), [&hash, &keys]() {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            hash[keys[i]] = int(i);
+        }
+    });
+
+    RadixDictionary<int> radix = RadixDictionary<int>();
+    Benchmark("RadixDictionary insert", keys.size(), [&radix, &keys]() {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            radix[keys[i]] = int(i);
+        }
+    });
+
+    Lookups("Dictionary", tree, keys);
+    Lookups("HashDictionary", hash, keys);
+    Lookups("RadixDictionary", radix, keys);
+
+    // A Dictionary finds a prefix's keys from the first key not less than it, the order of the keys is the same
+    Benchmark("Dictionary prefix scan, per prefix", prefixes.size(), [&tree, &prefixes]() {
+        size_t sum = 0;
+        for (const String& prefix : prefixes) {
+            const std::string& bytes = prefix._data;
+            for (auto it = tree._data.lower_bound(prefix); it != tree._data.end(); ++it) {
+                if (it->first._data.compare(0, bytes.size(), bytes) != 0) break;
+                sum += it->second;
+            }
+        }
+        Sink += sum;
+    });
+
+    Benchmark("RadixDictionary prefix scan, per prefix", prefixes.size(), [&radix, &prefixes]() {
+        size_t sum = 0;
+        for (const String& prefix : prefixes) {
+            for (const auto& pair : radix.withPrefix(prefix)) {
+                sum += pair.second;
+            }
+        }
+        Sink += sum;
+    });
+}
+
+
+BENCHMARK(RadixDictionary, urls) {
+    // Request paths, which share the host and route and differ in their ids
+    std::vector<String> keys;
+    for (int i = 0; i < RADIX_BENCH_KEYS; ++i) {
+        keys.push_back(String("https://example.com/api/v2/accounts/" + std::to_string(i / 20) + "/orders/" + std::to_string(i)));
+    }
+
+    std::vector<String> prefixes;
+    for (int i = 0; i < RADIX_BENCH_PREFIXES; ++i) {
+        prefixes.push_back(String("https://example.com/api/v2/accounts/" + std::to_string(i * 7) + "/"));
+    }
+
+    BuildAndQuery(keys, prefixes);
+
+    RadixDictionary<int> routes = RadixDictionary<int>();
+    for (int i = 0; i < RADIX_BENCH_KEYS / 20; ++i) {
+        routes["https://example.com/api/v2/accounts/" + std::to_string(i) + "/"] = i;
+    }
+
+    Benchmark("RadixDictionary longestPrefixOf", keys.size(), [&routes, &keys]() {
+        size_t sum = 0;
+        for (const String& key : keys) {
+            const RadixDictionary<int>::value_type* route = routes.longestPrefixOf(key);
+            if (route != nullptr) sum += route->second;
+        }
+        Sink += sum;
+    });
+}
+
+BENCHMARK(RadixDictionary, log_keys) {
+    // Metric names, a few services and regions with many hosts and a handful of metrics each
+    const char* services[] = {"api", "auth", "billing", "search"};
+    const char* regions[] = {"us-east-1", "us-west-2", "eu-west-1"};
+    const char* metrics[] = {"latency.p50", "latency.p99", "requests", "errors", "bytes.in", "bytes.out"};
+
+    std::vector<String> keys;
+    std::vector<String> prefixes;
+    for (int i = 0; keys.size() < RADIX_BENCH_KEYS; ++i) {
+        std::string host = std::string(services[i % 4]) + "." + regions[(i / 4) % 3] + ".host-" + std::to_string(i) + ".";
+        if (prefixes.size() < RADIX_BENCH_PREFIXES && i % 7 == 0) {
+            prefixes.push_back(String(host));
+        }
+
+        for (const char* metric : metrics) {
+            keys.push_back(String(host + metric));
+        }
+    }
+
+    BuildAndQuery(keys, prefixes);
+}
@@ -18,6 +18,12 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <algorithm>
+#include <utility>
+
+#include "ArrayStream.hpp"
+#include "ArraySlice.hpp"
+#include "DescriptionWriter.hpp"
 
 // Index Constants
 #ifndef NO_INDEX
@@ -27,31 +33,36 @@
 // Index out of bounds exception
 #define ARRAY_OUT_BOUNDS std::invalid_argument("Array: Out of bounds exception")
 #define ARRAY_INV_FROM_TO std::invalid_argument("Array: from_index must be less than to_index")
+#define ARRAY_UNSORTED_INDICES std::invalid_argument("Array: indices must be sorted in ascending order")
 
 namespace mrlib {
 
+    // Declared in ArraySlice.hpp, which includes this file before it gets there when it is included first
     template <typename T>
+    class ArraySlice;
+
+    template <typename T, typename Storage = std::vector<T>>
     class Array {
     public:
         // Internal Data
-        std::vector<T> _data;
+        Storage _data;
 
         // Constructors
-        Array<T>();
-        Array<T>(size_t size);
-        Array<T>(std::initializer_list<T> i_list);
-        Array<T>(const std::vector<T>& vector);
-        Array<T>(const Array<T>& array);
-        Array<T>(Array<T>&& array);
+        Array<T, Storage>();
+        Array<T, Storage>(size_t size);
+        Array<T, Storage>(std::initializer_list<T> i_list);
+        Array<T, Storage>(const std::vector<T>& vector);
+        Array<T, Storage>(const Array<T, Storage>& array);
+        Array<T, Storage>(Array<T, Storage>&& array);
 
         // Operator Overloading
         T&              operator[](const size_t index);
-        Array<T>&       operator=(const Array<T>& array);
-        Array<T>&       operator=(Array<T>&& array);
-        const Array<T>  operator+(const Array<T>& array) const;
-        Array<T>&       operator+=(const Array<T>& array);
-        bool            operator==(const Array<T>& array) const;
-        bool            operator!=(const Array<T>& array) const;
+        Array<T, Storage>&       operator=(const Array<T, Storage>& array);
+        Array<T, Storage>&       operator=(Array<T, Storage>&& array);
+        const Array<T, Storage>  operator+(const Array<T, Storage>& array) const;
+        Array<T, Storage>&       operator+=(const Array<T, Storage>& array);
+        bool            operator==(const Array<T, Storage>& array) const;
+        bool            operator!=(const Array<T, Storage>& array) const;
 
         // Querying Array
         T       peak() const;
@@ -59,36 +70,54 @@ namespace mrlib {
         T       firstObject() const;
         T       lastObject() const;
         bool    contains(const T& object) const;
-        bool    containsAll(const Array<T>& objects) const;
+        bool    containsAll(const Array<T, Storage>& objects) const;
         size_t  size() const;
         bool    isEmpty() const;
 
+        // Capacity
+        size_t              capacity() const;
+        Array<T, Storage>&  reserve(size_t capacity);
+        Array<T, Storage>&  shrinkToFit();
+
         // Adding Objects
-        Array<T>&  add(const T& object);
-        Array<T>&  addAll(const Array<T>& objects);
-        Array<T>&  insert(const T& object, size_t index);
+        Array<T, Storage>&  add(const T& object);
+        Array<T, Storage>&  addFirst(const T& object);
+        Array<T, Storage>&  addAll(const Array<T, Storage>& objects);
+        template <typename InputIt>
+        Array<T, Storage>&  addAll(InputIt first, InputIt last);
+        Array<T, Storage>&  insert(const T& object, size_t index);
+        Array<T, Storage>&  insertAll(const Array<T, Storage>& objects, size_t index);
+        template <typename InputIt>
+        Array<T, Storage>&  insertAll(InputIt first, InputIt last, size_t index);
 
         // Removing Objects
         T          pop();
-        Array<T>&  remove(const T& object);
-        Array<T>&  removeIndex(size_t index);
-        Array<T>&  removeRange(size_t from_index, size_t to_index);
-        Array<T>&  removeAll(const T& object);
-        Array<T>&  removeAll(const Array<T>& objects);
-        Array<T>&  removeAll();
-        Array<T>&  retainAll(const Array<T>& objects);
+        T          popFirst();
+        Array<T, Storage>&  remove(const T& object);
+        Array<T, Storage>&  removeIndex(size_t index);
+        Array<T, Storage>&  removeRange(size_t from_index, size_t to_index);
+        Array<T, Storage>&  removeAll(const T& object);
+        Array<T, Storage>&  removeAll(const Array<T, Storage>& objects);
+        Array<T, Storage>&  removeAll();
+        Array<T, Storage>&  retainAll(const Array<T, Storage>& objects);
+        template <typename F>
+        Array<T, Storage>&  removeIf(F predicate);
+        Array<T, Storage>&  removeIndices(const Array<size_t>& indices);
 
         // Replace Object
-        Array<T>&  replace(const T& old_object, const T& new_object);
-        Array<T>&  replaceLast(const T& old_object, const T& new_object);
-        Array<T>&  replaceIndex(size_t index, const T& new_object);
-        Array<T>&  replaceAll(const T& old_object, const T& new_object);
-        Array<T>&  swap(size_t first_index, size_t second_index);
+        Array<T, Storage>&  replace(const T& old_object, const T& new_object);
+        Array<T, Storage>&  replaceLast(const T& old_object, const T& new_object);
+        Array<T, Storage>&  replaceIndex(size_t index, const T& new_object);
+        Array<T, Storage>&  replaceAll(const T& old_object, const T& new_object);
+        Array<T, Storage>&  swap(size_t first_index, size_t second_index);
 
         // Dividing Array
-        Array<T>  subarray(size_t from_index, size_t to_index) const;
-        Array<T>  subarrayFromIndex(size_t index) const;
-        Array<T>  subarrayToIndex(size_t index) const;
+        Array<T, Storage>  subarray(size_t from_index, size_t to_index) const;
+        Array<T, Storage>  subarrayFromIndex(size_t index) const;
+        Array<T, Storage>  subarrayToIndex(size_t index) const;
+        ArraySlice<T>  slice(size_t from_index, size_t to_index) const;
+        ArraySlice<T>  sliceFromIndex(size_t index) const;
+        ArraySlice<T>  sliceToIndex(size_t index) const;
 
         // Finding Objects
         size_t  indexOf(const T& object, size_t min_index = 0) const;
@@ -97,22 +126,44 @@ namespace mrlib {
         size_t  indexOfObjectInRange(const T& object, size_t from_index, size_t to_index) const;
 
         // Sorting Array
-        Array<T>&  sort();
+        Array<T, Storage>&  sort();
 
         // Reversing Array
-        Array<T>&  reverse();
+        Array<T, Storage>&  reverse();
+
+        // Functional Operations
+        ArrayStream<T, ArrayStreamIdentity<T>>  stream() const;
+        ArrayStream<T, ArrayStreamIdentity<T>>  parallelStream(size_t thread_count = 0) const;
+        template <typename F>
+        ArrayStream<T, ArrayStreamMap<ArrayStreamIdentity<T>, F>>     map(F function) const;
+        template <typename F>
+        ArrayStream<T, ArrayStreamFilter<ArrayStreamIdentity<T>, F>>  filter(F predicate) const;
+        template <typename R, typename F>
+        R     reduce(R identity, F accumulator) const;
+        template <typename F>
+        T     reduce(F accumulator) const;
+        template <typename F>
+        void  forEach(F function) const;
+        template <typename F>
+        bool  anyOf(F predicate) const;
+        template <typename F>
+        bool  allOf(F predicate) const;
+        template <typename F>
+        std::pair<Array<T, Storage>, Array<T, Storage>>  partition(F predicate) const;
 
         // Comparing Array
-        bool  isEqualTo(const Array<T>& array) const;
+        bool  isEqualTo(const Array<T, Storage>& array) const;
 
         // Array Copy
-        Array<T>  copy() const;
+        Array<T, Storage>  copy() const;
 
         // Getting Standard Containers
         std::vector<T>  std_vector() const;
 
         // String Representation
         std::string  description() const;
+        std::string  description(size_t head, size_t tail) const;
+        void         describeTo(DescriptionWriter& writer) const;
         std::string  inspect() const;
     };
 
@@ -122,40 +173,40 @@ namespace mrlib {
     /////////////////////////////
 
     // Constructors
-    template <typename T>
-    Array<T>::Array() {
-        this->_data = std::vector<T>();
+    template <typename T, typename Storage>
+    Array<T, Storage>::Array() {
+        this->_data = Storage();
     }
 
-    template <typename T>
-    Array<T>::Array(size_t size) {
-        this->_data = std::vector<T>(size);
+    template <typename T, typename Storage>
+    Array<T, Storage>::Array(size_t size) {
+        this->_data = Storage(size);
     }
 
-    template <typename T>
-    Array<T>::Array(std::initializer_list<T> i_list) {
-        this->_data = std::vector<T>(i_list);
+    template <typename T, typename Storage>
+    Array<T, Storage>::Array(std::initializer_list<T> i_list) {
+        this->_data = Storage(i_list);
     }
 
-    template <typename T>
-    Array<T>::Array(const std::vector<T>& vector) {
-        this->_data = vector;
+    template <typename T, typename Storage>
+    Array<T, Storage>::Array(const std::vector<T>& vector) {
+        this->_data.assign(vector.begin(), vector.end());
     }
 
-    template <typename T>
-    Array<T>::Array(const Array<T>& array) {
+    template <typename T, typename Storage>
+    Array<T, Storage>::Array(const Array<T, Storage>& array) {
         this->_data = array._data;
     }
 
-    template <typename T>
-    Array<T>::Array(Array<T>&& array) {
-        this->_data = array._data;
+    template <typename T, typename Storage>
+    Array<T, Storage>::Array(Array<T, Storage>&& array) {
+        this->_data = std::move(array._data);
     }
 
 
     // Operator Overloading
-    template <typename T>
-    T& Array<T>::operator[](const size_t index) {
+    template <typename T, typename Storage>
+    T& Array<T, Storage>::operator[](const size_t index) {
         if (index < this->_data.size()) {
             return this->_data[index];
         }
@@ -164,47 +215,47 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    Array<T>& Array<T>::operator=(const Array<T>& array) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::operator=(const Array<T, Storage>& array) {
         this->_data = array._data;
         return *this;
     }
 
-    template <typename T>
-    Array<T>& Array<T>::operator=(Array<T>&& array) {
-        this->_data = array._data;
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::operator=(Array<T, Storage>&& array) {
+        this->_data = std::move(array._data);
         return *this;
     }
 
-    template <typename T>
-    const Array<T> Array<T>::operator+(const Array<T>& array) const {
-        Array<T> buffer = Array();
+    template <typename T, typename Storage>
+    const Array<T, Storage> Array<T, Storage>::operator+(const Array<T, Storage>& array) const {
+        Array<T, Storage> buffer = Array<T, Storage>();
         buffer._data.insert(buffer._data.begin(), this->_data.begin(), this->_data.end());
         buffer._data.insert(buffer._data.end(), array._data.begin(), array._data.end());
         return buffer;
     }
 
-    template <typename T>
-    Array<T>& Array<T>::operator+=(const Array<T>& array) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::operator+=(const Array<T, Storage>& array) {
         if (this == &array) return *this;
         this->_data.insert(this->_data.end(), array._data.begin(), array._data.end());
         return *this;
     }
 
-    template <typename T>
-    bool Array<T>::operator==(const Array<T>& array) const {
+    template <typename T, typename Storage>
+    bool Array<T, Storage>::operator==(const Array<T, Storage>& array) const {
         return this->_data == array._data;
     }
 
-    template <typename T>
-    bool Array<T>::operator!=(const Array<T>& array) const {
+    template <typename T, typename Storage>
+    bool Array<T, Storage>::operator!=(const Array<T, Storage>& array) const {
         return this->_data != array._data;
     }
 
 
     // Querying Array
-    template <typename T>
-    T Array<T>::peak() const {
+    template <typename T, typename Storage>
+    T Array<T, Storage>::peak() const {
         if (this->_data.size() > 0) {
             return this->_data[this->_data.size() - 1];
         }
@@ -213,8 +264,8 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    T Array<T>::objectAtIndex(size_t index) const {
+    template <typename T, typename Storage>
+    T Array<T, Storage>::objectAtIndex(size_t index) const {
         if (index < this->_data.size()) {
             return this->_data[index];
         }
@@ -223,8 +274,8 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    T Array<T>::firstObject() const {
+    template <typename T, typename Storage>
+    T Array<T, Storage>::firstObject() const {
         if (this->_data.size() > 0) {
             return this->_data[0];
         }
@@ -233,8 +284,8 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    T Array<T>::lastObject() const {
+    template <typename T, typename Storage>
+    T Array<T, Storage>::lastObject() const {
         if (this->_data.size() > 0) {
             return this->_data[this->_data.size() - 1];
         }
@@ -243,13 +294,13 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    bool Array<T>::contains(const T& object) const {
+    template <typename T, typename Storage>
+    bool Array<T, Storage>::contains(const T& object) const {
         return this->indexOf(object) != NO_INDEX;
     }
 
-    template <typename T>
-    bool Array<T>::containsAll(const Array<T>& objects) const {
+    template <typename T, typename Storage>
+    bool Array<T, Storage>::containsAll(const Array<T, Storage>& objects) const {
         for (const T& object : objects._data) {
             if (this->indexOf(object) == NO_INDEX) return false;
         }
@@ -257,35 +308,70 @@ namespace mrlib {
         return true;
     }
 
-    template <typename T>
-    size_t Array<T>::size() const {
+    template <typename T, typename Storage>
+    size_t Array<T, Storage>::size() const {
         return this->_data.size();
     }
 
-    template <typename T>
-    bool Array<T>::isEmpty() const {
+    template <typename T, typename Storage>
+    bool Array<T, Storage>::isEmpty() const {
         return this->_data.empty();
     }
 
 
+    // Capacity
+    template <typename T, typename Storage>
+    size_t Array<T, Storage>::capacity() const {
+        return this->_data.capacity();
+    }
+
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::reserve(size_t capacity) {
+        this->_data.reserve(capacity);
+        return *this;
+    }
+
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::shrinkToFit() {
+        this->_data.shrink_to_fit();
+        return *this;
+    }
+
+
     // Adding Objects
-    template <typename T>
-    Array<T>& Array<T>::add(const T& object) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::add(const T& object) {
         this->_data.push_back(object);
         return *this;
     }
 
-    template <typename T>
-    Array<T>& Array<T>::addAll(const Array<T>& objects) {
-        for (const T& object : objects._data) {
-            this->_data.push_back(object);
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::addFirst(const T& object) {
+        this->_data.insert(this->_data.begin(), object);
+        return *this;
+    }
+
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::addAll(const Array<T, Storage>& objects) {
+        if (this == &objects) {
+            Storage copy = objects._data;
+            return this->addAll(copy.begin(), copy.end());
         }
 
+        return this->addAll(objects._data.begin(), objects._data.end());
+    }
+
+    template <typename T, typename Storage>
+    template <typename InputIt>
+    Array<T, Storage>& Array<T, Storage>::addAll(InputIt first, InputIt last) {
+        // A single range insert grows the storage once, and copies trivially
+        // copyable objects as a block
+        this->_data.insert(this->_data.end(), first, last);
         return *this;
     }
 
-    template <typename T>
-    Array<T>& Array<T>::insert(const T& object, size_t index) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::insert(const T& object, size_t index) {
         if (index < this->_data.size()) {
             this->_data.insert(this->_data.begin() + index, object);
             return *this;
@@ -295,10 +381,32 @@ namespace mrlib {
         }
     }
 
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::insertAll(const Array<T, Storage>& objects, size_t index) {
+        if (this == &objects) {
+            Storage copy = objects._data;
+            return this->insertAll(copy.begin(), copy.end(), index);
+        }
+
+        return this->insertAll(objects._data.begin(), objects._data.end(), index);
+    }
+
+    template <typename T, typename Storage>
+    template <typename InputIt>
+    Array<T, Storage>& Array<T, Storage>::insertAll(InputIt first, InputIt last, size_t index) {
+        if (index < this->_data.size()) {
+            this->_data.insert(this->_data.begin() + index, first, last);
+            return *this;
+        }
+        else {
+            throw ARRAY_OUT_BOUNDS;
+        }
+    }
+
 
     // Removing Objects
-    template <typename T>
-    T Array<T>::pop() {
+    template <typename T, typename Storage>
+    T Array<T, Storage>::pop() {
         if (this->_data.size() > 0) {
             T object = this->_data.back();
             this->_data.pop_back();
@@ -309,8 +417,20 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    Array<T>& Array<T>::remove(const T& object) {
+    template <typename T, typename Storage>
+    T Array<T, Storage>::popFirst() {
+        if (this->_data.size() > 0) {
+            T object = this->_data.front();
+            this->_data.erase(this->_data.begin());
+            return object;
+        }
+        else {
+            throw ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::remove(const T& object) {
         size_t index = this->indexOf(object);
 
         if (index != NO_INDEX) {
@@ -320,8 +440,8 @@ namespace mrlib {
         return *this;
     }
 
-    template <typename T>
-    Array<T>& Array<T>::removeIndex(size_t index) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::removeIndex(size_t index) {
         if (index < this->_data.size()) {
             this->_data.erase(this->_data.begin() + index);
             return *this;
@@ -331,8 +451,8 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    Array<T>& Array<T>::removeRange(size_t from_index, size_t to_index) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::removeRange(size_t from_index, size_t to_index) {
         if (from_index > to_index) {
             throw ARRAY_INV_FROM_TO;
         }
@@ -346,30 +466,30 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    Array<T>& Array<T>::removeAll(const T& object) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::removeAll(const T& object) {
         this->_data.erase(std::remove(this->_data.begin(), this->_data.end(), object), this->_data.end());
         return *this;
     }
 
-    template <typename T>
-    Array<T>& Array<T>::removeAll(const Array<T>& objects) {
-        for (const T& object : objects._data) {
-            this->removeAll(object);
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::removeAll(const Array<T, Storage>& objects) {
+        if (this == &objects) {
+            return this->removeAll();
         }
 
-        return *this;
+        return this->removeIf([&objects](const T& object) { return objects.contains(object); });
     }
 
-    template <typename T>
-    Array<T>& Array<T>::removeAll() {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::removeAll() {
         this->_data.clear();
         return *this;
     }
 
-    template <typename T>
-    Array<T>& Array<T>::retainAll(const Array<T>& objects) {
-        std::vector<T> new_array = std::vector<T>();
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::retainAll(const Array<T, Storage>& objects) {
+        Storage new_array = Storage();
 
         for (const T& object : this->_data) {
             if (objects.contains(object)) {
@@ -377,14 +497,57 @@ namespace mrlib {
             }
         }
 
-        this->_data = new_array;
+        this->_data = std::move(new_array);
+        return *this;
+    }
+
+    template <typename T, typename Storage>
+    template <typename F>
+    Array<T, Storage>& Array<T, Storage>::removeIf(F predicate) {
+        this->_data.erase(std::remove_if(this->_data.begin(), this->_data.end(), predicate), this->_data.end());
+        return *this;
+    }
+
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::removeIndices(const Array<size_t>& indices) {
+        size_t size = this->_data.size();
+
+        // Validate first so a bad index leaves the array untouched
+        for (size_t i = 0; i < indices._data.size(); ++i) {
+            if (indices._data[i] >= size) {
+                throw ARRAY_OUT_BOUNDS;
+            }
+
+            if (i > 0 && indices._data[i] < indices._data[i - 1]) {
+                throw ARRAY_UNSORTED_INDICES;
+            }
+        }
+
+        // Shift the kept objects down in a single sweep
+        size_t next = 0;
+        size_t write = 0;
+        for (size_t read = 0; read < size; ++read) {
+            if (next < indices._data.size() && indices._data[next] == read) {
+                while (next < indices._data.size() && indices._data[next] == read) {
+                    ++next;
+                }
+            }
+            else {
+                if (write != read) {
+                    this->_data[write] = std::move(this->_data[read]);
+                }
+                ++write;
+            }
+        }
+
+        this->_data.erase(this->_data.begin() + write, this->_data.end());
         return *this;
     }
 
 
     // Replace Object
-    template <typename T>
-    Array<T>& Array<T>::replace(const T& old_object, const T& new_object) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::replace(const T& old_object, const T& new_object) {
         size_t index = this->indexOf(old_object);
         if (index != NO_INDEX) {
             this->_data[index] = new_object;
@@ -393,8 +556,8 @@ namespace mrlib {
         return *this;
     }
 
-    template <typename T>
-    Array<T>& Array<T>::replaceLast(const T& old_object, const T& new_object) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::replaceLast(const T& old_object, const T& new_object) {
         size_t index = this->indexOfLast(old_object);
         if (index != NO_INDEX) {
             this->_data[index] = new_object;
@@ -403,8 +566,8 @@ namespace mrlib {
         return *this;
     }
 
-    template <typename T>
-    Array<T>& Array<T>::replaceIndex(size_t index, const T& new_object) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::replaceIndex(size_t index, const T& new_object) {
         if (index < this->_data.size()) {
             this->_data[index] = new_object;
             return *this;
@@ -414,8 +577,8 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    Array<T>& Array<T>::replaceAll(const T& old_object, const T& new_object) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::replaceAll(const T& old_object, const T& new_object) {
         for (size_t i = 0; i < this->_data.size(); ++i) {
             if (this->_data[i] == old_object) {
                 this->_data[i] = new_object;
@@ -425,8 +588,8 @@ namespace mrlib {
         return *this;
     }
 
-    template <typename T>
-    Array<T>& Array<T>::swap(size_t first_index, size_t second_index) {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::swap(size_t first_index, size_t second_index) {
         if (first_index < this->_data.size() && second_index < this->_data.size()) {
             T temp = this->_data[first_index];
             this->_data[first_index] = this->_data[second_index];
@@ -440,15 +603,15 @@ namespace mrlib {
 
 
     // Dividing Array
-    template <typename T>
-    Array<T> Array<T>::subarray(size_t from_index, size_t to_index) const {
+    template <typename T, typename Storage>
+    Array<T, Storage> Array<T, Storage>::subarray(size_t from_index, size_t to_index) const {
         if (from_index > to_index) {
             throw ARRAY_INV_FROM_TO;
         }
 
         if (from_index < this->_data.size() && to_index < this->_data.size()) {
-            Array<T> subarray = Array<T>();
-            std::copy(this->_data.begin() + from_index, this->_data.begin() + to_index + 1, std::back_inserter(subarray._data));
+            Array<T, Storage> subarray = Array<T, Storage>();
+            subarray._data.assign(this->_data.begin() + from_index, this->_data.begin() + to_index + 1);
             return subarray;
         }
         else {
@@ -456,11 +619,11 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    Array<T> Array<T>::subarrayFromIndex(size_t index) const {
+    template <typename T, typename Storage>
+    Array<T, Storage> Array<T, Storage>::subarrayFromIndex(size_t index) const {
         if (index < this->_data.size()) {
-            Array<T> subarray = Array<T>();
-            std::copy(this->_data.begin() + index, this->_data.end(), std::back_inserter(subarray._data));
+            Array<T, Storage> subarray = Array<T, Storage>();
+            subarray._data.assign(this->_data.begin() + index, this->_data.end());
             return subarray;
         }
         else {
@@ -468,11 +631,11 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    Array<T> Array<T>::subarrayToIndex(size_t index) const {
+    template <typename T, typename Storage>
+    Array<T, Storage> Array<T, Storage>::subarrayToIndex(size_t index) const {
         if (index < this->_data.size()) {
-            Array<T> subarray = Array<T>();
-            std::copy(this->_data.begin(), this->_data.begin() + index, std::back_inserter(subarray._data));
+            Array<T, Storage> subarray = Array<T, Storage>();
+            subarray._data.assign(this->_data.begin(), this->_data.begin() + index);
             return subarray;
         }
         else {
@@ -480,10 +643,25 @@ namespace mrlib {
         }
     }
 
+    template <typename T, typename Storage>
+    ArraySlice<T> Array<T, Storage>::slice(size_t from_index, size_t to_index) const {
+        return ArraySlice<T>(*this).slice(from_index, to_index);
+    }
+
+    template <typename T, typename Storage>
+    ArraySlice<T> Array<T, Storage>::sliceFromIndex(size_t index) const {
+        return ArraySlice<T>(*this).sliceFromIndex(index);
+    }
+
+    template <typename T, typename Storage>
+    ArraySlice<T> Array<T, Storage>::sliceToIndex(size_t index) const {
+        return ArraySlice<T>(*this).sliceToIndex(index);
+    }
+
 
     // Finding Objects
-    template <typename T>
-    size_t Array<T>::indexOf(const T& object, size_t min_index) const {
+    template <typename T, typename Storage>
+    size_t Array<T, Storage>::indexOf(const T& object, size_t min_index) const {
         if (min_index < this->_data.size()) {
             for (size_t i = min_index; i < this->_data.size(); ++i) {
                 if (this->_data[i] == object) {
@@ -498,13 +676,13 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    size_t Array<T>::indexOfLast(const T& object) const {
+    template <typename T, typename Storage>
+    size_t Array<T, Storage>::indexOfLast(const T& object) const {
         return this->indexOfLast(object, this->_data.size() -1);
     }
 
-    template <typename T>
-    size_t Array<T>::indexOfLast(const T &object, size_t max_index) const {
+    template <typename T, typename Storage>
+    size_t Array<T, Storage>::indexOfLast(const T &object, size_t max_index) const {
         if (max_index < this->_data.size()) {
             for (size_t i = max_index; i < this->_data.size(); --i) {
                 if (this->_data[i] == object) {
@@ -519,8 +697,8 @@ namespace mrlib {
         }
     }
 
-    template <typename T>
-    size_t Array<T>::indexOfObjectInRange(const T& object, size_t from_index, size_t to_index) const {
+    template <typename T, typename Storage>
+    size_t Array<T, Storage>::indexOfObjectInRange(const T& object, size_t from_index, size_t to_index) const {
         if (from_index > to_index) {
             throw ARRAY_INV_FROM_TO;
         }
@@ -541,24 +719,84 @@ namespace mrlib {
 
 
     // Sorting Array
-    template <typename T>
-    Array<T>& Array<T>::sort() {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::sort() {
         std::sort(this->_data.begin(), this->_data.end());
         return *this;
     }
 
 
     // Reversing Array
-    template <typename T>
-    Array<T>& Array<T>::reverse() {
+    template <typename T, typename Storage>
+    Array<T, Storage>& Array<T, Storage>::reverse() {
         std::reverse(this->_data.begin(), this->_data.end());
         return *this;
     }
 
 
+    // Functional Operations
+    template <typename T, typename Storage>
+    ArrayStream<T, ArrayStreamIdentity<T>> Array<T, Storage>::stream() const {
+        return ArrayStream<T, ArrayStreamIdentity<T>>(this->_data.data(), this->_data.size(), ArrayStreamIdentity<T>());
+    }
+
+    template <typename T, typename Storage>
+    ArrayStream<T, ArrayStreamIdentity<T>> Array<T, Storage>::parallelStream(size_t thread_count) const {
+        return this->stream().parallel(thread_count);
+    }
+
+    template <typename T, typename Storage>
+    template <typename F>
+    ArrayStream<T, ArrayStreamMap<ArrayStreamIdentity<T>, F>> Array<T, Storage>::map(F function) const {
+        return this->stream().map(function);
+    }
+
+    template <typename T, typename Storage>
+    template <typename F>
+    ArrayStream<T, ArrayStreamFilter<ArrayStreamIdentity<T>, F>> Array<T, Storage>::filter(F predicate) const {
+        return this->stream().filter(predicate);
+    }
+
+    template <typename T, typename Storage>
+    template <typename R, typename F>
+    R Array<T, Storage>::reduce(R identity, F accumulator) const {
+        return this->stream().reduce(identity, accumulator);
+    }
+
+    template <typename T, typename Storage>
+    template <typename F>
+    T Array<T, Storage>::reduce(F accumulator) const {
+        return this->stream().reduce(accumulator);
+    }
+
+    template <typename T, typename Storage>
+    template <typename F>
+    void Array<T, Storage>::forEach(F function) const {
+        this->stream().forEach(function);
+    }
+
+    template <typename T, typename Storage>
+    template <typename F>
+    bool Array<T, Storage>::anyOf(F predicate) const {
+        return this->stream().anyOf(predicate);
+    }
+
+    template <typename T, typename Storage>
+    template <typename F>
+    bool Array<T, Storage>::allOf(F predicate) const {
+        return this->stream().allOf(predicate);
+    }
+
+    template <typename T, typename Storage>
+    template <typename F>
+    std::pair<Array<T, Storage>, Array<T, Storage>> Array<T, Storage>::partition(F predicate) const {
+        return this->stream().template partitionInto<Array<T, Storage>>(predicate);
+    }
+
+
     // Comparing Array
-    template <typename T>
-    bool Array<T>::isEqualTo(const Array<T>& array) const {
+    template <typename T, typename Storage>
+    bool Array<T, Storage>::isEqualTo(const Array<T, Storage>& array) const {
         size_t size = this->_data.size();
         if (size != array._data.size()) return false;
 
@@ -571,52 +809,54 @@ namespace mrlib {
 
 
     // Array Copy
-    template <typename T>
-    Array<T> Array<T>::copy() const {
-        return Array<T>(this->_data);
+    template <typename T, typename Storage>
+    Array<T, Storage> Array<T, Storage>::copy() const {
+        return Array<T, Storage>(*this);
     }
 
 
     // Getting Standard Containers
-    template <typename T>
-    std::vector<T> Array<T>::std_vector() const {
-        return this->_data;
+    template <typename T, typename Storage>
+    std::vector<T> Array<T, Storage>::std_vector() const {
+        return std::vector<T>(this->_data.begin(), this->_data.end());
     }
 
 
     // String Representation
-    template <typename T>
-    std::string Array<T>::description() const {
-        std::ostringstream oss;
-        oss << "[";
-
-        size_t last = this->_data.size() - 1;
-        for (size_t i = 0; i < this->_data.size(); ++i) {
-            oss << this->_data[i];
+    template <typename T, typename Storage>
+    std::string Array<T, Storage>::description() const {
+        DescriptionWriter writer;
+        this->describeTo(writer);
+        return writer.take();
+    }
 
-            if (i != last) {
-                oss << ", ";
-            }
-        }
+    template <typename T, typename Storage>
+    std::string Array<T, Storage>::description(size_t head, size_t tail) const {
+        DescriptionWriter writer;
+        writer.truncate(head, tail);
+        this->describeTo(writer);
+        return writer.take();
+    }
 
-        oss << "]";
-        return oss.str();
+    template <typename T, typename Storage>
+    void Array<T, Storage>::describeTo(DescriptionWriter& writer) const {
+        writer.sequence(this->_data.begin(), this->_data.size());
     }
 
-    template <typename T>
-    std::string Array<T>::inspect() const {
-        std::ostringstream oss;
+    template <typename T, typename Storage>
+    std::string Array<T, Storage>::inspect() const {
+        DescriptionWriter writer;
 
         // Array Address
-        oss << "Address: " << this << " ";
+        writer.write("Address: ").address(this).write(' ');
 
         // Array Size
-        oss << "Size: " << this->_data.size() << " ";
+        writer.write("Size: ").value(this->_data.size()).write(' ');
 
         // Array Contents
-        oss << this->description();
+        this->describeTo(writer);
 
-        return oss.str();
+        return writer.take();
     }
 }
 
@@ -0,0 +1,656 @@
+//
+// ArrayFile.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to persist an Array in a compact binary
+ * format. The file is a fixed size header followed by the elements. For
+ * trivially copyable types the elements are the raw bytes of the array,
+ * which are written with a single system call and can be mapped back into
+ * memory as a read only MappedArray without copying. Any other type is
+ * written element by element through ArraySerializer, which can be
+ * specialized to add support for new types.
+ *
+ * The header records the byte order of the machine that wrote the file,
+ * and files written with a different byte order are rejected.
+ *
+ * Files are written under a temporary name and renamed over the path, so
+ * a reader never sees a partly written file and mappings of the old file
+ * stay valid. ArrayFileWriter does this for other file formats too.
+ */
+
+
+#ifndef MRLIB_ARRAY_FILE_HPP
+#define MRLIB_ARRAY_FILE_HPP
+
+#include <atomic>
+#include <string>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#include "Array.hpp"
+#include "String.hpp"
+
+// File format constants
+#define ARRAY_FILE_MAGIC "MRAR"
+#define ARRAY_FILE_ENDIAN_MARK 0x01020304u
+#define ARRAY_FILE_VERSION 1u
+#define ARRAY_FILE_RAW 0u
+#define ARRAY_FILE_SERIALIZED 1u
+
+// Most parts a single writev takes, POSIX only promises 16 when IOV_MAX is missing
+#ifdef IOV_MAX
+#define ARRAY_FILE_WRITE_PARTS IOV_MAX
+#else
+#define ARRAY_FILE_WRITE_PARTS 16
+#endif
+
+// File format exceptions
+#define ARRAY_FILE_INV_FORMAT std::invalid_argument("ArrayFile: Invalid file format")
+#define ARRAY_FILE_INV_ENDIAN std::invalid_argument("ArrayFile: File was written with a different byte order")
+#define ARRAY_FILE_INV_TYPE std::invalid_argument("ArrayFile: Element type does not match file")
+
+namespace mrlib {
+
+    struct ArrayFileHeader {
+        char      magic[4];
+        uint32_t  endian;
+        uint32_t  version;
+        uint32_t  flags;
+        uint64_t  element_size;
+        uint64_t  count;
+    };
+
+
+    // Serializer hook, specialize for types that are not trivially copyable
+    template <typename T, typename Enable = void>
+    struct ArraySerializer;
+
+    template <typename T>
+    struct ArraySerializer<T, typename std::enable_if<std::is_trivially_copyable<T>::value>::type> {
+        static void write(std::string& buffer, const T& object) {
+            buffer.append(reinterpret_cast<const char*>(&object), sizeof(T));
+        }
+
+        static T read(const char*& cursor, const char* end) {
+            if (size_t(end - cursor) < sizeof(T)) {
+                throw ARRAY_FILE_INV_FORMAT;
+            }
+
+            T object;
+            std::memcpy(&object, cursor, sizeof(T));
+            cursor += sizeof(T);
+            return object;
+        }
+    };
+
+    template <>
+    struct ArraySerializer<std::string> {
+        static void write(std::string& buffer, const std::string& object) {
+            ArraySerializer<uint64_t>::write(buffer, object.size());
+            buffer.append(object);
+        }
+
+        static std::string read(const char*& cursor, const char* end) {
+            uint64_t length = ArraySerializer<uint64_t>::read(cursor, end);
+            if (uint64_t(end - cursor) < length) {
+                throw ARRAY_FILE_INV_FORMAT;
+            }
+
+            std::string object = std::string(cursor, length);
+            cursor += length;
+            return object;
+        }
+    };
+
+    template <>
+    struct ArraySerializer<String> {
+        static void write(std::string& buffer, const String& object) {
+            ArraySerializer<std::string>::write(buffer, object._data);
+        }
+
+        static String read(const char*& cursor, const char* end) {
+            return String(ArraySerializer<std::string>::read(cursor, end));
+        }
+    };
+
+
+    // Read only mapping of a whole file
+    class ArrayFileMapping {
+    public:
+        // Internal Data
+        void*   _address;
+        size_t  _length;
+
+        // Constructors
+        ArrayFileMapping();
+        ArrayFileMapping(const std::string& path);
+        ArrayFileMapping(ArrayFileMapping&& mapping);
+        ArrayFileMapping(const ArrayFileMapping&) = delete;
+        ~ArrayFileMapping();
+
+        // Operator Overloading
+        ArrayFileMapping&  operator=(ArrayFileMapping&& mapping);
+        ArrayFileMapping&  operator=(const ArrayFileMapping&) = delete;
+
+        // Querying Mapping
+        const char*  data() const;
+        size_t       size() const;
+
+    private:
+        void  _unmap();
+    };
+
+
+    // Writes a file under a temporary name, and renames it over the path when it is committed
+    class ArrayFileWriter {
+    public:
+        // Internal Data
+        std::string  _path;
+        std::string  _temporary;
+        int          _fd;
+
+        // Constructors
+        ArrayFileWriter(const std::string& path);
+        ArrayFileWriter(const ArrayFileWriter&) = delete;
+        ~ArrayFileWriter();
+
+        // Operator Overloading
+        ArrayFileWriter&  operator=(const ArrayFileWriter&) = delete;
+
+        // Writing File
+        ArrayFileWriter&  write(const char* bytes, size_t length);
+        ArrayFileWriter&  write(struct iovec* parts, size_t count);
+        void              commit();
+
+    private:
+        void  _fail(const char* message);
+    };
+
+
+    // Zero copy view of a raw array file
+    template <typename T>
+    class MappedArray {
+    public:
+        // Internal Data
+        ArrayFileMapping  _mapping;
+        const T*          _begin;
+        size_t            _size;
+
+        // Constructors
+        MappedArray();
+        MappedArray(ArrayFileMapping&& mapping, const T* begin, size_t size);
+
+        // Operator Overloading
+        const T&  operator[](const size_t index) const;
+
+        // Iteration
+        const T*  begin() const;
+        const T*  end() const;
+
+        // Querying Array
+        size_t  size() const;
+        bool    isEmpty() const;
+
+        // Getting Containers
+        ArraySlice<T>  slice() const;
+        Array<T>       copy() const;
+    };
+
+
+    class ArrayFile {
+    public:
+        // Serializing Arrays
+        template <typename T, typename Storage>
+        static std::string  serialize(const Array<T, Storage>& array);
+        template <typename T>
+        static Array<T>     deserialize(const std::string& bytes);
+        template <typename T>
+        static Array<T>     deserialize(const char* bytes, size_t length);
+
+        // Reading and Writing Files
+        template <typename T, typename Storage>
+        static void            write(const std::string& path, const Array<T, Storage>& array);
+        template <typename T>
+        static Array<T>        read(const std::string& path);
+        template <typename T>
+        static MappedArray<T>  map(const std::string& path);
+
+    private:
+        template <typename T>
+        static ArrayFileHeader  _header(size_t count, bool raw);
+        template <typename T>
+        static const char*      _validate(const char* bytes, size_t length, bool raw, uint64_t& count);
+        template <typename T, typename Storage>
+        static void             _serialize(std::string& buffer, const Array<T, Storage>& array, std::true_type);
+        template <typename T, typename Storage>
+        static void             _serialize(std::string& buffer, const Array<T, Storage>& array, std::false_type);
+        template <typename T>
+        static Array<T>         _deserialize(const char* bytes, size_t length, std::true_type);
+        template <typename T>
+        static Array<T>         _deserialize(const char* bytes, size_t length, std::false_type);
+        template <typename T, typename Storage>
+        static void             _write(const std::string& path, const Array<T, Storage>& array, std::true_type);
+        template <typename T, typename Storage>
+        static void             _write(const std::string& path, const Array<T, Storage>& array, std::false_type);
+    };
+
+
+    ////////////////////
+    // IMPLEMENTATION //
+    ////////////////////
+
+    // Constructors
+    inline
+    ArrayFileMapping::ArrayFileMapping() {
+        this->_address = nullptr;
+        this->_length = 0;
+    }
+
+    inline
+    ArrayFileMapping::ArrayFileMapping(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("ArrayFile: Error opening file at path: " + path);
+        }
+
+        struct stat info;
+        if (::fstat(fd, &info) < 0) {
+            ::close(fd);
+            throw std::runtime_error("ArrayFile: Error reading file at path: " + path);
+        }
+
+        this->_length = size_t(info.st_size);
+        this->_address = nullptr;
+
+        if (this->_length > 0) {
+            this->_address = ::mmap(nullptr, this->_length, PROT_READ, MAP_SHARED, fd, 0);
+        }
+
+        ::close(fd);
+
+        if (this->_address == MAP_FAILED) {
+            this->_address = nullptr;
+            throw std::runtime_error("ArrayFile: Error mapping file at path: " + path);
+        }
+    }
+
+    inline
+    ArrayFileMapping::ArrayFileMapping(ArrayFileMapping&& mapping) {
+        this->_address = mapping._address;
+        this->_length = mapping._length;
+        mapping._address = nullptr;
+        mapping._length = 0;
+    }
+
+    inline
+    ArrayFileMapping::~ArrayFileMapping() {
+        this->_unmap();
+    }
+
+
+    // Operator Overloading
+    inline
+    ArrayFileMapping& ArrayFileMapping::operator=(ArrayFileMapping&& mapping) {
+        if (this != &mapping) {
+            this->_unmap();
+            this->_address = mapping._address;
+            this->_length = mapping._length;
+            mapping._address = nullptr;
+            mapping._length = 0;
+        }
+
+        return *this;
+    }
+
+
+    // Querying Mapping
+    inline
+    const char* ArrayFileMapping::data() const {
+        return static_cast<const char*>(this->_address);
+    }
+
+    inline
+    size_t ArrayFileMapping::size() const {
+        return this->_length;
+    }
+
+
+    // Internal Functions
+    inline
+    void ArrayFileMapping::_unmap() {
+        if (this->_address != nullptr) {
+            ::munmap(this->_address, this->_length);
+            this->_address = nullptr;
+            this->_length = 0;
+        }
+    }
+
+
+    // Constructors
+    inline
+    ArrayFileWriter::ArrayFileWriter(const std::string& path) : _path(path) {
+        // Unique within the process as well, so two threads writing the same path do not share a temporary file
+        static std::atomic<uint64_t> next_temporary(0);
+        this->_temporary = path + ".tmp" + std::to_string(::getpid()) + "." + std::to_string(next_temporary++);
+
+        this->_fd = ::open(this->_temporary.c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+        if (this->_fd < 0) {
+            throw std::runtime_error("ArrayFile: Error opening file at path: " + path);
+        }
+    }
+
+    inline
+    ArrayFileWriter::~ArrayFileWriter() {
+        // A writer that was never committed leaves the file at the path as it was
+        if (this->_fd >= 0) {
+            ::close(this->_fd);
+            ::unlink(this->_temporary.c_str());
+        }
+    }
+
+
+    // Writing File
+    inline
+    ArrayFileWriter& ArrayFileWriter::write(const char* bytes, size_t length) {
+        struct iovec part;
+        part.iov_base = const_cast<char*>(bytes);
+        part.iov_len = length;
+        return this->write(&part, 1);
+    }
+
+    inline
+    ArrayFileWriter& ArrayFileWriter::write(struct iovec* parts, size_t count) {
+        // Large writes can return early, so continue from where the last one stopped
+        while (count > 0) {
+            ssize_t written = ::writev(this->_fd, parts, int(std::min(count, size_t(ARRAY_FILE_WRITE_PARTS))));
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                this->_fail("ArrayFile: Error writing file at path: ");
+            }
+
+            while (count > 0 && size_t(written) >= parts->iov_len) {
+                written -= parts->iov_len;
+                ++parts;
+                --count;
+            }
+
+            if (count > 0) {
+                parts->iov_base = static_cast<char*>(parts->iov_base) + written;
+                parts->iov_len -= written;
+            }
+        }
+
+        return *this;
+    }
+
+    inline
+    void ArrayFileWriter::commit() {
+        int fd = this->_fd;
+        this->_fd = -1;
+
+        if (::close(fd) < 0 || ::rename(this->_temporary.c_str(), this->_path.c_str()) < 0) {
+            ::unlink(this->_temporary.c_str());
+            throw std::runtime_error("ArrayFile: Error writing file at path: " + this->_path);
+        }
+    }
+
+
+    // Internal Functions
+    inline
+    void ArrayFileWriter::_fail(const char* message) {
+        ::close(this->_fd);
+        ::unlink(this->_temporary.c_str());
+        this->_fd = -1;
+        throw std::runtime_error(message + this->_path);
+    }
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename T>
+    MappedArray<T>::MappedArray() {
+        this->_begin = nullptr;
+        this->_size = 0;
+    }
+
+    template <typename T>
+    MappedArray<T>::MappedArray(ArrayFileMapping&& mapping, const T* begin, size_t size) : _mapping(std::move(mapping)) {
+        this->_begin = begin;
+        this->_size = size;
+    }
+
+
+    // Operator Overloading
+    template <typename T>
+    const T& MappedArray<T>::operator[](const size_t index) const {
+        if (index < this->_size) {
+            return this->_begin[index];
+        }
+        else {
+            throw ARRAY_OUT_BOUNDS;
+        }
+    }
+
+
+    // Iteration
+    template <typename T>
+    const T* MappedArray<T>::begin() const {
+        return this->_begin;
+    }
+
+    template <typename T>
+    const T* MappedArray<T>::end() const {
+        return this->_begin + this->_size;
+    }
+
+
+    // Querying Array
+    template <typename T>
+    size_t MappedArray<T>::size() const {
+        return this->_size;
+    }
+
+    template <typename T>
+    bool MappedArray<T>::isEmpty() const {
+        return this->_size == 0;
+    }
+
+
+    // Getting Containers
+    template <typename T>
+    ArraySlice<T> MappedArray<T>::slice() const {
+        return ArraySlice<T>(this->_begin, this->_size);
+    }
+
+    template <typename T>
+    Array<T> MappedArray<T>::copy() const {
+        Array<T> array = Array<T>();
+        array._data.assign(this->begin(), this->end());
+        return array;
+    }
+
+
+    // Serializing Arrays
+    template <typename T, typename Storage>
+    std::string ArrayFile::serialize(const Array<T, Storage>& array) {
+        std::string buffer = std::string();
+        ArrayFile::_serialize(buffer, array, std::integral_constant<bool, std::is_trivially_copyable<T>::value>());
+        return buffer;
+    }
+
+    template <typename T>
+    Array<T> ArrayFile::deserialize(const std::string& bytes) {
+        return ArrayFile::deserialize<T>(bytes.data(), bytes.size());
+    }
+
+    template <typename T>
+    Array<T> ArrayFile::deserialize(const char* bytes, size_t length) {
+        return ArrayFile::_deserialize<T>(bytes, length, std::integral_constant<bool, std::is_trivially_copyable<T>::value>());
+    }
+
+
+    // Reading and Writing Files
+    template <typename T, typename Storage>
+    void ArrayFile::write(const std::string& path, const Array<T, Storage>& array) {
+        ArrayFile::_write(path, array, std::integral_constant<bool, std::is_trivially_copyable<T>::value>());
+    }
+
+    template <typename T>
+    Array<T> ArrayFile::read(const std::string& path) {
+        ArrayFileMapping mapping = ArrayFileMapping(path);
+        return ArrayFile::deserialize<T>(mapping.data(), mapping.size());
+    }
+
+    template <typename T>
+    MappedArray<T> ArrayFile::map(const std::string& path) {
+        static_assert(std::is_trivially_copyable<T>::value, "ArrayFile: Only trivially copyable types can be mapped");
+        static_assert(alignof(T) <= sizeof(ArrayFileHeader), "ArrayFile: Element alignment exceeds header size");
+
+        ArrayFileMapping mapping = ArrayFileMapping(path);
+        uint64_t count = 0;
+        const char* data = ArrayFile::_validate<T>(mapping.data(), mapping.size(), true, count);
+
+        return MappedArray<T>(std::move(mapping), reinterpret_cast<const T*>(data), size_t(count));
+    }
+
+
+    // Internal Functions
+    template <typename T>
+    ArrayFileHeader ArrayFile::_header(size_t count, bool raw) {
+        ArrayFileHeader header;
+        std::memcpy(header.magic, ARRAY_FILE_MAGIC, sizeof(header.magic));
+        header.endian = ARRAY_FILE_ENDIAN_MARK;
+        header.version = ARRAY_FILE_VERSION;
+        header.flags = raw ? ARRAY_FILE_RAW : ARRAY_FILE_SERIALIZED;
+        header.element_size = raw ? sizeof(T) : 0;
+        header.count = count;
+        return header;
+    }
+
+    template <typename T>
+    const char* ArrayFile::_validate(const char* bytes, size_t length, bool raw, uint64_t& count) {
+        if (length < sizeof(ArrayFileHeader)) {
+            throw ARRAY_FILE_INV_FORMAT;
+        }
+
+        ArrayFileHeader header;
+        std::memcpy(&header, bytes, sizeof(header));
+
+        if (std::memcmp(header.magic, ARRAY_FILE_MAGIC, sizeof(header.magic)) != 0 || header.version != ARRAY_FILE_VERSION) {
+            throw ARRAY_FILE_INV_FORMAT;
+        }
+
+        if (header.endian != ARRAY_FILE_ENDIAN_MARK) {
+            throw ARRAY_FILE_INV_ENDIAN;
+        }
+
+        if (header.flags != (raw ? ARRAY_FILE_RAW : ARRAY_FILE_SERIALIZED)) {
+            throw ARRAY_FILE_INV_TYPE;
+        }
+
+        if (raw) {
+            if (header.element_size != sizeof(T)) {
+                throw ARRAY_FILE_INV_TYPE;
+            }
+
+            if ((length - sizeof(header)) / sizeof(T) < header.count) {
+                throw ARRAY_FILE_INV_FORMAT;
+            }
+        }
+
+        count = header.count;
+        return bytes + sizeof(header);
+    }
+
+    template <typename T, typename Storage>
+    void ArrayFile::_serialize(std::string& buffer, const Array<T, Storage>& array, std::true_type) {
+        ArrayFileHeader header = ArrayFile::_header<T>(array._data.size(), true);
+
+        buffer.reserve(sizeof(header) + array._data.size() * sizeof(T));
+        buffer.append(reinterpret_cast<const char*>(&header), sizeof(header));
+        buffer.append(reinterpret_cast<const char*>(array._data.data()), array._data.size() * sizeof(T));
+    }
+
+    template <typename T, typename Storage>
+    void ArrayFile::_serialize(std::string& buffer, const Array<T, Storage>& array, std::false_type) {
+        ArrayFileHeader header = ArrayFile::_header<T>(array._data.size(), false);
+        buffer.append(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        for (const T& object : array._data) {
+            ArraySerializer<T>::write(buffer, object);
+        }
+    }
+
+    template <typename T>
+    Array<T> ArrayFile::_deserialize(const char* bytes, size_t length, std::true_type) {
+        uint64_t count = 0;
+        const char* data = ArrayFile::_validate<T>(bytes, length, true, count);
+
+        Array<T> array = Array<T>(size_t(count));
+        if (count > 0) {
+            std::memcpy(array._data.data(), data, size_t(count) * sizeof(T));
+        }
+
+        return array;
+    }
+
+    template <typename T>
+    Array<T> ArrayFile::_deserialize(const char* bytes, size_t length, std::false_type) {
+        uint64_t count = 0;
+        const char* cursor = ArrayFile::_validate<T>(bytes, length, false, count);
+        const char* end = bytes + length;
+
+        Array<T> array = Array<T>();
+        for (uint64_t i = 0; i < count; ++i) {
+            array._data.push_back(ArraySerializer<T>::read(cursor, end));
+        }
+
+        return array;
+    }
+
+    template <typename T, typename Storage>
+    void ArrayFile::_write(const std::string& path, const Array<T, Storage>& array, std::true_type) {
+        ArrayFileHeader header = ArrayFile::_header<T>(array._data.size(), true);
+
+        // Header and elements go out together without an intermediate copy
+        struct iovec parts[2];
+        parts[0].iov_base = &header;
+        parts[0].iov_len = sizeof(header);
+        parts[1].iov_base = const_cast<T*>(array._data.data());
+        parts[1].iov_len = array._data.size() * sizeof(T);
+
+        ArrayFileWriter writer(path);
+        writer.write(parts, 2);
+        writer.commit();
+    }
+
+    template <typename T, typename Storage>
+    void ArrayFile::_write(const std::string& path, const Array<T, Storage>& array, std::false_type) {
+        std::string buffer = ArrayFile::serialize(array);
+
+        ArrayFileWriter writer(path);
+        writer.write(buffer.data(), buffer.size());
+        writer.commit();
+    }
+}
+
+#endif // MRLIB_ARRAY_FILE_HPP
@@ -0,0 +1,376 @@
+//
+// ArraySlice.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to give a read only view over a range of
+ * an Array without copying its elements. A slice has the same querying
+ * interface as an Array, and can be copied into an Array when ownership
+ * is needed.
+ *
+ * A slice is invalidated by anything that reallocates or shrinks the
+ * array it was taken from.
+ */
+
+
+#ifndef MRLIB_ARRAY_SLICE_HPP
+#define MRLIB_ARRAY_SLICE_HPP
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+
+#include "ArrayStream.hpp"
+#include "DescriptionWriter.hpp"
+
+// Index Constants
+#ifndef NO_INDEX
+#define NO_INDEX -1ull
+#endif
+
+// Slice exceptions
+#define ARRAY_SLICE_OUT_BOUNDS std::invalid_argument("ArraySlice: Out of bounds exception")
+#define ARRAY_SLICE_INV_FROM_TO std::invalid_argument("ArraySlice: from_index must be less than to_index")
+
+namespace mrlib {
+
+    template <typename T>
+    class ArraySlice {
+    public:
+        // Internal Data
+        const T*  _begin;
+        size_t    _size;
+
+        // Constructors
+        ArraySlice();
+        ArraySlice(const T* begin, size_t size);
+        template <typename Storage>
+        ArraySlice(const Array<T, Storage>& array);
+
+        // Operator Overloading
+        const T&  operator[](const size_t index) const;
+        bool      operator==(const ArraySlice<T>& slice) const;
+        bool      operator!=(const ArraySlice<T>& slice) const;
+
+        // Iteration
+        const T*  begin() const;
+        const T*  end() const;
+
+        // Querying Slice
+        T       objectAtIndex(size_t index) const;
+        T       firstObject() const;
+        T       lastObject() const;
+        bool    contains(const T& object) const;
+        bool    containsAll(const ArraySlice<T>& objects) const;
+        size_t  size() const;
+        bool    isEmpty() const;
+
+        // Dividing Slice
+        ArraySlice<T>  slice(size_t from_index, size_t to_index) const;
+        ArraySlice<T>  sliceFromIndex(size_t index) const;
+        ArraySlice<T>  sliceToIndex(size_t index) const;
+
+        // Finding Objects
+        size_t  indexOf(const T& object, size_t min_index = 0) const;
+        size_t  indexOfLast(const T& object) const;
+        size_t  indexOfLast(const T& object, size_t max_index) const;
+        size_t  indexOfObjectInRange(const T& object, size_t from_index, size_t to_index) const;
+
+        // Functional Operations
+        ArrayStream<T, ArrayStreamIdentity<T>>  stream() const;
+        ArrayStream<T, ArrayStreamIdentity<T>>  parallelStream(size_t thread_count = 0) const;
+
+        // Comparing Slice
+        bool  isEqualTo(const ArraySlice<T>& slice) const;
+
+        // Slice Copy
+        Array<T, std::vector<T>>  copy() const;
+
+        // Getting Standard Containers
+        std::vector<T>  std_vector() const;
+
+        // String Representation
+        std::string  description() const;
+        std::string  inspect() const;
+    };
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename T>
+    ArraySlice<T>::ArraySlice() {
+        this->_begin = nullptr;
+        this->_size = 0;
+    }
+
+    template <typename T>
+    ArraySlice<T>::ArraySlice(const T* begin, size_t size) {
+        this->_begin = begin;
+        this->_size = size;
+    }
+
+    template <typename T>
+    template <typename Storage>
+    ArraySlice<T>::ArraySlice(const Array<T, Storage>& array) {
+        this->_begin = array._data.data();
+        this->_size = array._data.size();
+    }
+
+
+    // Operator Overloading
+    template <typename T>
+    const T& ArraySlice<T>::operator[](const size_t index) const {
+        if (index < this->_size) {
+            return this->_begin[index];
+        }
+        else {
+            throw ARRAY_SLICE_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T>
+    bool ArraySlice<T>::operator==(const ArraySlice<T>& slice) const {
+        return this->isEqualTo(slice);
+    }
+
+    template <typename T>
+    bool ArraySlice<T>::operator!=(const ArraySlice<T>& slice) const {
+        return !this->isEqualTo(slice);
+    }
+
+
+    // Iteration
+    template <typename T>
+    const T* ArraySlice<T>::begin() const {
+        return this->_begin;
+    }
+
+    template <typename T>
+    const T* ArraySlice<T>::end() const {
+        return this->_begin + this->_size;
+    }
+
+
+    // Querying Slice
+    template <typename T>
+    T ArraySlice<T>::objectAtIndex(size_t index) const {
+        return (*this)[index];
+    }
+
+    template <typename T>
+    T ArraySlice<T>::firstObject() const {
+        if (this->_size > 0) {
+            return this->_begin[0];
+        }
+        else {
+            throw ARRAY_SLICE_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T>
+    T ArraySlice<T>::lastObject() const {
+        if (this->_size > 0) {
+            return this->_begin[this->_size - 1];
+        }
+        else {
+            throw ARRAY_SLICE_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T>
+    bool ArraySlice<T>::contains(const T& object) const {
+        return this->_size > 0 && this->indexOf(object) != NO_INDEX;
+    }
+
+    template <typename T>
+    bool ArraySlice<T>::containsAll(const ArraySlice<T>& objects) const {
+        for (const T& object : objects) {
+            if (!this->contains(object)) return false;
+        }
+
+        return true;
+    }
+
+    template <typename T>
+    size_t ArraySlice<T>::size() const {
+        return this->_size;
+    }
+
+    template <typename T>
+    bool ArraySlice<T>::isEmpty() const {
+        return this->_size == 0;
+    }
+
+
+    // Dividing Slice
+    template <typename T>
+    ArraySlice<T> ArraySlice<T>::slice(size_t from_index, size_t to_index) const {
+        if (from_index > to_index) {
+            throw ARRAY_SLICE_INV_FROM_TO;
+        }
+
+        if (from_index < this->_size && to_index < this->_size) {
+            return ArraySlice<T>(this->_begin + from_index, to_index - from_index + 1);
+        }
+        else {
+            throw ARRAY_SLICE_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T>
+    ArraySlice<T> ArraySlice<T>::sliceFromIndex(size_t index) const {
+        if (index < this->_size) {
+            return ArraySlice<T>(this->_begin + index, this->_size - index);
+        }
+        else {
+            throw ARRAY_SLICE_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T>
+    ArraySlice<T> ArraySlice<T>::sliceToIndex(size_t index) const {
+        if (index < this->_size) {
+            return ArraySlice<T>(this->_begin, index);
+        }
+        else {
+            throw ARRAY_SLICE_OUT_BOUNDS;
+        }
+    }
+
+
+    // Finding Objects
+    template <typename T>
+    size_t ArraySlice<T>::indexOf(const T& object, size_t min_index) const {
+        if (min_index < this->_size) {
+            for (size_t i = min_index; i < this->_size; ++i) {
+                if (this->_begin[i] == object) {
+                    return i;
+                }
+            }
+
+            return NO_INDEX;
+        }
+        else {
+            throw ARRAY_SLICE_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T>
+    size_t ArraySlice<T>::indexOfLast(const T& object) const {
+        if (this->_size == 0) return NO_INDEX;
+        return this->indexOfLast(object, this->_size - 1);
+    }
+
+    template <typename T>
+    size_t ArraySlice<T>::indexOfLast(const T& object, size_t max_index) const {
+        if (max_index < this->_size) {
+            for (size_t i = max_index + 1; i > 0; --i) {
+                if (this->_begin[i - 1] == object) {
+                    return i - 1;
+                }
+            }
+
+            return NO_INDEX;
+        }
+        else {
+            throw ARRAY_SLICE_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T>
+    size_t ArraySlice<T>::indexOfObjectInRange(const T& object, size_t from_index, size_t to_index) const {
+        if (from_index > to_index) {
+            throw ARRAY_SLICE_INV_FROM_TO;
+        }
+
+        if (from_index < this->_size && to_index < this->_size) {
+            for (size_t i = from_index; i < to_index; ++i) {
+                if (this->_begin[i] == object) {
+                    return i;
+                }
+            }
+
+            return NO_INDEX;
+        }
+        else {
+            throw ARRAY_SLICE_OUT_BOUNDS;
+        }
+    }
+
+
+    // Functional Operations
+    template <typename T>
+    ArrayStream<T, ArrayStreamIdentity<T>> ArraySlice<T>::stream() const {
+        return ArrayStream<T, ArrayStreamIdentity<T>>(this->_begin, this->_size, ArrayStreamIdentity<T>());
+    }
+
+    template <typename T>
+    ArrayStream<T, ArrayStreamIdentity<T>> ArraySlice<T>::parallelStream(size_t thread_count) const {
+        return this->stream().parallel(thread_count);
+    }
+
+
+    // Comparing Slice
+    template <typename T>
+    bool ArraySlice<T>::isEqualTo(const ArraySlice<T>& slice) const {
+        if (this->_size != slice._size) return false;
+
+        for (size_t i = 0; i < this->_size; ++i) {
+            if (this->_begin[i] != slice._begin[i]) return false;
+        }
+
+        return true;
+    }
+
+
+    // Slice Copy
+    template <typename T>
+    Array<T, std::vector<T>> ArraySlice<T>::copy() const {
+        Array<T, std::vector<T>> array = Array<T, std::vector<T>>();
+        array._data.assign(this->begin(), this->end());
+        return array;
+    }
+
+
+    // Getting Standard Containers
+    template <typename T>
+    std::vector<T> ArraySlice<T>::std_vector() const {
+        return std::vector<T>(this->begin(), this->end());
+    }
+
+
+    // String Representation
+    template <typename T>
+    std::string ArraySlice<T>::description() const {
+        DescriptionWriter writer;
+        writer.sequence(this->_begin, this->_size);
+        return writer.take();
+    }
+
+    template <typename T>
+    std::string ArraySlice<T>::inspect() const {
+        DescriptionWriter writer;
+
+        // Slice Address
+        writer.write("Address: ").address(this->_begin).write(' ');
+
+        // Slice Size
+        writer.write("Size: ").value(this->_size).write(' ');
+
+        // Slice Contents
+        writer.sequence(this->_begin, this->_size);
+
+        return writer.take();
+    }
+}
+
+#include "Array.hpp"
+
+#endif // MRLIB_ARRAY_SLICE_HPP
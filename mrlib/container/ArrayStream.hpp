@@ -0,0 +1,704 @@
+//
+// ArrayStream.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to add lazy functional operations to
+ * Array, similar to a Java Stream. Chained filter and map calls are fused
+ * into a single pass over the array, and the pass can be run on the
+ * calling thread or split into chunks across a set of worker threads.
+ *
+ * A stream only references the elements of the array it was created
+ * from, so the array must outlive the stream.
+ */
+
+
+#ifndef MRLIB_ARRAY_STREAM_HPP
+#define MRLIB_ARRAY_STREAM_HPP
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+
+// Empty reduction exception
+#define ARRAY_EMPTY_REDUCE std::invalid_argument("Array: Cannot reduce an empty array without an identity")
+
+// Minimum number of elements handed to a worker at once
+#ifndef ARRAY_STREAM_MIN_CHUNK
+#define ARRAY_STREAM_MIN_CHUNK 1024
+#endif
+
+namespace mrlib {
+
+    // Storage defaults to std::vector<T> in Array.hpp, which is included last
+    template <typename T, typename Storage>
+    class Array;
+
+
+    ////////////////////
+    // STREAM STAGES  //
+    ////////////////////
+
+    // Source stage, passes each array element through unchanged
+    template <typename T>
+    struct ArrayStreamIdentity {
+        typedef T OutputType;
+
+        template <typename Sink>
+        void operator()(const T& object, Sink& sink) const {
+            sink(object);
+        }
+    };
+
+    template <typename Sink, typename F>
+    struct ArrayStreamFilterSink {
+        const F& _predicate;
+        Sink&    _sink;
+
+        template <typename U>
+        void operator()(const U& object) {
+            if (this->_predicate(object)) {
+                this->_sink(object);
+            }
+        }
+    };
+
+    template <typename Previous, typename F>
+    struct ArrayStreamFilter {
+        typedef typename Previous::OutputType OutputType;
+
+        Previous _previous;
+        F        _predicate;
+
+        template <typename In, typename Sink>
+        void operator()(const In& object, Sink& sink) const {
+            ArrayStreamFilterSink<Sink, F> filter_sink = {this->_predicate, sink};
+            this->_previous(object, filter_sink);
+        }
+    };
+
+    template <typename Sink, typename F>
+    struct ArrayStreamMapSink {
+        const F& _function;
+        Sink&    _sink;
+
+        template <typename U>
+        void operator()(const U& object) {
+            this->_sink(this->_function(object));
+        }
+    };
+
+    template <typename Previous, typename F>
+    struct ArrayStreamMap {
+        typedef typename std::decay<typename std::result_of<const F(const typename Previous::OutputType&)>::type>::type OutputType;
+
+        Previous _previous;
+        F        _function;
+
+        template <typename In, typename Sink>
+        void operator()(const In& object, Sink& sink) const {
+            ArrayStreamMapSink<Sink, F> map_sink = {this->_function, sink};
+            this->_previous(object, map_sink);
+        }
+    };
+
+
+    ///////////////////////
+    // PARALLEL EXECUTOR //
+    ///////////////////////
+
+    // Per chunk result slot, avoids std::vector<bool> packing partial results
+    template <typename R>
+    struct ArrayStreamSlot {
+        R     value;
+        bool  present;
+    };
+
+    class ArrayStreamExecutor {
+    public:
+        // Number of threads used when none is requested
+        static size_t defaultThreadCount();
+
+        // Number of chunks the range [0, size) is divided into
+        static size_t chunkCount(size_t size, size_t thread_count);
+
+        // Calls task(chunk, from_index, to_index) once for every chunk. Each worker
+        // starts on its own run of chunks and steals from the others when it runs out.
+        template <typename F>
+        static void run(size_t size, size_t thread_count, const F& task);
+
+    private:
+        struct Queue {
+            std::atomic<size_t>  next;
+            size_t               end;
+            char                 _padding[64 - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+        };
+
+        template <typename F>
+        static void _work(std::vector<Queue>& queues, size_t worker, size_t size, size_t chunk_size,
+                          const F& task, std::atomic<bool>& failed, std::exception_ptr& error);
+    };
+
+
+    ////////////////////
+    // STREAM         //
+    ////////////////////
+
+    template <typename T, typename Stage>
+    class ArrayStream {
+    public:
+        typedef typename Stage::OutputType OutputType;
+        typedef Array<OutputType, std::vector<OutputType>> OutputArray;
+
+        // Internal Data
+        const T*  _begin;
+        size_t    _size;
+        Stage     _stage;
+        size_t    _thread_count;
+
+        // Constructors
+        ArrayStream(const T* begin, size_t size, const Stage& stage, size_t thread_count = 1);
+
+        // Execution Mode
+        ArrayStream<T, Stage>  sequential() const;
+        ArrayStream<T, Stage>  parallel(size_t thread_count = 0) const;
+        bool                   isParallel() const;
+
+        // Intermediate Operations
+        template <typename F>
+        ArrayStream<T, ArrayStreamFilter<Stage, F>>  filter(F predicate) const;
+        template <typename F>
+        ArrayStream<T, ArrayStreamMap<Stage, F>>     map(F function) const;
+
+        // Terminal Operations
+        template <typename F>
+        void        forEach(F function) const;
+        template <typename R, typename F>
+        R           reduce(R identity, F accumulator) const;
+        template <typename R, typename F, typename C>
+        R           reduce(R identity, F accumulator, C combiner) const;
+        template <typename F>
+        OutputType  reduce(F accumulator) const;
+        template <typename F>
+        bool        anyOf(F predicate) const;
+        template <typename F>
+        bool        allOf(F predicate) const;
+        size_t      count() const;
+
+        template <typename F>
+        std::pair<OutputArray, OutputArray>  partition(F predicate) const;
+        template <typename A, typename F>
+        std::pair<A, A>                      partitionInto(F predicate) const;
+
+        // Collecting Stream
+        OutputArray        toArray() const;
+        template <typename A>
+        A                  collect() const;
+        template <typename Storage>
+        operator Array<OutputType, Storage>() const;
+
+    private:
+        // Pushes every element of each chunk through the stage into make_sink(chunk)
+        template <typename MakeSink>
+        void _execute(const MakeSink& make_sink) const;
+
+        // Reduction without a combiner, the accumulator only merges chunks when it takes two results
+        template <typename R, typename F>
+        R     _reduce(R identity, F accumulator, std::true_type) const;
+        template <typename R, typename F>
+        R     _reduce(R identity, F accumulator, std::false_type) const;
+    };
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Parallel Executor
+    inline
+    size_t ArrayStreamExecutor::defaultThreadCount() {
+        size_t count = std::thread::hardware_concurrency();
+        return count > 0 ? count : 1;
+    }
+
+    inline
+    size_t ArrayStreamExecutor::chunkCount(size_t size, size_t thread_count) {
+        if (size == 0 || thread_count <= 1) return 1;
+
+        // Several chunks per thread gives idle workers something to steal
+        size_t chunk_size = std::max<size_t>(ARRAY_STREAM_MIN_CHUNK, (size + thread_count * 8 - 1) / (thread_count * 8));
+        return (size + chunk_size - 1) / chunk_size;
+    }
+
+//    inline - ignore on explicit template instantiation
+    template <typename F>
+    void ArrayStreamExecutor::run(size_t size, size_t thread_count, const F& task) {
+        size_t chunk_count = chunkCount(size, thread_count);
+        size_t chunk_size = chunk_count > 0 ? (size + chunk_count - 1) / chunk_count : size;
+        size_t workers = std::min(thread_count, chunk_count);
+
+        if (workers <= 1) {
+            for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+                task(chunk, std::min(size, chunk * chunk_size), std::min(size, (chunk + 1) * chunk_size));
+            }
+            return;
+        }
+
+        // Give each worker an even run of chunks to start with
+        std::vector<Queue> queues(workers);
+        size_t per_worker = (chunk_count + workers - 1) / workers;
+        for (size_t w = 0; w < workers; ++w) {
+            queues[w].next.store(std::min(chunk_count, w * per_worker));
+            queues[w].end = std::min(chunk_count, (w + 1) * per_worker);
+        }
+
+        std::atomic<bool> failed(false);
+        std::exception_ptr error;
+
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        for (size_t w = 1; w < workers; ++w) {
+            threads.push_back(std::thread([&, w]() {
+                _work(queues, w, size, chunk_size, task, failed, error);
+            }));
+        }
+
+        _work(queues, 0, size, chunk_size, task, failed, error);
+
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+//    inline - ignore on explicit template instantiation
+    template <typename F>
+    void ArrayStreamExecutor::_work(std::vector<Queue>& queues, size_t worker, size_t size, size_t chunk_size,
+                                    const F& task, std::atomic<bool>& failed, std::exception_ptr& error) {
+        size_t workers = queues.size();
+
+        // Drain own queue first, then steal from the front of the others
+        for (size_t i = 0; i < workers; ++i) {
+            Queue& queue = queues[(worker + i) % workers];
+
+            while (!failed.load(std::memory_order_relaxed)) {
+                size_t chunk = queue.next.fetch_add(1);
+                if (chunk >= queue.end) break;
+
+                try {
+                    task(chunk, std::min(size, chunk * chunk_size), std::min(size, (chunk + 1) * chunk_size));
+                }
+                catch (...) {
+                    // Only the first failure is kept
+                    if (!failed.exchange(true)) {
+                        error = std::current_exception();
+                    }
+                }
+            }
+        }
+    }
+
+
+    // Constructors
+    template <typename T, typename Stage>
+    ArrayStream<T, Stage>::ArrayStream(const T* begin, size_t size, const Stage& stage, size_t thread_count)
+        : _begin(begin), _size(size), _stage(stage), _thread_count(thread_count) {
+    }
+
+
+    // Execution Mode
+    template <typename T, typename Stage>
+    ArrayStream<T, Stage> ArrayStream<T, Stage>::sequential() const {
+        return ArrayStream<T, Stage>(this->_begin, this->_size, this->_stage, 1);
+    }
+
+    template <typename T, typename Stage>
+    ArrayStream<T, Stage> ArrayStream<T, Stage>::parallel(size_t thread_count) const {
+        if (thread_count == 0) thread_count = ArrayStreamExecutor::defaultThreadCount();
+        return ArrayStream<T, Stage>(this->_begin, this->_size, this->_stage, thread_count);
+    }
+
+    template <typename T, typename Stage>
+    bool ArrayStream<T, Stage>::isParallel() const {
+        return this->_thread_count > 1;
+    }
+
+
+    // Intermediate Operations
+    template <typename T, typename Stage>
+    template <typename F>
+    ArrayStream<T, ArrayStreamFilter<Stage, F>> ArrayStream<T, Stage>::filter(F predicate) const {
+        ArrayStreamFilter<Stage, F> stage = {this->_stage, predicate};
+        return ArrayStream<T, ArrayStreamFilter<Stage, F>>(this->_begin, this->_size, stage, this->_thread_count);
+    }
+
+    template <typename T, typename Stage>
+    template <typename F>
+    ArrayStream<T, ArrayStreamMap<Stage, F>> ArrayStream<T, Stage>::map(F function) const {
+        ArrayStreamMap<Stage, F> stage = {this->_stage, function};
+        return ArrayStream<T, ArrayStreamMap<Stage, F>>(this->_begin, this->_size, stage, this->_thread_count);
+    }
+
+
+    // Terminal Operations
+    template <typename T, typename Stage>
+    template <typename MakeSink>
+    void ArrayStream<T, Stage>::_execute(const MakeSink& make_sink) const {
+        const T* begin = this->_begin;
+        const Stage& stage = this->_stage;
+
+        ArrayStreamExecutor::run(this->_size, this->_thread_count, [&](size_t chunk, size_t from, size_t to) {
+            typename MakeSink::SinkType sink = make_sink(chunk);
+            for (size_t i = from; i < to && !sink.done(); ++i) {
+                stage(begin[i], sink);
+            }
+        });
+    }
+
+    template <typename F>
+    struct ArrayStreamForEachSink {
+        const F& _function;
+
+        template <typename U>
+        void operator()(const U& object) { this->_function(object); }
+        bool done() const { return false; }
+    };
+
+    template <typename F>
+    struct ArrayStreamForEachFactory {
+        typedef ArrayStreamForEachSink<F> SinkType;
+        const F& _function;
+
+        SinkType operator()(size_t) const { SinkType sink = {this->_function}; return sink; }
+    };
+
+    template <typename T, typename Stage>
+    template <typename F>
+    void ArrayStream<T, Stage>::forEach(F function) const {
+        ArrayStreamForEachFactory<F> factory = {function};
+        this->_execute(factory);
+    }
+
+    template <typename R, typename F>
+    struct ArrayStreamReduceSink {
+        const F&            _accumulator;
+        ArrayStreamSlot<R>& _slot;
+
+        template <typename U>
+        void operator()(const U& object) {
+            this->_slot.value = this->_accumulator(this->_slot.value, object);
+        }
+        bool done() const { return false; }
+    };
+
+    // Reduction without an identity, the first element of each chunk seeds its slot
+    template <typename R, typename F>
+    struct ArrayStreamFoldSink {
+        const F&            _accumulator;
+        ArrayStreamSlot<R>& _slot;
+
+        void operator()(const R& object) {
+            if (this->_slot.present) {
+                this->_slot.value = this->_accumulator(this->_slot.value, object);
+            }
+            else {
+                this->_slot.value = object;
+                this->_slot.present = true;
+            }
+        }
+        bool done() const { return false; }
+    };
+
+    template <typename Sink, typename R, typename F>
+    struct ArrayStreamReduceFactory {
+        typedef Sink SinkType;
+        const F&                          _accumulator;
+        std::vector<ArrayStreamSlot<R>>&  _slots;
+
+        SinkType operator()(size_t chunk) const { SinkType sink = {this->_accumulator, this->_slots[chunk]}; return sink; }
+    };
+
+    // Stands in for the combiner of a reduction that runs as a single chunk, where it is never called
+    struct ArrayStreamNoCombiner {
+        template <typename R>
+        R operator()(const R& a, const R&) const { return a; }
+    };
+
+    template <typename T, typename Stage>
+    template <typename R, typename F>
+    R ArrayStream<T, Stage>::reduce(R identity, F accumulator) const {
+        return this->_reduce(identity, accumulator, std::is_same<typename std::decay<R>::type, typename std::decay<OutputType>::type>());
+    }
+
+    template <typename T, typename Stage>
+    template <typename R, typename F>
+    R ArrayStream<T, Stage>::_reduce(R identity, F accumulator, std::true_type) const {
+        return this->reduce(identity, accumulator, accumulator);
+    }
+
+    template <typename T, typename Stage>
+    template <typename R, typename F>
+    R ArrayStream<T, Stage>::_reduce(R identity, F accumulator, std::false_type) const {
+        // The accumulator cannot merge two results of another type, so the fold stays on one thread
+        return this->sequential().reduce(identity, accumulator, ArrayStreamNoCombiner());
+    }
+
+    template <typename T, typename Stage>
+    template <typename R, typename F, typename C>
+    R ArrayStream<T, Stage>::reduce(R identity, F accumulator, C combiner) const {
+        size_t chunk_count = ArrayStreamExecutor::chunkCount(this->_size, this->_thread_count);
+
+        // Every chunk is seeded with the identity, so it must not change the result when combined
+        ArrayStreamSlot<R> seed = {identity, true};
+        std::vector<ArrayStreamSlot<R>> slots(chunk_count, seed);
+        ArrayStreamReduceFactory<ArrayStreamReduceSink<R, F>, R, F> factory = {accumulator, slots};
+        this->_execute(factory);
+
+        R result = slots[0].value;
+        for (size_t i = 1; i < chunk_count; ++i) {
+            result = combiner(result, slots[i].value);
+        }
+
+        return result;
+    }
+
+    template <typename T, typename Stage>
+    template <typename F>
+    typename ArrayStream<T, Stage>::OutputType ArrayStream<T, Stage>::reduce(F accumulator) const {
+        size_t chunk_count = ArrayStreamExecutor::chunkCount(this->_size, this->_thread_count);
+
+        ArrayStreamSlot<OutputType> empty = {OutputType(), false};
+        std::vector<ArrayStreamSlot<OutputType>> slots(chunk_count, empty);
+        ArrayStreamReduceFactory<ArrayStreamFoldSink<OutputType, F>, OutputType, F> factory = {accumulator, slots};
+        this->_execute(factory);
+
+        ArrayStreamSlot<OutputType> result = empty;
+        for (size_t i = 0; i < chunk_count; ++i) {
+            if (!slots[i].present) continue;
+
+            if (result.present) {
+                result.value = accumulator(result.value, slots[i].value);
+            }
+            else {
+                result = slots[i];
+            }
+        }
+
+        if (!result.present) {
+            throw ARRAY_EMPTY_REDUCE;
+        }
+
+        return result.value;
+    }
+
+    template <typename F>
+    struct ArrayStreamMatchSink {
+        const F&            _predicate;
+        bool                _expect;
+        std::atomic<bool>&  _found;
+
+        template <typename U>
+        void operator()(const U& object) {
+            if (bool(this->_predicate(object)) == this->_expect) {
+                this->_found.store(true, std::memory_order_relaxed);
+            }
+        }
+        bool done() const { return this->_found.load(std::memory_order_relaxed); }
+    };
+
+    template <typename F>
+    struct ArrayStreamMatchFactory {
+        typedef ArrayStreamMatchSink<F> SinkType;
+        const F&            _predicate;
+        bool                _expect;
+        std::atomic<bool>&  _found;
+
+        SinkType operator()(size_t) const { SinkType sink = {this->_predicate, this->_expect, this->_found}; return sink; }
+    };
+
+    template <typename T, typename Stage>
+    template <typename F>
+    bool ArrayStream<T, Stage>::anyOf(F predicate) const {
+        std::atomic<bool> found(false);
+        ArrayStreamMatchFactory<F> factory = {predicate, true, found};
+        this->_execute(factory);
+        return found.load();
+    }
+
+    template <typename T, typename Stage>
+    template <typename F>
+    bool ArrayStream<T, Stage>::allOf(F predicate) const {
+        std::atomic<bool> found(false);
+        ArrayStreamMatchFactory<F> factory = {predicate, false, found};
+        this->_execute(factory);
+        return !found.load();
+    }
+
+    struct ArrayStreamCountSink {
+        size_t& _count;
+
+        template <typename U>
+        void operator()(const U&) { ++this->_count; }
+        bool done() const { return false; }
+    };
+
+    struct ArrayStreamCountFactory {
+        typedef ArrayStreamCountSink SinkType;
+        std::vector<ArrayStreamSlot<size_t>>& _slots;
+
+        SinkType operator()(size_t chunk) const { SinkType sink = {this->_slots[chunk].value}; return sink; }
+    };
+
+    template <typename T, typename Stage>
+    size_t ArrayStream<T, Stage>::count() const {
+        size_t chunk_count = ArrayStreamExecutor::chunkCount(this->_size, this->_thread_count);
+
+        ArrayStreamSlot<size_t> zero = {0, true};
+        std::vector<ArrayStreamSlot<size_t>> slots(chunk_count, zero);
+        ArrayStreamCountFactory factory = {slots};
+        this->_execute(factory);
+
+        size_t total = 0;
+        for (size_t i = 0; i < chunk_count; ++i) {
+            total += slots[i].value;
+        }
+
+        return total;
+    }
+
+    template <typename U, typename F>
+    struct ArrayStreamPartitionSink {
+        const F&         _predicate;
+        std::vector<U>&  _matched;
+        std::vector<U>&  _unmatched;
+
+        void operator()(const U& object) {
+            if (this->_predicate(object)) {
+                this->_matched.push_back(object);
+            }
+            else {
+                this->_unmatched.push_back(object);
+            }
+        }
+        bool done() const { return false; }
+    };
+
+    template <typename U, typename F>
+    struct ArrayStreamPartitionFactory {
+        typedef ArrayStreamPartitionSink<U, F> SinkType;
+        const F&                      _predicate;
+        std::vector<std::vector<U>>&  _matched;
+        std::vector<std::vector<U>>&  _unmatched;
+
+        SinkType operator()(size_t chunk) const {
+            SinkType sink = {this->_predicate, this->_matched[chunk], this->_unmatched[chunk]};
+            return sink;
+        }
+    };
+
+    // Concatenates per chunk output in chunk order
+    template <typename U, typename Output>
+    void ArrayStreamJoin(std::vector<std::vector<U>>& parts, Output& output) {
+        size_t total = 0;
+        for (const std::vector<U>& part : parts) {
+            total += part.size();
+        }
+
+        output.reserve(output.size() + total);
+        for (std::vector<U>& part : parts) {
+            output.insert(output.end(), std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+        }
+    }
+
+    template <typename U>
+    void ArrayStreamJoin(std::vector<std::vector<U>>& parts, std::vector<U>& output) {
+        if (parts.size() == 1 && output.empty()) {
+            output.swap(parts[0]);
+            return;
+        }
+
+        ArrayStreamJoin<U, std::vector<U>>(parts, output);
+    }
+
+    template <typename T, typename Stage>
+    template <typename F>
+    std::pair<typename ArrayStream<T, Stage>::OutputArray, typename ArrayStream<T, Stage>::OutputArray>
+    ArrayStream<T, Stage>::partition(F predicate) const {
+        return this->template partitionInto<OutputArray>(predicate);
+    }
+
+    template <typename T, typename Stage>
+    template <typename A, typename F>
+    std::pair<A, A> ArrayStream<T, Stage>::partitionInto(F predicate) const {
+        size_t chunk_count = ArrayStreamExecutor::chunkCount(this->_size, this->_thread_count);
+
+        std::vector<std::vector<OutputType>> matched(chunk_count);
+        std::vector<std::vector<OutputType>> unmatched(chunk_count);
+        ArrayStreamPartitionFactory<OutputType, F> factory = {predicate, matched, unmatched};
+        this->_execute(factory);
+
+        std::pair<A, A> result;
+        ArrayStreamJoin(matched, result.first._data);
+        ArrayStreamJoin(unmatched, result.second._data);
+        return result;
+    }
+
+    template <typename U>
+    struct ArrayStreamCollectSink {
+        std::vector<U>& _output;
+
+        void operator()(const U& object) { this->_output.push_back(object); }
+        bool done() const { return false; }
+    };
+
+    template <typename U>
+    struct ArrayStreamCollectFactory {
+        typedef ArrayStreamCollectSink<U> SinkType;
+        std::vector<std::vector<U>>& _parts;
+
+        SinkType operator()(size_t chunk) const { SinkType sink = {this->_parts[chunk]}; return sink; }
+    };
+
+
+    // Collecting Stream
+    template <typename T, typename Stage>
+    typename ArrayStream<T, Stage>::OutputArray ArrayStream<T, Stage>::toArray() const {
+        return this->template collect<OutputArray>();
+    }
+
+    template <typename T, typename Stage>
+    template <typename A>
+    A ArrayStream<T, Stage>::collect() const {
+        size_t chunk_count = ArrayStreamExecutor::chunkCount(this->_size, this->_thread_count);
+
+        std::vector<std::vector<OutputType>> parts(chunk_count);
+        ArrayStreamCollectFactory<OutputType> factory = {parts};
+        this->_execute(factory);
+
+        A result = A();
+        ArrayStreamJoin(parts, result._data);
+        return result;
+    }
+
+    template <typename T, typename Stage>
+    template <typename Storage>
+    ArrayStream<T, Stage>::operator Array<typename ArrayStream<T, Stage>::OutputType, Storage>() const {
+        return this->template collect<Array<OutputType, Storage>>();
+    }
+}
+
+#include "Array.hpp"
+
+#endif // MRLIB_ARRAY_STREAM_HPP
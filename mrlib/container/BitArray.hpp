@@ -0,0 +1,721 @@
+//
+// BitArray.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to have an array of bits that works on
+ * whole words at a time. Bits are packed 64 to a word, so the bitwise
+ * operators, counting and searching handle 64 bits per step. Counting uses
+ * the hardware population count instruction when it is enabled (-mpopcnt
+ * or a -march that has it), and a branch free bit count otherwise.
+ *
+ * Rank and select give the number of set bits before an index and the
+ * index of the nth set bit. On their own they scan the words, so they are
+ * O(n). buildRankIndex() keeps the set bit counts of every
+ * BIT_ARRAY_SUPERBLOCK_WORDS words in a Fenwick tree, after which rank
+ * adds O(log n) counts and at most that many words, and select walks down
+ * the tree before searching the words. The index is kept up to date from
+ * then on: changing, adding or popping one bit adjusts the O(log n) counts
+ * above it, and the operations that touch every word rebuild it.
+ *
+ * Bits past the end of the last word are always kept clear, so whole words
+ * can be compared and counted without masking.
+ */
+
+
+#ifndef MRLIB_BIT_ARRAY_HPP
+#define MRLIB_BIT_ARRAY_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <stdexcept>
+#include <initializer_list>
+
+#include "Array.hpp"
+#include "DescriptionWriter.hpp"
+
+// Index Constants
+#ifndef NO_INDEX
+#define NO_INDEX -1ull
+#endif
+
+// Word Constants
+#define BIT_ARRAY_WORD_BITS 64
+#define BIT_ARRAY_SUPERBLOCK_WORDS 8
+
+// Bit array exceptions
+#define BIT_ARRAY_OUT_BOUNDS std::invalid_argument("BitArray: Out of bounds exception")
+#define BIT_ARRAY_SIZE_MISMATCH std::invalid_argument("BitArray: Arrays must be the same size")
+
+namespace mrlib {
+
+    class BitArray {
+    public:
+        // Internal Data
+        std::vector<uint64_t>  _words;
+        size_t                 _size;
+        std::vector<size_t>    _ranks;  // Fenwick tree of superblock counts from 1, empty when there is no index
+
+        // Constructors
+        BitArray();
+        BitArray(size_t size, bool value = false);
+        BitArray(std::initializer_list<bool> i_list);
+        BitArray(const Array<bool>& array);
+
+        // Operator Overloading
+        bool       operator[](const size_t index) const;
+        bool       operator==(const BitArray& array) const;
+        bool       operator!=(const BitArray& array) const;
+        BitArray   operator&(const BitArray& array) const;
+        BitArray   operator|(const BitArray& array) const;
+        BitArray   operator^(const BitArray& array) const;
+        BitArray   operator~() const;
+        BitArray&  operator&=(const BitArray& array);
+        BitArray&  operator|=(const BitArray& array);
+        BitArray&  operator^=(const BitArray& array);
+
+        // Querying Array
+        bool    objectAtIndex(size_t index) const;
+        size_t  size() const;
+        bool    isEmpty() const;
+        size_t  count() const;
+        bool    any() const;
+        bool    none() const;
+        bool    all() const;
+
+        // Modifying Bits
+        BitArray&  set(size_t index, bool value = true);
+        BitArray&  reset(size_t index);
+        BitArray&  flip(size_t index);
+        BitArray&  setAll(bool value = true);
+        BitArray&  flipAll();
+
+        // Adding and Removing Bits
+        BitArray&  add(bool value);
+        bool       pop();
+        BitArray&  resize(size_t size, bool value = false);
+        BitArray&  removeAll();
+
+        // Finding Bits
+        size_t  findFirst() const;
+        size_t  findNext(size_t index) const;
+        size_t  findLast() const;
+        size_t  rank(size_t index) const;
+        size_t  select(size_t nth) const;
+
+        // Rank Index
+        BitArray&  buildRankIndex();
+        bool       hasRankIndex() const;
+
+        // Iterating Bits
+        template <typename F>
+        void  forEachSetBit(F function) const;
+
+        // Getting Containers
+        Array<bool>        toArray() const;
+        std::vector<bool>  std_vector() const;
+
+        // String Representation
+        std::string  description() const;
+
+    private:
+        static size_t    _wordCount(size_t size);
+        static size_t    _popcount(uint64_t word);
+        static size_t    _lowestBit(uint64_t word);
+        static size_t    _highestBit(uint64_t word);
+        static size_t    _selectInWord(uint64_t word, size_t nth);
+        size_t           _rankBefore(size_t superblock) const;
+        void             _rankAdd(size_t word, size_t delta);
+        void             _rankReindex();
+        void             _clearTail();
+        void             _checkSize(const BitArray& array) const;
+    };
+
+
+    ////////////////////
+    // IMPLEMENTATION //
+    ////////////////////
+
+    // Constructors
+    inline
+    BitArray::BitArray() {
+        this->_words = std::vector<uint64_t>();
+        this->_size = 0;
+    }
+
+    inline
+    BitArray::BitArray(size_t size, bool value) {
+        this->_words = std::vector<uint64_t>(_wordCount(size), value ? ~uint64_t(0) : 0);
+        this->_size = size;
+        this->_clearTail();
+    }
+
+    inline
+    BitArray::BitArray(std::initializer_list<bool> i_list) : BitArray(i_list.size()) {
+        size_t index = 0;
+        for (bool value : i_list) {
+            if (value) this->set(index);
+            ++index;
+        }
+    }
+
+    inline
+    BitArray::BitArray(const Array<bool>& array) : BitArray(array.size()) {
+        for (size_t i = 0; i < array.size(); ++i) {
+            if (array._data[i]) this->set(i);
+        }
+    }
+
+
+    // Operator Overloading
+    inline
+    bool BitArray::operator[](const size_t index) const {
+        if (index < this->_size) {
+            return (this->_words[index / BIT_ARRAY_WORD_BITS] >> (index % BIT_ARRAY_WORD_BITS)) & 1;
+        }
+        else {
+            throw BIT_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    inline
+    bool BitArray::operator==(const BitArray& array) const {
+        return this->_size == array._size && this->_words == array._words;
+    }
+
+    inline
+    bool BitArray::operator!=(const BitArray& array) const {
+        return !(*this == array);
+    }
+
+    inline
+    BitArray BitArray::operator&(const BitArray& array) const {
+        BitArray result = *this;
+        result &= array;
+        return result;
+    }
+
+    inline
+    BitArray BitArray::operator|(const BitArray& array) const {
+        BitArray result = *this;
+        result |= array;
+        return result;
+    }
+
+    inline
+    BitArray BitArray::operator^(const BitArray& array) const {
+        BitArray result = *this;
+        result ^= array;
+        return result;
+    }
+
+    inline
+    BitArray BitArray::operator~() const {
+        BitArray result = *this;
+        result.flipAll();
+        return result;
+    }
+
+    inline
+    BitArray& BitArray::operator&=(const BitArray& array) {
+        this->_checkSize(array);
+        for (size_t i = 0; i < this->_words.size(); ++i) {
+            this->_words[i] &= array._words[i];
+        }
+
+        this->_rankReindex();
+        return *this;
+    }
+
+    inline
+    BitArray& BitArray::operator|=(const BitArray& array) {
+        this->_checkSize(array);
+        for (size_t i = 0; i < this->_words.size(); ++i) {
+            this->_words[i] |= array._words[i];
+        }
+
+        this->_rankReindex();
+        return *this;
+    }
+
+    inline
+    BitArray& BitArray::operator^=(const BitArray& array) {
+        this->_checkSize(array);
+        for (size_t i = 0; i < this->_words.size(); ++i) {
+            this->_words[i] ^= array._words[i];
+        }
+
+        this->_rankReindex();
+        return *this;
+    }
+
+
+    // Querying Array
+    inline
+    bool BitArray::objectAtIndex(size_t index) const {
+        return (*this)[index];
+    }
+
+    inline
+    size_t BitArray::size() const {
+        return this->_size;
+    }
+
+    inline
+    bool BitArray::isEmpty() const {
+        return this->_size == 0;
+    }
+
+    inline
+    size_t BitArray::count() const {
+        size_t count = 0;
+        for (uint64_t word : this->_words) {
+            count += _popcount(word);
+        }
+
+        return count;
+    }
+
+    inline
+    bool BitArray::any() const {
+        for (uint64_t word : this->_words) {
+            if (word != 0) return true;
+        }
+
+        return false;
+    }
+
+    inline
+    bool BitArray::none() const {
+        return !this->any();
+    }
+
+    inline
+    bool BitArray::all() const {
+        return this->count() == this->_size;
+    }
+
+
+    // Modifying Bits
+    inline
+    BitArray& BitArray::set(size_t index, bool value) {
+        if (index < this->_size) {
+            uint64_t mask = uint64_t(1) << (index % BIT_ARRAY_WORD_BITS);
+            uint64_t& word = this->_words[index / BIT_ARRAY_WORD_BITS];
+            if (((word & mask) != 0) != value) {
+                word ^= mask;
+                this->_rankAdd(index / BIT_ARRAY_WORD_BITS, value ? 1 : size_t(-1));
+            }
+
+            return *this;
+        }
+        else {
+            throw BIT_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    inline
+    BitArray& BitArray::reset(size_t index) {
+        return this->set(index, false);
+    }
+
+    inline
+    BitArray& BitArray::flip(size_t index) {
+        if (index < this->_size) {
+            uint64_t mask = uint64_t(1) << (index % BIT_ARRAY_WORD_BITS);
+            uint64_t& word = this->_words[index / BIT_ARRAY_WORD_BITS];
+            word ^= mask;
+            this->_rankAdd(index / BIT_ARRAY_WORD_BITS, (word & mask) != 0 ? 1 : size_t(-1));
+            return *this;
+        }
+        else {
+            throw BIT_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    inline
+    BitArray& BitArray::setAll(bool value) {
+        for (uint64_t& word : this->_words) {
+            word = value ? ~uint64_t(0) : 0;
+        }
+
+        this->_clearTail();
+        this->_rankReindex();
+        return *this;
+    }
+
+    inline
+    BitArray& BitArray::flipAll() {
+        for (uint64_t& word : this->_words) {
+            word = ~word;
+        }
+
+        this->_clearTail();
+        this->_rankReindex();
+        return *this;
+    }
+
+
+    // Adding and Removing Bits
+    inline
+    BitArray& BitArray::add(bool value) {
+        if (this->_size % BIT_ARRAY_WORD_BITS == 0) {
+            this->_words.push_back(0);
+
+            // A new, empty superblock gets the node a full build would give it: the counts of the ones it covers before itself
+            size_t node = this->_ranks.size();
+            if (node != 0 && (this->_words.size() - 1) % BIT_ARRAY_SUPERBLOCK_WORDS == 0) {
+                this->_ranks.push_back(this->_rankBefore(node - 1) - this->_rankBefore(node - (node & (~node + 1))));
+            }
+        }
+
+        ++this->_size;
+        if (value) this->set(this->_size - 1);
+        return *this;
+    }
+
+    inline
+    bool BitArray::pop() {
+        if (this->_size > 0) {
+            bool value = (*this)[this->_size - 1];
+            this->reset(this->_size - 1);
+            --this->_size;
+
+            // The last superblock node only ever covers counts up to its own superblock, so it can be dropped alone
+            if (this->_size % BIT_ARRAY_WORD_BITS == 0) {
+                this->_words.pop_back();
+                if (!this->_ranks.empty() && this->_words.size() % BIT_ARRAY_SUPERBLOCK_WORDS == 0) {
+                    this->_ranks.pop_back();
+                }
+            }
+
+            return value;
+        }
+        else {
+            throw BIT_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    inline
+    BitArray& BitArray::resize(size_t size, bool value) {
+        // Set bit by bit, the index is rebuilt once at the end instead
+        bool indexed = !this->_ranks.empty();
+        this->_ranks.clear();
+        size_t old_size = this->_size;
+        this->_words.resize(_wordCount(size), 0);
+        this->_size = size;
+
+        if (value && size > old_size) {
+            // Fill the rest of the old last word, then whole words
+            for (size_t i = old_size; i < size && i % BIT_ARRAY_WORD_BITS != 0; ++i) {
+                this->set(i);
+            }
+
+            for (size_t w = _wordCount(old_size); w < this->_words.size(); ++w) {
+                this->_words[w] = ~uint64_t(0);
+            }
+        }
+
+        this->_clearTail();
+        if (indexed) this->buildRankIndex();
+        return *this;
+    }
+
+    inline
+    BitArray& BitArray::removeAll() {
+        this->_words.clear();
+        this->_size = 0;
+        this->_rankReindex();
+        return *this;
+    }
+
+
+    // Finding Bits
+    inline
+    size_t BitArray::findFirst() const {
+        for (size_t w = 0; w < this->_words.size(); ++w) {
+            if (this->_words[w] != 0) {
+                return w * BIT_ARRAY_WORD_BITS + _lowestBit(this->_words[w]);
+            }
+        }
+
+        return NO_INDEX;
+    }
+
+    inline
+    size_t BitArray::findNext(size_t index) const {
+        size_t start = index + 1;
+        if (index == NO_INDEX || start >= this->_size) {
+            return NO_INDEX;
+        }
+
+        // Mask off the bits at or before index in the first word
+        size_t w = start / BIT_ARRAY_WORD_BITS;
+        uint64_t word = this->_words[w] & (~uint64_t(0) << (start % BIT_ARRAY_WORD_BITS));
+
+        while (true) {
+            if (word != 0) {
+                return w * BIT_ARRAY_WORD_BITS + _lowestBit(word);
+            }
+
+            if (++w >= this->_words.size()) {
+                return NO_INDEX;
+            }
+
+            word = this->_words[w];
+        }
+    }
+
+    inline
+    size_t BitArray::findLast() const {
+        for (size_t w = this->_words.size(); w > 0; --w) {
+            if (this->_words[w - 1] != 0) {
+                return (w - 1) * BIT_ARRAY_WORD_BITS + _highestBit(this->_words[w - 1]);
+            }
+        }
+
+        return NO_INDEX;
+    }
+
+    inline
+    size_t BitArray::rank(size_t index) const {
+        if (index > this->_size) {
+            throw BIT_ARRAY_OUT_BOUNDS;
+        }
+
+        // Start from the count before the superblock when there is an index
+        size_t full = index / BIT_ARRAY_WORD_BITS;
+        size_t w = 0;
+        size_t count = 0;
+        if (!this->_ranks.empty()) {
+            w = full / BIT_ARRAY_SUPERBLOCK_WORDS * BIT_ARRAY_SUPERBLOCK_WORDS;
+            count = this->_rankBefore(full / BIT_ARRAY_SUPERBLOCK_WORDS);
+        }
+
+        for (; w < full; ++w) {
+            count += _popcount(this->_words[w]);
+        }
+
+        size_t remainder = index % BIT_ARRAY_WORD_BITS;
+        if (remainder != 0) {
+            count += _popcount(this->_words[full] & ((uint64_t(1) << remainder) - 1));
+        }
+
+        return count;
+    }
+
+    inline
+    size_t BitArray::select(size_t nth) const {
+        // Walk down the tree to the last superblock with at most nth set bits before it
+        size_t w = 0;
+        if (!this->_ranks.empty()) {
+            size_t superblock = 0;
+            size_t step = 1;
+            while (step * 2 < this->_ranks.size()) {
+                step *= 2;
+            }
+
+            for (; step > 0; step /= 2) {
+                if (superblock + step < this->_ranks.size() && this->_ranks[superblock + step] <= nth) {
+                    superblock += step;
+                    nth -= this->_ranks[superblock];
+                }
+            }
+
+            w = superblock * BIT_ARRAY_SUPERBLOCK_WORDS;
+        }
+
+        // Skip whole words by their population count, then search inside the word
+        for (; w < this->_words.size(); ++w) {
+            size_t count = _popcount(this->_words[w]);
+            if (nth < count) {
+                return w * BIT_ARRAY_WORD_BITS + _selectInWord(this->_words[w], nth);
+            }
+
+            nth -= count;
+        }
+
+        return NO_INDEX;
+    }
+
+
+    // Rank Index
+    inline
+    BitArray& BitArray::buildRankIndex() {
+        // Count each superblock, then add every node into the next node that covers it
+        size_t superblocks = (this->_words.size() + BIT_ARRAY_SUPERBLOCK_WORDS - 1) / BIT_ARRAY_SUPERBLOCK_WORDS;
+        this->_ranks = std::vector<size_t>(superblocks + 1, 0);
+        for (size_t w = 0; w < this->_words.size(); ++w) {
+            this->_ranks[w / BIT_ARRAY_SUPERBLOCK_WORDS + 1] += _popcount(this->_words[w]);
+        }
+
+        for (size_t node = 1; node <= superblocks; ++node) {
+            size_t parent = node + (node & (~node + 1));
+            if (parent <= superblocks) {
+                this->_ranks[parent] += this->_ranks[node];
+            }
+        }
+
+        return *this;
+    }
+
+    inline
+    bool BitArray::hasRankIndex() const {
+        return !this->_ranks.empty();
+    }
+
+
+    // Getting Containers
+    inline
+    Array<bool> BitArray::toArray() const {
+        Array<bool> array = Array<bool>();
+        array._data = this->std_vector();
+        return array;
+    }
+
+    inline
+    std::vector<bool> BitArray::std_vector() const {
+        std::vector<bool> vector = std::vector<bool>(this->_size);
+        this->forEachSetBit([&vector](size_t index) {
+            vector[index] = true;
+        });
+
+        return vector;
+    }
+
+
+    // String Representation
+    inline
+    std::string BitArray::description() const {
+        DescriptionWriter writer;
+        writer.write('[');
+
+        for (size_t i = 0; i < this->_size; ++i) {
+            if (i != 0) {
+                writer.write(", ", 2);
+            }
+
+            writer.write((*this)[i] ? '1' : '0');
+        }
+
+        writer.write(']');
+        return writer.take();
+    }
+
+
+    // Internal Functions
+    inline
+    size_t BitArray::_wordCount(size_t size) {
+        return (size + BIT_ARRAY_WORD_BITS - 1) / BIT_ARRAY_WORD_BITS;
+    }
+
+    inline
+    size_t BitArray::_popcount(uint64_t word) {
+#if defined(__POPCNT__)
+        return size_t(__builtin_popcountll(word));
+#else
+        // Without the instruction GCC calls a library function, so count in parallel bit fields
+        word = word - ((word >> 1) & 0x5555555555555555ull);
+        word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        return size_t((word * 0x0101010101010101ull) >> 56);
+#endif
+    }
+
+    inline
+    size_t BitArray::_lowestBit(uint64_t word) {
+        return size_t(__builtin_ctzll(word));
+    }
+
+    inline
+    size_t BitArray::_highestBit(uint64_t word) {
+        return size_t(63 - __builtin_clzll(word));
+    }
+
+    inline
+    size_t BitArray::_selectInWord(uint64_t word, size_t nth) {
+        // Skip whole bytes by their population count, then clear the lowest bits left
+        size_t shift = 0;
+        while (true) {
+            size_t count = _popcount(word & 0xFF);
+            if (nth < count) break;
+
+            nth -= count;
+            word >>= 8;
+            shift += 8;
+        }
+
+        for (size_t i = 0; i < nth; ++i) {
+            word &= word - 1;
+        }
+
+        return shift + _lowestBit(word);
+    }
+
+    inline
+    size_t BitArray::_rankBefore(size_t superblock) const {
+        // Node i holds the count of the (i & -i) superblocks that end with superblock i, so clearing the
+        // lowest set bit of i steps to the node for the superblocks before those
+        size_t count = 0;
+        for (size_t node = superblock; node > 0; node &= node - 1) {
+            count += this->_ranks[node];
+        }
+
+        return count;
+    }
+
+    inline
+    void BitArray::_rankAdd(size_t word, size_t delta) {
+        // Every node that covers the superblock, a negative delta wraps around like any unsigned sum
+        for (size_t node = word / BIT_ARRAY_SUPERBLOCK_WORDS + 1; node < this->_ranks.size(); node += node & (~node + 1)) {
+            this->_ranks[node] += delta;
+        }
+    }
+
+    inline
+    void BitArray::_rankReindex() {
+        if (!this->_ranks.empty()) {
+            this->buildRankIndex();
+        }
+    }
+
+    inline
+    void BitArray::_clearTail() {
+        size_t remainder = this->_size % BIT_ARRAY_WORD_BITS;
+        if (remainder != 0) {
+            this->_words.back() &= (uint64_t(1) << remainder) - 1;
+        }
+    }
+
+    inline
+    void BitArray::_checkSize(const BitArray& array) const {
+        if (this->_size != array._size) {
+            throw BIT_ARRAY_SIZE_MISMATCH;
+        }
+    }
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Iterating Bits
+    template <typename F>
+    void BitArray::forEachSetBit(F function) const {
+        for (size_t w = 0; w < this->_words.size(); ++w) {
+            uint64_t word = this->_words[w];
+
+            // Clear the lowest set bit each step, so only set bits are visited
+            while (word != 0) {
+                function(w * BIT_ARRAY_WORD_BITS + _lowestBit(word));
+                word &= word - 1;
+            }
+        }
+    }
+}
+
+#endif // MRLIB_BIT_ARRAY_HPP
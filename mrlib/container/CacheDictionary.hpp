@@ -0,0 +1,550 @@
+//
+// CacheDictionary.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to cache computed results in a dictionary
+ * with a bounded size. Entries are found through a HashMap that points
+ * into the recency lists, so a hit is one hash lookup and one list splice.
+ * The capacity is a number of entries by default, or any cost such as a
+ * size in bytes when a cost function is set.
+ *
+ * The policy decides what is evicted when the cache is full. LRU evicts
+ * the least recently used entry. SEGMENTED_LRU keeps entries that were hit
+ * again in a protected segment, so one pass over many new keys can only
+ * evict entries that were used once. TINY_LFU also estimates how often
+ * every key is used with a small count-min sketch, and only admits a new
+ * key if it is used more often than the entry it would evict.
+ *
+ * Entries can expire after a time to live. Expired entries are removed
+ * when they are next looked up, or all at once by removeExpired().
+ */
+
+
+#ifndef MRLIB_CACHE_DICTIONARY_HPP
+#define MRLIB_CACHE_DICTIONARY_HPP
+
+#include <list>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <functional>
+
+#include "HashDictionary.hpp"
+#include "DescriptionWriter.hpp"
+
+// Cache Constants
+#define CACHE_PROTECTED_PERCENT 80
+#define CACHE_SKETCH_MIN_WIDTH 64
+#define CACHE_SKETCH_MAX_WIDTH (1 << 16)
+#define CACHE_SKETCH_MAX_COUNT 15
+
+// Key exceptions
+#define CACHE_MISSING_KEY std::invalid_argument("CacheDictionary: Key does not exist in cache")
+
+namespace mrlib {
+
+    enum class CachePolicy {
+        LRU,
+        SEGMENTED_LRU,
+        TINY_LFU
+    };
+
+
+    struct CacheStatistics {
+        size_t  hits;
+        size_t  misses;
+        size_t  evictions;
+        size_t  expirations;
+        size_t  rejections;
+
+        CacheStatistics() : hits(0), misses(0), evictions(0), expirations(0), rejections(0) {}
+        double  hitRate() const { return hits + misses == 0 ? 0.0 : double(hits) / double(hits + misses); }
+    };
+
+
+    // Count-min sketch of small saturating counters that are halved as they age
+    class CacheSketch {
+    public:
+        // Internal Data
+        std::vector<uint8_t>  _counters;
+        size_t                _width;   // A power of two, each of the four rows has this many counters
+        size_t                _additions;
+
+        // Constructors
+        CacheSketch(size_t width = CACHE_SKETCH_MIN_WIDTH);
+
+        // Counting
+        void    increment(size_t hash);
+        size_t  estimate(size_t hash) const;
+
+    private:
+        size_t  _index(size_t hash, size_t row) const;
+        void    _age();
+    };
+
+
+    template <typename K, typename V, typename TimePoint>
+    struct CacheEntry {
+        K          key;
+        V          value;
+        size_t     cost;
+        TimePoint  expiry;
+        bool       is_protected;
+    };
+
+
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>, typename Clock = std::chrono::steady_clock>
+    class CacheDictionary {
+    public:
+        typedef typename Clock::duration                      duration;
+        typedef typename Clock::time_point                    time_point;
+        typedef CacheEntry<K, V, time_point>                  Entry;
+        typedef typename std::list<Entry>::iterator           EntryIterator;
+        typedef std::function<size_t(const K&, const V&)>     CostFunction;
+
+        // Internal Data
+        HashMap<K, EntryIterator, Hash, KeyEqual>  _index;
+        std::list<Entry>                           _probation;   // Every entry under LRU, entries used once otherwise
+        std::list<Entry>                           _protected;   // Entries used more than once
+        CacheSketch                                _sketch;
+        CachePolicy                                _policy;
+        size_t                                     _capacity;
+        size_t                                     _cost;
+        size_t                                     _protected_cost;
+        duration                                   _time_to_live;   // Zero never expires
+        CostFunction                               _cost_function;
+        CacheStatistics                            _statistics;
+        Hash                                       _hash;
+
+        // Constructors
+        CacheDictionary(size_t capacity, CachePolicy policy = CachePolicy::LRU);
+        CacheDictionary(const CacheDictionary&) = delete;
+
+        // Operator Overloading
+        CacheDictionary&  operator=(const CacheDictionary&) = delete;
+
+        // Configuring Cache
+        CacheDictionary&  setCostFunction(CostFunction function);
+        CacheDictionary&  setTimeToLive(duration time_to_live);
+
+        // Querying Cache
+        const V*                tryGet(const K& key);
+        V                       objectForKey(const K& key);
+        bool                    containsKey(const K& key) const;
+        size_t                  size() const;
+        bool                    isEmpty() const;
+        size_t                  cost() const;
+        size_t                  capacity() const;
+        const CacheStatistics&  statistics() const;
+        CacheDictionary&        resetStatistics();
+
+        // Adding Objects
+        CacheDictionary&  insertOrAssign(const K& key, const V& value);
+        CacheDictionary&  insertOrAssign(const K& key, const V& value, duration time_to_live);
+        template <typename F>
+        V                 getOrInsert(const K& key, F factory);
+
+        // Removing Objects
+        bool              remove(const K& key);
+        size_t            removeExpired();
+        CacheDictionary&  removeAll();
+
+        // String Representation
+        std::string  description() const;
+
+    private:
+        size_t         _hashOf(const K& key) const;
+        bool           _isExpired(const Entry& entry, time_point now) const;
+        void           _touch(EntryIterator entry);
+        EntryIterator  _victim();
+        void           _erase(EntryIterator entry);
+        void           _insert(const K& key, const V& value, duration time_to_live, bool counted);
+    };
+
+
+    ////////////////////
+    // IMPLEMENTATION //
+    ////////////////////
+
+    // Constructors
+    inline
+    CacheSketch::CacheSketch(size_t width) {
+        this->_width = CACHE_SKETCH_MIN_WIDTH;
+        while (this->_width < width && this->_width < CACHE_SKETCH_MAX_WIDTH) {
+            this->_width *= 2;
+        }
+
+        this->_counters = std::vector<uint8_t>(this->_width * 4, 0);
+        this->_additions = 0;
+    }
+
+
+    // Counting
+    inline
+    void CacheSketch::increment(size_t hash) {
+        for (size_t row = 0; row < 4; ++row) {
+            uint8_t& counter = this->_counters[this->_index(hash, row)];
+            if (counter < CACHE_SKETCH_MAX_COUNT) {
+                ++counter;
+            }
+        }
+
+        // Halving every counter now and then lets keys that were popular long ago fade out
+        if (++this->_additions >= this->_width * 10) {
+            this->_age();
+        }
+    }
+
+    inline
+    size_t CacheSketch::estimate(size_t hash) const {
+        size_t estimate = CACHE_SKETCH_MAX_COUNT;
+        for (size_t row = 0; row < 4; ++row) {
+            estimate = std::min(estimate, size_t(this->_counters[this->_index(hash, row)]));
+        }
+
+        return estimate;
+    }
+
+
+    // Internal Functions
+    inline
+    size_t CacheSketch::_index(size_t hash, size_t row) const {
+        static const uint64_t seeds[4] = {0x9E3779B97F4A7C15ull, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull, 0xD6E8FEB86659FD93ull};
+
+        uint64_t mixed = (uint64_t(hash) + row) * seeds[row];
+        return row * this->_width + size_t(mixed >> 32) % this->_width;
+    }
+
+    inline
+    void CacheSketch::_age() {
+        for (uint8_t& counter : this->_counters) {
+            counter >>= 1;
+        }
+
+        this->_additions /= 2;
+    }
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    CacheDictionary<K, V, Hash, KeyEqual, Clock>::CacheDictionary(size_t capacity, CachePolicy policy) : _sketch(capacity) {
+        this->_policy = policy;
+        this->_capacity = capacity;
+        this->_cost = 0;
+        this->_protected_cost = 0;
+        this->_time_to_live = duration::zero();
+    }
+
+
+    // Configuring Cache
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    CacheDictionary<K, V, Hash, KeyEqual, Clock>& CacheDictionary<K, V, Hash, KeyEqual, Clock>::setCostFunction(CostFunction function) {
+        this->_cost_function = function;
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    CacheDictionary<K, V, Hash, KeyEqual, Clock>& CacheDictionary<K, V, Hash, KeyEqual, Clock>::setTimeToLive(duration time_to_live) {
+        this->_time_to_live = time_to_live;
+        return *this;
+    }
+
+
+    // Querying Cache
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    const V* CacheDictionary<K, V, Hash, KeyEqual, Clock>::tryGet(const K& key) {
+        if (this->_policy == CachePolicy::TINY_LFU) {
+            this->_sketch.increment(this->_hashOf(key));
+        }
+
+        auto it = this->_index.find(key);
+        if (it == this->_index.end()) {
+            ++this->_statistics.misses;
+            return nullptr;
+        }
+
+        EntryIterator entry = it->second;
+        if (this->_isExpired(*entry, Clock::now())) {
+            this->_erase(entry);
+            ++this->_statistics.expirations;
+            ++this->_statistics.misses;
+            return nullptr;
+        }
+
+        ++this->_statistics.hits;
+        this->_touch(entry);
+        return &entry->value;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    V CacheDictionary<K, V, Hash, KeyEqual, Clock>::objectForKey(const K& key) {
+        const V* value = this->tryGet(key);
+        if (value == nullptr) {
+            throw CACHE_MISSING_KEY;
+        }
+
+        return *value;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    bool CacheDictionary<K, V, Hash, KeyEqual, Clock>::containsKey(const K& key) const {
+        // Does not count as a use of the key
+        auto it = this->_index.find(key);
+        return it != this->_index.end() && !this->_isExpired(*it->second, Clock::now());
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    size_t CacheDictionary<K, V, Hash, KeyEqual, Clock>::size() const {
+        return this->_index.size();
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    bool CacheDictionary<K, V, Hash, KeyEqual, Clock>::isEmpty() const {
+        return this->_index.empty();
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    size_t CacheDictionary<K, V, Hash, KeyEqual, Clock>::cost() const {
+        return this->_cost;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    size_t CacheDictionary<K, V, Hash, KeyEqual, Clock>::capacity() const {
+        return this->_capacity;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    const CacheStatistics& CacheDictionary<K, V, Hash, KeyEqual, Clock>::statistics() const {
+        return this->_statistics;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    CacheDictionary<K, V, Hash, KeyEqual, Clock>& CacheDictionary<K, V, Hash, KeyEqual, Clock>::resetStatistics() {
+        this->_statistics = CacheStatistics();
+        return *this;
+    }
+
+
+    // Adding Objects
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    CacheDictionary<K, V, Hash, KeyEqual, Clock>& CacheDictionary<K, V, Hash, KeyEqual, Clock>::insertOrAssign(const K& key, const V& value) {
+        return this->insertOrAssign(key, value, this->_time_to_live);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    CacheDictionary<K, V, Hash, KeyEqual, Clock>& CacheDictionary<K, V, Hash, KeyEqual, Clock>::insertOrAssign(const K& key, const V& value, duration time_to_live) {
+        this->_insert(key, value, time_to_live, false);
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    template <typename F>
+    V CacheDictionary<K, V, Hash, KeyEqual, Clock>::getOrInsert(const K& key, F factory) {
+        const V* cached = this->tryGet(key);
+        if (cached != nullptr) {
+            return *cached;
+        }
+
+        // Returned by value, since the cache may not admit it
+        V value = factory();
+        this->_insert(key, value, this->_time_to_live, true);
+        return value;
+    }
+
+
+    // Removing Objects
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    bool CacheDictionary<K, V, Hash, KeyEqual, Clock>::remove(const K& key) {
+        auto it = this->_index.find(key);
+        if (it == this->_index.end()) {
+            return false;
+        }
+
+        this->_erase(it->second);
+        return true;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    size_t CacheDictionary<K, V, Hash, KeyEqual, Clock>::removeExpired() {
+        time_point now = Clock::now();
+        std::vector<EntryIterator> expired;
+
+        for (std::list<Entry>* list : {&this->_probation, &this->_protected}) {
+            for (EntryIterator entry = list->begin(); entry != list->end(); ++entry) {
+                if (this->_isExpired(*entry, now)) {
+                    expired.push_back(entry);
+                }
+            }
+        }
+
+        for (EntryIterator entry : expired) {
+            this->_erase(entry);
+        }
+
+        this->_statistics.expirations += expired.size();
+        return expired.size();
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    CacheDictionary<K, V, Hash, KeyEqual, Clock>& CacheDictionary<K, V, Hash, KeyEqual, Clock>::removeAll() {
+        this->_index.clear();
+        this->_probation.clear();
+        this->_protected.clear();
+        this->_cost = 0;
+        this->_protected_cost = 0;
+        return *this;
+    }
+
+
+    // String Representation
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    std::string CacheDictionary<K, V, Hash, KeyEqual, Clock>::description() const {
+        // Most recently used first, protected entries before the others
+        DescriptionWriter writer;
+        writer.write('{');
+
+        bool first = true;
+        for (const std::list<Entry>* list : {&this->_protected, &this->_probation}) {
+            for (const Entry& entry : *list) {
+                if (!first) {
+                    writer.write(", ", 2);
+                }
+
+                writer.value(entry.key).write(" => ", 4).value(entry.value);
+                first = false;
+            }
+        }
+
+        writer.write('}');
+        return writer.take();
+    }
+
+
+    // Internal Functions
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    size_t CacheDictionary<K, V, Hash, KeyEqual, Clock>::_hashOf(const K& key) const {
+        return this->_hash(key);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    bool CacheDictionary<K, V, Hash, KeyEqual, Clock>::_isExpired(const Entry& entry, time_point now) const {
+        return entry.expiry <= now;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    void CacheDictionary<K, V, Hash, KeyEqual, Clock>::_touch(EntryIterator entry) {
+        if (this->_policy == CachePolicy::LRU) {
+            this->_probation.splice(this->_probation.begin(), this->_probation, entry);
+            return;
+        }
+
+        if (entry->is_protected) {
+            this->_protected.splice(this->_protected.begin(), this->_protected, entry);
+            return;
+        }
+
+        // A second use promotes the entry, demoting the oldest protected entries if that segment is full
+        this->_protected.splice(this->_protected.begin(), this->_probation, entry);
+        entry->is_protected = true;
+        this->_protected_cost += entry->cost;
+
+        size_t limit = this->_capacity / 100 * CACHE_PROTECTED_PERCENT + this->_capacity % 100 * CACHE_PROTECTED_PERCENT / 100;
+        while (this->_protected_cost > limit && this->_protected.size() > 1) {
+            EntryIterator oldest = std::prev(this->_protected.end());
+            oldest->is_protected = false;
+            this->_protected_cost -= oldest->cost;
+            this->_probation.splice(this->_probation.begin(), this->_protected, oldest);
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    typename CacheDictionary<K, V, Hash, KeyEqual, Clock>::EntryIterator CacheDictionary<K, V, Hash, KeyEqual, Clock>::_victim() {
+        if (!this->_probation.empty()) {
+            return std::prev(this->_probation.end());
+        }
+
+        return std::prev(this->_protected.end());
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    void CacheDictionary<K, V, Hash, KeyEqual, Clock>::_erase(EntryIterator entry) {
+        this->_index.erase(entry->key);
+        this->_cost -= entry->cost;
+
+        if (entry->is_protected) {
+            this->_protected_cost -= entry->cost;
+            this->_protected.erase(entry);
+        }
+        else {
+            this->_probation.erase(entry);
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual, typename Clock>
+    void CacheDictionary<K, V, Hash, KeyEqual, Clock>::_insert(const K& key, const V& value, duration time_to_live, bool counted) {
+        size_t cost = this->_cost_function ? this->_cost_function(key, value) : 1;
+        time_point expiry = time_to_live == duration::zero() ? time_point::max() : Clock::now() + time_to_live;
+
+        // Replacing a value only changes its cost, then makes room around it
+        auto it = this->_index.find(key);
+        if (it != this->_index.end()) {
+            EntryIterator entry = it->second;
+            this->_cost = this->_cost - entry->cost + cost;
+            if (entry->is_protected) {
+                this->_protected_cost = this->_protected_cost - entry->cost + cost;
+            }
+
+            entry->value = value;
+            entry->cost = cost;
+            entry->expiry = expiry;
+            this->_touch(entry);
+
+            while (this->_cost > this->_capacity) {
+                this->_erase(this->_victim());
+                ++this->_statistics.evictions;
+            }
+
+            return;
+        }
+
+        if (cost > this->_capacity) {
+            ++this->_statistics.rejections;
+            return;
+        }
+
+        // A new key only replaces the next victim if the sketch has seen it more often, a lookup that missed has already counted it
+        if (this->_policy == CachePolicy::TINY_LFU && this->_cost + cost > this->_capacity) {
+            size_t hash = this->_hashOf(key);
+            if (!counted) {
+                this->_sketch.increment(hash);
+            }
+
+            if (this->_sketch.estimate(hash) <= this->_sketch.estimate(this->_hashOf(this->_victim()->key))) {
+                ++this->_statistics.rejections;
+                return;
+            }
+        }
+
+        while (this->_cost + cost > this->_capacity) {
+            this->_erase(this->_victim());
+            ++this->_statistics.evictions;
+        }
+
+        this->_probation.push_front(Entry{key, value, cost, expiry, false});
+        this->_index.try_emplace(key, this->_probation.begin());
+        this->_cost += cost;
+    }
+}
+
+#endif // MRLIB_CACHE_DICTIONARY_HPP
@@ -0,0 +1,402 @@
+//
+// ChunkedArray.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to let very large arrays grow without ever
+ * copying their elements. ChunkedBuffer stores its elements in fixed size
+ * chunks and only keeps a table of chunk pointers, so growing allocates
+ * one new chunk and never moves an existing element. A reference to an
+ * element stays valid while the array grows, until that element itself is
+ * removed or shifted by an insert or remove before it. ChunkedArray is an
+ * Array that uses a ChunkedBuffer for storage, so it has the same
+ * interface as Array.
+ *
+ * The elements of a ChunkedBuffer are not contiguous, so stream() and
+ * slice() are not available on a ChunkedArray.
+ */
+
+
+#ifndef MRLIB_CHUNKED_ARRAY_HPP
+#define MRLIB_CHUNKED_ARRAY_HPP
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <initializer_list>
+
+#include "Array.hpp"
+#include "RingArray.hpp"
+
+// Chunk Constants
+#define CHUNKED_ARRAY_CHUNK_SIZE 1024
+
+
+namespace mrlib {
+
+    template <typename T, size_t ChunkSize = CHUNKED_ARRAY_CHUNK_SIZE, typename Allocator = std::allocator<T>>
+    class ChunkedBuffer {
+        static_assert(ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ChunkedBuffer: chunk size must be a power of two");
+
+    public:
+        // Indexed the same way as a RingBuffer, so its iterator is shared
+        typedef T                                                        value_type;
+        typedef T&                                                       reference;
+        typedef const T&                                                 const_reference;
+        typedef RingBufferIterator<ChunkedBuffer, T>                     iterator;
+        typedef RingBufferIterator<const ChunkedBuffer, const T>         const_iterator;
+        typedef size_t                                                   size_type;
+
+        // Internal Data
+        std::vector<T*>  _chunks;
+        size_t           _size;
+        Allocator        _allocator;
+
+        // Constructors
+        ChunkedBuffer();
+        ChunkedBuffer(size_t size);
+        ChunkedBuffer(std::initializer_list<T> i_list);
+        template <typename InputIt>
+        ChunkedBuffer(InputIt first, InputIt last);
+        ChunkedBuffer(const ChunkedBuffer& buffer);
+        ChunkedBuffer(ChunkedBuffer&& buffer);
+        ~ChunkedBuffer();
+
+        // Operator Overloading
+        T&              operator[](size_t index);
+        const T&        operator[](size_t index) const;
+        ChunkedBuffer&  operator=(const ChunkedBuffer& buffer);
+        ChunkedBuffer&  operator=(ChunkedBuffer&& buffer);
+        bool            operator==(const ChunkedBuffer& buffer) const;
+        bool            operator!=(const ChunkedBuffer& buffer) const;
+
+        // Iteration
+        iterator        begin();
+        const_iterator  begin() const;
+        iterator        end();
+        const_iterator  end() const;
+
+        // Querying Buffer
+        size_t    size() const;
+        bool      empty() const;
+        size_t    capacity() const;
+        T&        front();
+        const T&  front() const;
+        T&        back();
+        const T&  back() const;
+
+        // Capacity
+        void  reserve(size_t capacity);
+        void  resize(size_t size);
+        void  shrink_to_fit();
+
+        // Modifiers
+        void      push_back(const T& object);
+        void      push_back(T&& object);
+        void      pop_back();
+        iterator  insert(const_iterator position, const T& object);
+        template <typename InputIt>
+        iterator  insert(const_iterator position, InputIt first, InputIt last);
+        iterator  erase(const_iterator position);
+        iterator  erase(const_iterator first, const_iterator last);
+        template <typename InputIt>
+        void      assign(InputIt first, InputIt last);
+        void      clear();
+
+    private:
+        T*    _slot(size_t index) const;
+        void  _release();
+    };
+
+    // Array whose elements never move when it grows
+    template <typename T, size_t ChunkSize = CHUNKED_ARRAY_CHUNK_SIZE, typename Allocator = std::allocator<T>>
+    using ChunkedArray = Array<T, ChunkedBuffer<T, ChunkSize, Allocator>>;
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename T, size_t ChunkSize, typename Allocator>
+    ChunkedBuffer<T, ChunkSize, Allocator>::ChunkedBuffer() {
+        this->_chunks = std::vector<T*>();
+        this->_size = 0;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    ChunkedBuffer<T, ChunkSize, Allocator>::ChunkedBuffer(size_t size) : ChunkedBuffer() {
+        this->resize(size);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    ChunkedBuffer<T, ChunkSize, Allocator>::ChunkedBuffer(std::initializer_list<T> i_list) : ChunkedBuffer() {
+        this->assign(i_list.begin(), i_list.end());
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    template <typename InputIt>
+    ChunkedBuffer<T, ChunkSize, Allocator>::ChunkedBuffer(InputIt first, InputIt last) : ChunkedBuffer() {
+        this->assign(first, last);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    ChunkedBuffer<T, ChunkSize, Allocator>::ChunkedBuffer(const ChunkedBuffer& buffer) : ChunkedBuffer() {
+        this->_allocator = buffer._allocator;
+        this->assign(buffer.begin(), buffer.end());
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    ChunkedBuffer<T, ChunkSize, Allocator>::ChunkedBuffer(ChunkedBuffer&& buffer) : ChunkedBuffer() {
+        *this = std::move(buffer);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    ChunkedBuffer<T, ChunkSize, Allocator>::~ChunkedBuffer() {
+        this->_release();
+    }
+
+
+    // Operator Overloading
+    template <typename T, size_t ChunkSize, typename Allocator>
+    T& ChunkedBuffer<T, ChunkSize, Allocator>::operator[](size_t index) {
+        return *this->_slot(index);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    const T& ChunkedBuffer<T, ChunkSize, Allocator>::operator[](size_t index) const {
+        return *this->_slot(index);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    ChunkedBuffer<T, ChunkSize, Allocator>& ChunkedBuffer<T, ChunkSize, Allocator>::operator=(const ChunkedBuffer& buffer) {
+        // Check self assignment
+        if (this == &buffer) return *this;
+
+        this->assign(buffer.begin(), buffer.end());
+        return *this;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    ChunkedBuffer<T, ChunkSize, Allocator>& ChunkedBuffer<T, ChunkSize, Allocator>::operator=(ChunkedBuffer&& buffer) {
+        // Check self assignment
+        if (this == &buffer) return *this;
+
+        this->_release();
+
+        this->_chunks = std::move(buffer._chunks);
+        this->_size = buffer._size;
+        this->_allocator = buffer._allocator;
+
+        buffer._chunks.clear();
+        buffer._size = 0;
+        return *this;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    bool ChunkedBuffer<T, ChunkSize, Allocator>::operator==(const ChunkedBuffer& buffer) const {
+        return this->_size == buffer._size && std::equal(this->begin(), this->end(), buffer.begin());
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    bool ChunkedBuffer<T, ChunkSize, Allocator>::operator!=(const ChunkedBuffer& buffer) const {
+        return !(*this == buffer);
+    }
+
+
+    // Iteration
+    template <typename T, size_t ChunkSize, typename Allocator>
+    typename ChunkedBuffer<T, ChunkSize, Allocator>::iterator ChunkedBuffer<T, ChunkSize, Allocator>::begin() {
+        return iterator(this, 0);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    typename ChunkedBuffer<T, ChunkSize, Allocator>::const_iterator ChunkedBuffer<T, ChunkSize, Allocator>::begin() const {
+        return const_iterator(this, 0);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    typename ChunkedBuffer<T, ChunkSize, Allocator>::iterator ChunkedBuffer<T, ChunkSize, Allocator>::end() {
+        return iterator(this, this->_size);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    typename ChunkedBuffer<T, ChunkSize, Allocator>::const_iterator ChunkedBuffer<T, ChunkSize, Allocator>::end() const {
+        return const_iterator(this, this->_size);
+    }
+
+
+    // Querying Buffer
+    template <typename T, size_t ChunkSize, typename Allocator>
+    size_t ChunkedBuffer<T, ChunkSize, Allocator>::size() const {
+        return this->_size;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    bool ChunkedBuffer<T, ChunkSize, Allocator>::empty() const {
+        return this->_size == 0;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    size_t ChunkedBuffer<T, ChunkSize, Allocator>::capacity() const {
+        return this->_chunks.size() * ChunkSize;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    T& ChunkedBuffer<T, ChunkSize, Allocator>::front() {
+        return *this->_slot(0);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    const T& ChunkedBuffer<T, ChunkSize, Allocator>::front() const {
+        return *this->_slot(0);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    T& ChunkedBuffer<T, ChunkSize, Allocator>::back() {
+        return *this->_slot(this->_size - 1);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    const T& ChunkedBuffer<T, ChunkSize, Allocator>::back() const {
+        return *this->_slot(this->_size - 1);
+    }
+
+
+    // Capacity
+    template <typename T, size_t ChunkSize, typename Allocator>
+    void ChunkedBuffer<T, ChunkSize, Allocator>::reserve(size_t capacity) {
+        while (this->capacity() < capacity) {
+            this->_chunks.push_back(std::allocator_traits<Allocator>::allocate(this->_allocator, ChunkSize));
+        }
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    void ChunkedBuffer<T, ChunkSize, Allocator>::resize(size_t size) {
+        while (this->_size > size) {
+            this->pop_back();
+        }
+
+        this->reserve(size);
+        while (this->_size < size) {
+            ::new (static_cast<void*>(this->_slot(this->_size))) T();
+            ++this->_size;
+        }
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    void ChunkedBuffer<T, ChunkSize, Allocator>::shrink_to_fit() {
+        size_t needed = (this->_size + ChunkSize - 1) / ChunkSize;
+
+        while (this->_chunks.size() > needed) {
+            std::allocator_traits<Allocator>::deallocate(this->_allocator, this->_chunks.back(), ChunkSize);
+            this->_chunks.pop_back();
+        }
+
+        this->_chunks.shrink_to_fit();
+    }
+
+
+    // Modifiers
+    template <typename T, size_t ChunkSize, typename Allocator>
+    void ChunkedBuffer<T, ChunkSize, Allocator>::push_back(const T& object) {
+        // Growing never moves elements, so object stays valid even if it lives in the buffer
+        this->reserve(this->_size + 1);
+        ::new (static_cast<void*>(this->_slot(this->_size))) T(object);
+        ++this->_size;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    void ChunkedBuffer<T, ChunkSize, Allocator>::push_back(T&& object) {
+        this->reserve(this->_size + 1);
+        ::new (static_cast<void*>(this->_slot(this->_size))) T(std::move(object));
+        ++this->_size;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    void ChunkedBuffer<T, ChunkSize, Allocator>::pop_back() {
+        this->_slot(this->_size - 1)->~T();
+        --this->_size;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    typename ChunkedBuffer<T, ChunkSize, Allocator>::iterator ChunkedBuffer<T, ChunkSize, Allocator>::insert(const_iterator position, const T& object) {
+        size_t index = position._index;
+
+        this->push_back(object);
+        std::rotate(this->begin() + index, this->end() - 1, this->end());
+
+        return this->begin() + index;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    template <typename InputIt>
+    typename ChunkedBuffer<T, ChunkSize, Allocator>::iterator ChunkedBuffer<T, ChunkSize, Allocator>::insert(const_iterator position, InputIt first, InputIt last) {
+        size_t index = position._index;
+        size_t old_size = this->_size;
+
+        for (; first != last; ++first) {
+            this->push_back(*first);
+        }
+
+        std::rotate(this->begin() + index, this->begin() + old_size, this->end());
+        return this->begin() + index;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    typename ChunkedBuffer<T, ChunkSize, Allocator>::iterator ChunkedBuffer<T, ChunkSize, Allocator>::erase(const_iterator position) {
+        return this->erase(position, position + 1);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    typename ChunkedBuffer<T, ChunkSize, Allocator>::iterator ChunkedBuffer<T, ChunkSize, Allocator>::erase(const_iterator first, const_iterator last) {
+        size_t from = first._index;
+        size_t to = last._index;
+
+        std::move(this->begin() + to, this->end(), this->begin() + from);
+        for (size_t i = from; i < to; ++i) {
+            this->pop_back();
+        }
+
+        return this->begin() + from;
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    template <typename InputIt>
+    void ChunkedBuffer<T, ChunkSize, Allocator>::assign(InputIt first, InputIt last) {
+        this->clear();
+        for (; first != last; ++first) {
+            this->push_back(*first);
+        }
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    void ChunkedBuffer<T, ChunkSize, Allocator>::clear() {
+        while (this->_size > 0) {
+            this->pop_back();
+        }
+    }
+
+
+    // Internal Functions
+    template <typename T, size_t ChunkSize, typename Allocator>
+    T* ChunkedBuffer<T, ChunkSize, Allocator>::_slot(size_t index) const {
+        return this->_chunks[index / ChunkSize] + (index % ChunkSize);
+    }
+
+    template <typename T, size_t ChunkSize, typename Allocator>
+    void ChunkedBuffer<T, ChunkSize, Allocator>::_release() {
+        this->clear();
+
+        for (T* chunk : this->_chunks) {
+            std::allocator_traits<Allocator>::deallocate(this->_allocator, chunk, ChunkSize);
+        }
+
+        this->_chunks.clear();
+    }
+}
+
+#endif // MRLIB_CHUNKED_ARRAY_HPP
@@ -0,0 +1,364 @@
+//
+// ConcurrentArray.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to let many threads add to the same array
+ * without a lock. Objects are stored in segments that double in size, and
+ * a segment never moves once it is allocated, so adding never invalidates
+ * objects that are already stored. Adding claims a slot with a single
+ * atomic increment, and only the first thread to reach a new segment has
+ * to allocate it.
+ *
+ * Each slot is published once its object is constructed. Reads are safe
+ * at any time, but only see published objects, so an object added by
+ * another thread may not be visible until its add has returned. Removing
+ * objects is not supported.
+ *
+ * An index is claimed before its object is constructed, and other threads
+ * may already have claimed the ones after it, so an add that throws can
+ * not give its index back. The slot is marked abandoned instead: it is
+ * never published, forEach and snapshot skip it, and size() does not count
+ * it, so the indices in use run abandonedCount() past size().
+ */
+
+
+#ifndef MRLIB_CONCURRENT_ARRAY_HPP
+#define MRLIB_CONCURRENT_ARRAY_HPP
+
+#include <atomic>
+#include <new>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Array.hpp"
+
+// Segment Constants
+#define CONCURRENT_ARRAY_FIRST_SEGMENT_BITS 5
+#define CONCURRENT_ARRAY_SEGMENTS 59
+
+// Slot States, empty must be zero
+#define CONCURRENT_ARRAY_EMPTY 0
+#define CONCURRENT_ARRAY_PUBLISHED 1
+#define CONCURRENT_ARRAY_ABANDONED 2
+
+// Index out of bounds exception
+#define CONCURRENT_ARRAY_OUT_BOUNDS std::invalid_argument("ConcurrentArray: Out of bounds exception")
+#define CONCURRENT_ARRAY_UNPUBLISHED std::invalid_argument("ConcurrentArray: Object has not been published")
+#define CONCURRENT_ARRAY_ABANDONED_INDEX std::invalid_argument("ConcurrentArray: Adding the object at this index failed")
+
+namespace mrlib {
+
+    template <typename T>
+    struct ConcurrentArraySlot {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type  value;
+        std::atomic<uint8_t>                                        state;
+    };
+
+
+    template <typename T>
+    class ConcurrentArray {
+    public:
+        // Internal Data
+        std::atomic<ConcurrentArraySlot<T>*>  _segments[CONCURRENT_ARRAY_SEGMENTS];
+        std::atomic<size_t>                   _size;       // Claimed indices, including abandoned ones
+        std::atomic<size_t>                   _abandoned;
+
+        // Constructors
+        ConcurrentArray();
+        ConcurrentArray(size_t capacity);
+        ConcurrentArray(const ConcurrentArray<T>&) = delete;
+        ~ConcurrentArray();
+
+        // Operator Overloading
+        const T&             operator[](const size_t index) const;
+        ConcurrentArray<T>&  operator=(const ConcurrentArray<T>&) = delete;
+
+        // Querying Array
+        T       objectAtIndex(size_t index) const;
+        bool    isPublished(size_t index) const;
+        bool    isAbandoned(size_t index) const;
+        size_t  size() const;
+        size_t  abandonedCount() const;
+        bool    isEmpty() const;
+
+        // Adding Objects
+        size_t               add(const T& object);
+        size_t               add(T&& object);
+        ConcurrentArray<T>&  reserve(size_t capacity);
+
+        // Iterating Objects
+        template <typename F>
+        void  forEach(F function) const;
+
+        // Getting Containers
+        Array<T>     snapshot() const;
+
+        // String Representation
+        std::string  description() const;
+
+    private:
+        static size_t           _segmentOf(size_t index);
+        static size_t           _segmentSize(size_t segment);
+        static size_t           _offsetOf(size_t index, size_t segment);
+        ConcurrentArraySlot<T>* _segment(size_t segment);
+        ConcurrentArraySlot<T>* _slot(size_t index) const;
+        uint8_t                 _state(size_t index) const;
+        template <typename U>
+        size_t                  _add(U&& object);
+    };
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename T>
+    ConcurrentArray<T>::ConcurrentArray() {
+        for (size_t i = 0; i < CONCURRENT_ARRAY_SEGMENTS; ++i) {
+            this->_segments[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        this->_size.store(0, std::memory_order_relaxed);
+        this->_abandoned.store(0, std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    ConcurrentArray<T>::ConcurrentArray(size_t capacity) : ConcurrentArray() {
+        this->reserve(capacity);
+    }
+
+    template <typename T>
+    ConcurrentArray<T>::~ConcurrentArray() {
+        size_t size = this->_size.load(std::memory_order_acquire);
+
+        for (size_t segment = 0; segment < CONCURRENT_ARRAY_SEGMENTS; ++segment) {
+            ConcurrentArraySlot<T>* slots = this->_segments[segment].load(std::memory_order_acquire);
+            if (slots == nullptr) continue;
+
+            size_t first = _segmentSize(segment) - _segmentSize(0);
+            for (size_t i = 0; i < _segmentSize(segment) && first + i < size; ++i) {
+                if (slots[i].state.load(std::memory_order_acquire) == CONCURRENT_ARRAY_PUBLISHED) {
+                    reinterpret_cast<T*>(&slots[i].value)->~T();
+                }
+            }
+
+            std::free(slots);
+        }
+    }
+
+
+    // Operator Overloading
+    template <typename T>
+    const T& ConcurrentArray<T>::operator[](const size_t index) const {
+        if (index >= this->_size.load(std::memory_order_acquire)) {
+            throw CONCURRENT_ARRAY_OUT_BOUNDS;
+        }
+
+        uint8_t state = this->_state(index);
+        if (state == CONCURRENT_ARRAY_ABANDONED) {
+            throw CONCURRENT_ARRAY_ABANDONED_INDEX;
+        }
+        else if (state != CONCURRENT_ARRAY_PUBLISHED) {
+            throw CONCURRENT_ARRAY_UNPUBLISHED;
+        }
+
+        return *reinterpret_cast<const T*>(&this->_slot(index)->value);
+    }
+
+
+    // Querying Array
+    template <typename T>
+    T ConcurrentArray<T>::objectAtIndex(size_t index) const {
+        return (*this)[index];
+    }
+
+    template <typename T>
+    bool ConcurrentArray<T>::isPublished(size_t index) const {
+        if (index >= this->_size.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        return this->_state(index) == CONCURRENT_ARRAY_PUBLISHED;
+    }
+
+    template <typename T>
+    bool ConcurrentArray<T>::isAbandoned(size_t index) const {
+        if (index >= this->_size.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        return this->_state(index) == CONCURRENT_ARRAY_ABANDONED;
+    }
+
+    template <typename T>
+    size_t ConcurrentArray<T>::size() const {
+        // An index is abandoned only after it was claimed, so loading the abandoned count first never goes below zero
+        size_t abandoned = this->_abandoned.load(std::memory_order_acquire);
+        return this->_size.load(std::memory_order_acquire) - abandoned;
+    }
+
+    template <typename T>
+    size_t ConcurrentArray<T>::abandonedCount() const {
+        return this->_abandoned.load(std::memory_order_acquire);
+    }
+
+    template <typename T>
+    bool ConcurrentArray<T>::isEmpty() const {
+        return this->size() == 0;
+    }
+
+
+    // Adding Objects
+    template <typename T>
+    size_t ConcurrentArray<T>::add(const T& object) {
+        return this->_add(object);
+    }
+
+    template <typename T>
+    size_t ConcurrentArray<T>::add(T&& object) {
+        return this->_add(std::move(object));
+    }
+
+    template <typename T>
+    ConcurrentArray<T>& ConcurrentArray<T>::reserve(size_t capacity) {
+        if (capacity == 0) return *this;
+
+        size_t last = _segmentOf(capacity - 1);
+        for (size_t segment = 0; segment <= last; ++segment) {
+            this->_segment(segment);
+        }
+
+        return *this;
+    }
+
+
+    // Iterating Objects
+    template <typename T>
+    template <typename F>
+    void ConcurrentArray<T>::forEach(F function) const {
+        size_t size = this->_size.load(std::memory_order_acquire);
+
+        for (size_t i = 0; i < size; ++i) {
+            if (this->_state(i) == CONCURRENT_ARRAY_PUBLISHED) {
+                function(*reinterpret_cast<const T*>(&this->_slot(i)->value));
+            }
+        }
+    }
+
+
+    // Getting Containers
+    template <typename T>
+    Array<T> ConcurrentArray<T>::snapshot() const {
+        Array<T> array = Array<T>();
+        array._data.reserve(this->size());
+
+        this->forEach([&array](const T& object) {
+            array._data.push_back(object);
+        });
+
+        return array;
+    }
+
+
+    // String Representation
+    template <typename T>
+    std::string ConcurrentArray<T>::description() const {
+        return this->snapshot().description();
+    }
+
+
+    // Internal Functions
+    template <typename T>
+    size_t ConcurrentArray<T>::_segmentOf(size_t index) {
+        // Segment k starts at index 2^(k + b) - 2^b, where 2^b is the first segment size
+        size_t biased = (index >> CONCURRENT_ARRAY_FIRST_SEGMENT_BITS) + 1;
+        return size_t(63 - __builtin_clzll(biased));
+    }
+
+    template <typename T>
+    size_t ConcurrentArray<T>::_segmentSize(size_t segment) {
+        return size_t(1) << (segment + CONCURRENT_ARRAY_FIRST_SEGMENT_BITS);
+    }
+
+    template <typename T>
+    size_t ConcurrentArray<T>::_offsetOf(size_t index, size_t segment) {
+        return index - (_segmentSize(segment) - _segmentSize(0));
+    }
+
+    template <typename T>
+    ConcurrentArraySlot<T>* ConcurrentArray<T>::_segment(size_t segment) {
+        ConcurrentArraySlot<T>* slots = this->_segments[segment].load(std::memory_order_acquire);
+        if (slots != nullptr) {
+            return slots;
+        }
+
+        size_t size = _segmentSize(segment);
+        // Zeroed memory is already CONCURRENT_ARRAY_EMPTY, and large blocks come from the system as untouched
+        // zero pages, so the threads that lose the race below do not pay for writing the whole segment
+        ConcurrentArraySlot<T>* created = static_cast<ConcurrentArraySlot<T>*>(std::calloc(size, sizeof(ConcurrentArraySlot<T>)));
+        if (created == nullptr) {
+            throw std::bad_alloc();
+        }
+
+        // Only one thread installs the segment, the others free theirs and use the winner
+        if (this->_segments[segment].compare_exchange_strong(slots, created, std::memory_order_acq_rel)) {
+            return created;
+        }
+
+        std::free(created);
+        return slots;
+    }
+
+    template <typename T>
+    ConcurrentArraySlot<T>* ConcurrentArray<T>::_slot(size_t index) const {
+        size_t segment = _segmentOf(index);
+        ConcurrentArraySlot<T>* slots = this->_segments[segment].load(std::memory_order_acquire);
+
+        if (slots == nullptr) {
+            return nullptr;
+        }
+
+        return &slots[_offsetOf(index, segment)];
+    }
+
+    template <typename T>
+    uint8_t ConcurrentArray<T>::_state(size_t index) const {
+        // A segment that failed to allocate has no slots to mark, its failed adds are only counted
+        ConcurrentArraySlot<T>* slot = this->_slot(index);
+        return slot == nullptr ? uint8_t(CONCURRENT_ARRAY_EMPTY) : slot->state.load(std::memory_order_acquire);
+    }
+
+    template <typename T>
+    template <typename U>
+    size_t ConcurrentArray<T>::_add(U&& object) {
+        size_t index = this->_size.fetch_add(1, std::memory_order_acq_rel);
+        size_t segment = _segmentOf(index);
+        ConcurrentArraySlot<T>* slots = nullptr;
+
+        try {
+            slots = this->_segment(segment);
+            new (&slots[_offsetOf(index, segment)].value) T(std::forward<U>(object));
+        }
+        catch (...) {
+            if (slots != nullptr) {
+                slots[_offsetOf(index, segment)].state.store(CONCURRENT_ARRAY_ABANDONED, std::memory_order_release);
+            }
+
+            this->_abandoned.fetch_add(1, std::memory_order_acq_rel);
+            throw;
+        }
+
+        slots[_offsetOf(index, segment)].state.store(CONCURRENT_ARRAY_PUBLISHED, std::memory_order_release);
+        return index;
+    }
+}
+
+#endif // MRLIB_CONCURRENT_ARRAY_HPP
@@ -0,0 +1,347 @@
+//
+// ConcurrentDictionary.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to share a dictionary between many threads
+ * without one lock that every thread waits on. Keys are split between
+ * shards by their hash, and each shard is a HashMap with its own mutex, so
+ * threads only contend when they use keys in the same shard. The shards
+ * are padded so that their mutexes never share a cache line.
+ *
+ * Every operation on a key is atomic, including getOrInsert, upsert and
+ * compute, whose functions run while the shard is locked. Those functions
+ * must not use the same dictionary. If one throws, a key it was given a
+ * default object for is removed again. Objects are returned by value, since a
+ * reference would outlive the lock. snapshot() locks every shard at once,
+ * so it copies the dictionary as it was at a single point in time.
+ */
+
+
+#ifndef MRLIB_CONCURRENT_DICTIONARY_HPP
+#define MRLIB_CONCURRENT_DICTIONARY_HPP
+
+#include <mutex>
+#include <memory>
+#include <string>
+#include <stdexcept>
+#include <functional>
+
+#include "HashDictionary.hpp"
+
+// Shard Constants
+#define CONCURRENT_DICTIONARY_SHARDS 64
+#define CONCURRENT_DICTIONARY_CACHE_LINE 64
+
+// Key exceptions
+#define CONCURRENT_DICTIONARY_MISSING_KEY std::invalid_argument("ConcurrentDictionary: Key does not exist in dictionary")
+#define CONCURRENT_DICTIONARY_EXISTING_KEY std::invalid_argument("ConcurrentDictionary: Cannot add key that already exists")
+
+namespace mrlib {
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    struct ConcurrentDictionaryShard {
+        std::mutex                     mutex;
+        HashMap<K, V, Hash, KeyEqual>  map;
+        char                           padding[CONCURRENT_DICTIONARY_CACHE_LINE];
+    };
+
+
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    class ConcurrentDictionary {
+    public:
+        typedef ConcurrentDictionaryShard<K, V, Hash, KeyEqual>  Shard;
+
+        // Internal Data
+        std::unique_ptr<Shard[]>  _shards;
+        size_t                    _shard_count;   // A power of two
+        Hash                      _hash;
+
+        // Constructors
+        ConcurrentDictionary(size_t shards = CONCURRENT_DICTIONARY_SHARDS);
+        ConcurrentDictionary(const ConcurrentDictionary&) = delete;
+
+        // Operator Overloading
+        ConcurrentDictionary&  operator=(const ConcurrentDictionary&) = delete;
+
+        // Querying Dictionary
+        V       objectForKey(const K& key) const;
+        bool    tryGet(const K& key, V& value) const;
+        bool    containsKey(const K& key) const;
+        size_t  size() const;
+        bool    isEmpty() const;
+
+        // Adding Objects
+        ConcurrentDictionary&  addObject(const K& key, const V& value);
+        template <typename F>
+        V                      getOrInsert(const K& key, F factory);
+        ConcurrentDictionary&  insertOrAssign(const K& key, const V& value);
+        template <typename F>
+        ConcurrentDictionary&  upsert(const K& key, F function);
+        template <typename F>
+        bool                   compute(const K& key, F function);
+
+        // Removing Objects
+        bool                   remove(const K& key);
+        ConcurrentDictionary&  removeAll();
+
+        // Iterating Objects
+        template <typename F>
+        void  forEach(F function) const;
+
+        // Getting Containers
+        HashDictionary<K, V, Hash, KeyEqual>  snapshot() const;
+
+        // String Representation
+        std::string  description() const;
+
+    private:
+        Shard&  _shard(const K& key) const;
+        void    _lockAll() const;
+        void    _unlockAll() const;
+    };
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    ConcurrentDictionary<K, V, Hash, KeyEqual>::ConcurrentDictionary(size_t shards) {
+        this->_shard_count = 1;
+        while (this->_shard_count < shards) {
+            this->_shard_count *= 2;
+        }
+
+        this->_shards = std::unique_ptr<Shard[]>(new Shard[this->_shard_count]);
+    }
+
+
+    // Querying Dictionary
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    V ConcurrentDictionary<K, V, Hash, KeyEqual>::objectForKey(const K& key) const {
+        V value;
+        if (!this->tryGet(key, value)) {
+            throw CONCURRENT_DICTIONARY_MISSING_KEY;
+        }
+
+        return value;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool ConcurrentDictionary<K, V, Hash, KeyEqual>::tryGet(const K& key, V& value) const {
+        Shard& shard = this->_shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            return false;
+        }
+
+        value = it->second;
+        return true;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool ConcurrentDictionary<K, V, Hash, KeyEqual>::containsKey(const K& key) const {
+        Shard& shard = this->_shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.map.count(key) == 1;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t ConcurrentDictionary<K, V, Hash, KeyEqual>::size() const {
+        // Shards are counted one at a time, so writers running meanwhile may be partly counted
+        size_t size = 0;
+        for (size_t i = 0; i < this->_shard_count; ++i) {
+            std::lock_guard<std::mutex> lock(this->_shards[i].mutex);
+            size += this->_shards[i].map.size();
+        }
+
+        return size;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool ConcurrentDictionary<K, V, Hash, KeyEqual>::isEmpty() const {
+        return this->size() == 0;
+    }
+
+
+    // Adding Objects
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    ConcurrentDictionary<K, V, Hash, KeyEqual>& ConcurrentDictionary<K, V, Hash, KeyEqual>::addObject(const K& key, const V& value) {
+        Shard& shard = this->_shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        if (!shard.map.try_emplace(key, value).second) {
+            throw CONCURRENT_DICTIONARY_EXISTING_KEY;
+        }
+
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename F>
+    V ConcurrentDictionary<K, V, Hash, KeyEqual>::getOrInsert(const K& key, F factory) {
+        Shard& shard = this->_shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto it = shard.map.find(key);
+        if (it == shard.map.end()) {
+            it = shard.map.try_emplace(key, factory()).first;
+        }
+
+        return it->second;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    ConcurrentDictionary<K, V, Hash, KeyEqual>& ConcurrentDictionary<K, V, Hash, KeyEqual>::insertOrAssign(const K& key, const V& value) {
+        Shard& shard = this->_shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto result = shard.map.try_emplace(key, value);
+        if (!result.second) {
+            result.first->second = value;
+        }
+
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename F>
+    ConcurrentDictionary<K, V, Hash, KeyEqual>& ConcurrentDictionary<K, V, Hash, KeyEqual>::upsert(const K& key, F function) {
+        Shard& shard = this->_shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        auto result = shard.map.try_emplace(key);
+        try {
+            function(result.first->second);
+        }
+        catch (...) {
+            // Take a new key back out, so a failed upsert leaves no default object behind
+            if (result.second) shard.map.erase(result.first);
+            throw;
+        }
+
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename F>
+    bool ConcurrentDictionary<K, V, Hash, KeyEqual>::compute(const K& key, F function) {
+        Shard& shard = this->_shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        // The function gets the current value, or a default one, and returns whether to keep the key
+        auto result = shard.map.try_emplace(key);
+        bool keep;
+        try {
+            keep = function(result.first->second, !result.second);
+        }
+        catch (...) {
+            if (result.second) shard.map.erase(result.first);
+            throw;
+        }
+
+        if (!keep) {
+            shard.map.erase(result.first);
+        }
+
+        return keep;
+    }
+
+
+    // Removing Objects
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool ConcurrentDictionary<K, V, Hash, KeyEqual>::remove(const K& key) {
+        Shard& shard = this->_shard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.map.erase(key) == 1;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    ConcurrentDictionary<K, V, Hash, KeyEqual>& ConcurrentDictionary<K, V, Hash, KeyEqual>::removeAll() {
+        this->_lockAll();
+        for (size_t i = 0; i < this->_shard_count; ++i) {
+            this->_shards[i].map.clear();
+        }
+        this->_unlockAll();
+
+        return *this;
+    }
+
+
+    // Iterating Objects
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename F>
+    void ConcurrentDictionary<K, V, Hash, KeyEqual>::forEach(F function) const {
+        // Only one shard is locked at a time, use snapshot() for a consistent view
+        for (size_t i = 0; i < this->_shard_count; ++i) {
+            std::lock_guard<std::mutex> lock(this->_shards[i].mutex);
+
+            for (const auto& entry : this->_shards[i].map) {
+                function(entry.first, entry.second);
+            }
+        }
+    }
+
+
+    // Getting Containers
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    HashDictionary<K, V, Hash, KeyEqual> ConcurrentDictionary<K, V, Hash, KeyEqual>::snapshot() const {
+        HashDictionary<K, V, Hash, KeyEqual> dictionary = HashDictionary<K, V, Hash, KeyEqual>();
+
+        this->_lockAll();
+        try {
+            for (size_t i = 0; i < this->_shard_count; ++i) {
+                for (const auto& entry : this->_shards[i].map) {
+                    dictionary._data.insert(entry);
+                }
+            }
+        }
+        catch (...) {
+            this->_unlockAll();
+            throw;
+        }
+        this->_unlockAll();
+
+        return dictionary;
+    }
+
+
+    // String Representation
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    std::string ConcurrentDictionary<K, V, Hash, KeyEqual>::description() const {
+        return this->snapshot().description();
+    }
+
+
+    // Internal Functions
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename ConcurrentDictionary<K, V, Hash, KeyEqual>::Shard& ConcurrentDictionary<K, V, Hash, KeyEqual>::_shard(const K& key) const {
+        // HashMap also folds in the low bits of the same mix, so keys in one shard still spread out
+        uint64_t hash = uint64_t(this->_hash(key)) * 0x9E3779B97F4A7C15ull;
+        return this->_shards[size_t(hash >> 32) & (this->_shard_count - 1)];
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    void ConcurrentDictionary<K, V, Hash, KeyEqual>::_lockAll() const {
+        // Always lock in shard order, so two threads locking everything can not deadlock
+        for (size_t i = 0; i < this->_shard_count; ++i) {
+            this->_shards[i].mutex.lock();
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    void ConcurrentDictionary<K, V, Hash, KeyEqual>::_unlockAll() const {
+        for (size_t i = this->_shard_count; i > 0; --i) {
+            this->_shards[i - 1].mutex.unlock();
+        }
+    }
+}
+
+#endif // MRLIB_CONCURRENT_DICTIONARY_HPP
@@ -0,0 +1,357 @@
+//
+// CountingDictionary.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to count how often each key occurs. The
+ * counts are kept in a HashMap, and increment adds to the count of a key
+ * where it is stored, with one lookup that inserts the key when it is new.
+ * A key is in the dictionary for as long as its count is above zero, and
+ * the total of all counts is kept as they change.
+ *
+ * mostCommon finds the keys with the largest counts with a heap of only
+ * as many entries as are asked for, and heavyHitters the keys that make up
+ * more than a fraction of the total. Keys with equal counts come in no
+ * particular order.
+ *
+ * A CountingDictionary is not thread safe. Counting on many threads is
+ * done with one dictionary per thread, which are combined with merge when
+ * the threads are done. merge looks up the keys of the other dictionary in
+ * batches, with the slot of each one prefetched first.
+ */
+
+
+#ifndef MRLIB_COUNTING_DICTIONARY_HPP
+#define MRLIB_COUNTING_DICTIONARY_HPP
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+
+#include "HashDictionary.hpp"
+#include "DescriptionWriter.hpp"
+
+
+namespace mrlib {
+
+    template <typename K, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    class CountingDictionary {
+    public:
+        typedef HashMap<K, size_t, Hash, KeyEqual>  Storage;
+        typedef typename Storage::const_iterator    const_iterator;
+
+        // Internal Data
+        Storage  _data;
+        size_t   _total;   // Sum of all counts
+
+        // Constructors
+        CountingDictionary();
+        CountingDictionary(std::initializer_list<K> i_list);
+
+        // Operator Overloading
+        CountingDictionary<K, Hash, KeyEqual>&  operator+=(const CountingDictionary<K, Hash, KeyEqual>& dictionary);
+        bool                                    operator==(const CountingDictionary<K, Hash, KeyEqual>& dictionary) const;
+        bool                                    operator!=(const CountingDictionary<K, Hash, KeyEqual>& dictionary) const;
+
+        // Iteration
+        const_iterator  begin() const;
+        const_iterator  end() const;
+
+        // Querying Counts
+        size_t          countForKey(const K& key) const;
+        bool            containsKey(const K& key) const;
+        size_t          size() const;
+        size_t          total() const;
+        bool            isEmpty() const;
+        std::vector<K>  getKeys() const;
+
+        // Top Keys
+        std::vector<std::pair<K, size_t>>  mostCommon(size_t count) const;
+        std::vector<std::pair<K, size_t>>  heavyHitters(double fraction) const;
+
+        // Counting Keys
+        size_t                                  increment(const K& key, size_t count = 1);
+        size_t                                  decrement(const K& key, size_t count = 1);
+        template <typename InputIt>
+        CountingDictionary<K, Hash, KeyEqual>&  incrementAll(InputIt first, InputIt last);
+        CountingDictionary<K, Hash, KeyEqual>&  merge(const CountingDictionary<K, Hash, KeyEqual>& dictionary);
+
+        // Removing Keys
+        CountingDictionary<K, Hash, KeyEqual>&  remove(const K& key);
+        CountingDictionary<K, Hash, KeyEqual>&  removeAll();
+
+        // String Representation
+        std::string  description() const;
+
+        // Dictionary Copy
+        CountingDictionary<K, Hash, KeyEqual>  copy() const;
+
+    private:
+        std::vector<std::pair<K, size_t>>  _sorted(std::vector<const typename Storage::value_type*>& entries) const;
+    };
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename K, typename Hash, typename KeyEqual>
+    CountingDictionary<K, Hash, KeyEqual>::CountingDictionary() {
+        this->_total = 0;
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    CountingDictionary<K, Hash, KeyEqual>::CountingDictionary(std::initializer_list<K> i_list) : CountingDictionary() {
+        this->incrementAll(i_list.begin(), i_list.end());
+    }
+
+
+    // Operator Overloading
+    template <typename K, typename Hash, typename KeyEqual>
+    CountingDictionary<K, Hash, KeyEqual>& CountingDictionary<K, Hash, KeyEqual>::operator+=(const CountingDictionary<K, Hash, KeyEqual>& dictionary) {
+        return this->merge(dictionary);
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    bool CountingDictionary<K, Hash, KeyEqual>::operator==(const CountingDictionary<K, Hash, KeyEqual>& dictionary) const {
+        return this->_total == dictionary._total && this->_data == dictionary._data;
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    bool CountingDictionary<K, Hash, KeyEqual>::operator!=(const CountingDictionary<K, Hash, KeyEqual>& dictionary) const {
+        return !(*this == dictionary);
+    }
+
+
+    // Iteration
+    template <typename K, typename Hash, typename KeyEqual>
+    typename CountingDictionary<K, Hash, KeyEqual>::const_iterator CountingDictionary<K, Hash, KeyEqual>::begin() const {
+        return this->_data.begin();
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    typename CountingDictionary<K, Hash, KeyEqual>::const_iterator CountingDictionary<K, Hash, KeyEqual>::end() const {
+        return this->_data.end();
+    }
+
+
+    // Querying Counts
+    template <typename K, typename Hash, typename KeyEqual>
+    size_t CountingDictionary<K, Hash, KeyEqual>::countForKey(const K& key) const {
+        const_iterator it = this->_data.find(key);
+        return it != this->_data.end() ? it->second : 0;
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    bool CountingDictionary<K, Hash, KeyEqual>::containsKey(const K& key) const {
+        return this->_data.count(key) != 0;
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    size_t CountingDictionary<K, Hash, KeyEqual>::size() const {
+        return this->_data.size();
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    size_t CountingDictionary<K, Hash, KeyEqual>::total() const {
+        return this->_total;
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    bool CountingDictionary<K, Hash, KeyEqual>::isEmpty() const {
+        return this->_data.empty();
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    std::vector<K> CountingDictionary<K, Hash, KeyEqual>::getKeys() const {
+        std::vector<K> keys = std::vector<K>();
+        keys.reserve(this->_data.size());
+        for (const auto& pair : this->_data) {
+            keys.push_back(pair.first);
+        }
+
+        return keys;
+    }
+
+
+    // Top Keys
+    template <typename K, typename Hash, typename KeyEqual>
+    std::vector<std::pair<K, size_t>> CountingDictionary<K, Hash, KeyEqual>::mostCommon(size_t count) const {
+        typedef const typename Storage::value_type* Entry;
+        auto greater = [](Entry first, Entry second) { return first->second > second->second; };
+
+        if (count == 0) return std::vector<std::pair<K, size_t>>();
+
+        // A min heap of the largest counts so far, so only keys that make it in are ever copied
+        std::vector<Entry> heap = std::vector<Entry>();
+        heap.reserve(std::min(count, this->_data.size()));
+
+        for (const auto& pair : this->_data) {
+            if (heap.size() < count) {
+                heap.push_back(&pair);
+                std::push_heap(heap.begin(), heap.end(), greater);
+            }
+            else if (pair.second > heap.front()->second) {
+                std::pop_heap(heap.begin(), heap.end(), greater);
+                heap.back() = &pair;
+                std::push_heap(heap.begin(), heap.end(), greater);
+            }
+        }
+
+        return this->_sorted(heap);
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    std::vector<std::pair<K, size_t>> CountingDictionary<K, Hash, KeyEqual>::heavyHitters(double fraction) const {
+        std::vector<const typename Storage::value_type*> entries = std::vector<const typename Storage::value_type*>();
+        double threshold = fraction * double(this->_total);
+        for (const auto& pair : this->_data) {
+            if (double(pair.second) > threshold) {
+                entries.push_back(&pair);
+            }
+        }
+
+        return this->_sorted(entries);
+    }
+
+
+    // Counting Keys
+    template <typename K, typename Hash, typename KeyEqual>
+    size_t CountingDictionary<K, Hash, KeyEqual>::increment(const K& key, size_t count) {
+        if (count == 0) return this->countForKey(key);
+
+        this->_total += count;
+        return this->_data[key] += count;
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    size_t CountingDictionary<K, Hash, KeyEqual>::decrement(const K& key, size_t count) {
+        typename Storage::iterator it = this->_data.find(key);
+        if (it == this->_data.end()) return 0;
+
+        // A count never goes below zero, and a key whose count reaches zero is removed
+        if (it->second <= count) {
+            this->_total -= it->second;
+            this->_data.erase(it);
+            return 0;
+        }
+
+        this->_total -= count;
+        return it->second -= count;
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    template <typename InputIt>
+    CountingDictionary<K, Hash, KeyEqual>& CountingDictionary<K, Hash, KeyEqual>::incrementAll(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            ++this->_data[*first];
+            ++this->_total;
+        }
+
+        return *this;
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    CountingDictionary<K, Hash, KeyEqual>& CountingDictionary<K, Hash, KeyEqual>::merge(const CountingDictionary<K, Hash, KeyEqual>& dictionary) {
+        // Check self merge, which doubles every count
+        if (this == &dictionary) {
+            for (auto& pair : this->_data) {
+                pair.second *= 2;
+            }
+
+            this->_total *= 2;
+            return *this;
+        }
+
+        // Reserved once up front so the table usually keeps its size while a batch is looked up. Removed keys
+        // still use up room, so an insert can rehash anyway, which only wastes the prefetches of that batch
+        this->_data.reserve(this->_data.size() + dictionary._data.size());
+
+        const typename Storage::value_type* batch[HASH_BATCH_SIZE];
+        size_t hashes[HASH_BATCH_SIZE];
+        const_iterator it = dictionary._data.begin();
+        while (it != dictionary._data.end()) {
+            size_t size = 0;
+            for (; size < HASH_BATCH_SIZE && it != dictionary._data.end(); ++size, ++it) {
+                batch[size] = &*it;
+                hashes[size] = this->_data.hash(it->first);
+                this->_data.prefetch(hashes[size]);
+            }
+
+            for (size_t i = 0; i < size; ++i) {
+                typename Storage::iterator found = this->_data.find(batch[i]->first, hashes[i]);
+                if (found != this->_data.end()) {
+                    found->second += batch[i]->second;
+                }
+                else {
+                    this->_data.insert(*batch[i]);
+                }
+            }
+        }
+
+        this->_total += dictionary._total;
+        return *this;
+    }
+
+
+    // Removing Keys
+    template <typename K, typename Hash, typename KeyEqual>
+    CountingDictionary<K, Hash, KeyEqual>& CountingDictionary<K, Hash, KeyEqual>::remove(const K& key) {
+        typename Storage::iterator it = this->_data.find(key);
+        if (it != this->_data.end()) {
+            this->_total -= it->second;
+            this->_data.erase(it);
+        }
+
+        return *this;
+    }
+
+    template <typename K, typename Hash, typename KeyEqual>
+    CountingDictionary<K, Hash, KeyEqual>& CountingDictionary<K, Hash, KeyEqual>::removeAll() {
+        this->_data.clear();
+        this->_total = 0;
+        return *this;
+    }
+
+
+    // String Representation
+    template <typename K, typename Hash, typename KeyEqual>
+    std::string CountingDictionary<K, Hash, KeyEqual>::description() const {
+        DescriptionWriter writer;
+        writer.mapping(this->_data.begin(), this->_data.size());
+        return writer.take();
+    }
+
+
+    // Dictionary Copy
+    template <typename K, typename Hash, typename KeyEqual>
+    CountingDictionary<K, Hash, KeyEqual> CountingDictionary<K, Hash, KeyEqual>::copy() const {
+        return CountingDictionary<K, Hash, KeyEqual>(*this);
+    }
+
+
+    // Internal Functions
+    template <typename K, typename Hash, typename KeyEqual>
+    std::vector<std::pair<K, size_t>> CountingDictionary<K, Hash, KeyEqual>::_sorted(std::vector<const typename Storage::value_type*>& entries) const {
+        std::sort(entries.begin(), entries.end(), [](const typename Storage::value_type* first, const typename Storage::value_type* second) {
+            return first->second > second->second;
+        });
+
+        std::vector<std::pair<K, size_t>> result = std::vector<std::pair<K, size_t>>();
+        result.reserve(entries.size());
+        for (const typename Storage::value_type* entry : entries) {
+            result.push_back(std::make_pair(entry->first, entry->second));
+        }
+
+        return result;
+    }
+}
+
+#endif // MRLIB_COUNTING_DICTIONARY_HPP
@@ -0,0 +1,462 @@
+//
+// DescriptionWriter.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to render the string representation of the
+ * containers. Text is appended to a single buffer, integers are formatted
+ * by hand, and floating point values go through snprintf with the decimal
+ * point of the locale replaced by '.', so no stream or locale object is
+ * created per call and the output is the same in every locale. Only types
+ * the writer does not know fall back to operator<<.
+ *
+ * description() builds a writer for the call and hands its buffer to the
+ * returned string. A caller that describes many containers keeps one
+ * writer and calls describe(container) for any container with
+ * describeTo, which clears the buffer and reuses its memory every time.
+ *
+ * Large containers can be truncated to their first and last few elements,
+ * and a writer given a file descriptor flushes its buffer to it whenever
+ * the buffer fills, so a description never has to fit in memory at once.
+ */
+
+
+#ifndef MRLIB_DESCRIPTION_WRITER_HPP
+#define MRLIB_DESCRIPTION_WRITER_HPP
+
+#include <string>
+#include <sstream>
+#include <cstdio>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include <unistd.h>
+
+// Buffer Constants
+#define DESCRIPTION_BUFFER_SIZE 4096
+#define DESCRIPTION_NO_LIMIT -1ull
+
+namespace mrlib {
+
+    // Formatting used for each type, see DescriptionWriter::value
+    template <typename T>
+    struct DescriptionKind : std::integral_constant<int,
+        std::is_same<T, bool>::value ? 0 :
+        (std::is_same<T, char>::value || std::is_same<T, signed char>::value || std::is_same<T, unsigned char>::value) ? 1 :
+        std::is_integral<T>::value ? 2 :
+        std::is_floating_point<T>::value ? 3 : 4> {};
+
+
+    class DescriptionWriter {
+    public:
+        // Internal Data
+        std::string  _buffer;
+        int          _fd;
+        size_t       _flush_size;
+        size_t       _head;
+        size_t       _tail;
+
+        // Constructors
+        DescriptionWriter();
+        DescriptionWriter(size_t capacity);
+        DescriptionWriter(int fd, size_t capacity = DESCRIPTION_BUFFER_SIZE);
+        DescriptionWriter(const DescriptionWriter&) = delete;
+        ~DescriptionWriter();
+
+        // Operator Overloading
+        DescriptionWriter&  operator=(const DescriptionWriter&) = delete;
+
+        // Truncation
+        DescriptionWriter&  truncate(size_t head, size_t tail);
+        bool                isTruncated(size_t size) const;
+
+        // Writing Text
+        DescriptionWriter&  write(char character);
+        DescriptionWriter&  write(const char* string);
+        DescriptionWriter&  write(const char* string, size_t length);
+        DescriptionWriter&  write(const std::string& string);
+
+        // Writing Values
+        template <typename T>
+        DescriptionWriter&  value(const T& object);
+        DescriptionWriter&  value(const char* string);
+        DescriptionWriter&  value(const std::string& string);
+        DescriptionWriter&  address(const void* pointer);
+
+        // Writing Containers
+        template <typename It>
+        DescriptionWriter&  sequence(It begin, size_t size);
+        template <typename It>
+        DescriptionWriter&  mapping(It begin, size_t size);
+
+        // Describing Containers
+        template <typename C>
+        const std::string&  describe(const C& container);
+
+        // Output
+        std::string         str() const;
+        std::string         take();
+        size_t              size() const;
+        DescriptionWriter&  clear();
+        DescriptionWriter&  flush();
+
+    private:
+        template <typename T>
+        void  _value(const T& object, std::integral_constant<int, 0>);
+        template <typename T>
+        void  _value(const T& object, std::integral_constant<int, 1>);
+        template <typename T>
+        void  _value(const T& object, std::integral_constant<int, 2>);
+        template <typename T>
+        void  _value(const T& object, std::integral_constant<int, 3>);
+        template <typename T>
+        void  _value(const T& object, std::integral_constant<int, 4>);
+        template <typename T>
+        void  _integer(const T& object, std::true_type);
+        template <typename T>
+        void  _integer(const T& object, std::false_type);
+        void  _digits(unsigned long long value, bool negative);
+        void  _decimal(const char* buffer, size_t length);
+        void  _flushIfFull(size_t length);
+    };
+
+
+    ////////////////////
+    // IMPLEMENTATION //
+    ////////////////////
+
+    // Constructors
+    inline
+    DescriptionWriter::DescriptionWriter() {
+        // The buffer only grows as far as the text needs, most descriptions are short
+        this->_fd = -1;
+        this->_flush_size = DESCRIPTION_BUFFER_SIZE;
+        this->_head = DESCRIPTION_NO_LIMIT;
+        this->_tail = DESCRIPTION_NO_LIMIT;
+    }
+
+    inline
+    DescriptionWriter::DescriptionWriter(size_t capacity) {
+        this->_buffer.reserve(capacity);
+        this->_fd = -1;
+        this->_flush_size = capacity;
+        this->_head = DESCRIPTION_NO_LIMIT;
+        this->_tail = DESCRIPTION_NO_LIMIT;
+    }
+
+    inline
+    DescriptionWriter::DescriptionWriter(int fd, size_t capacity) : DescriptionWriter(capacity) {
+        this->_fd = fd;
+    }
+
+    inline
+    DescriptionWriter::~DescriptionWriter() {
+        // Errors can not be reported from a destructor, call flush to see them
+        try {
+            this->flush();
+        }
+        catch (...) {
+        }
+    }
+
+
+    // Truncation
+    inline
+    DescriptionWriter& DescriptionWriter::truncate(size_t head, size_t tail) {
+        this->_head = head;
+        this->_tail = tail;
+        return *this;
+    }
+
+    inline
+    bool DescriptionWriter::isTruncated(size_t size) const {
+        if (this->_head == DESCRIPTION_NO_LIMIT || this->_tail == DESCRIPTION_NO_LIMIT) {
+            return false;
+        }
+
+        return size > this->_head && size - this->_head > this->_tail;
+    }
+
+
+    // Writing Text
+    inline
+    DescriptionWriter& DescriptionWriter::write(char character) {
+        this->_flushIfFull(1);
+        this->_buffer.push_back(character);
+        return *this;
+    }
+
+    inline
+    DescriptionWriter& DescriptionWriter::write(const char* string) {
+        return this->write(string, std::strlen(string));
+    }
+
+    inline
+    DescriptionWriter& DescriptionWriter::write(const char* string, size_t length) {
+        this->_flushIfFull(length);
+        this->_buffer.append(string, length);
+        return *this;
+    }
+
+    inline
+    DescriptionWriter& DescriptionWriter::write(const std::string& string) {
+        return this->write(string.data(), string.size());
+    }
+
+
+    // Writing Values
+    inline
+    DescriptionWriter& DescriptionWriter::value(const char* string) {
+        return this->write(string);
+    }
+
+    inline
+    DescriptionWriter& DescriptionWriter::value(const std::string& string) {
+        return this->write(string);
+    }
+
+    inline
+    DescriptionWriter& DescriptionWriter::address(const void* pointer) {
+        // Same format as printing a pointer to a stream
+        if (pointer == nullptr) {
+            return this->write('0');
+        }
+
+        static const char digits[] = "0123456789abcdef";
+        char buffer[2 + sizeof(uintptr_t) * 2];
+        char* end = buffer + sizeof(buffer);
+        char* cursor = end;
+
+        uintptr_t value = reinterpret_cast<uintptr_t>(pointer);
+        while (value != 0) {
+            *--cursor = digits[value & 0xf];
+            value >>= 4;
+        }
+
+        *--cursor = 'x';
+        *--cursor = '0';
+        return this->write(cursor, end - cursor);
+    }
+
+
+    // Output
+    inline
+    std::string DescriptionWriter::str() const {
+        return this->_buffer;
+    }
+
+    inline
+    std::string DescriptionWriter::take() {
+        // Hands the buffer over instead of copying it, the writer starts again empty
+        std::string buffer = std::move(this->_buffer);
+        this->_buffer.clear();
+        return buffer;
+    }
+
+    inline
+    size_t DescriptionWriter::size() const {
+        return this->_buffer.size();
+    }
+
+    inline
+    DescriptionWriter& DescriptionWriter::clear() {
+        this->_buffer.clear();
+        return *this;
+    }
+
+    inline
+    DescriptionWriter& DescriptionWriter::flush() {
+        if (this->_fd < 0) {
+            return *this;
+        }
+
+        size_t offset = 0;
+        while (offset < this->_buffer.size()) {
+            ssize_t written = ::write(this->_fd, this->_buffer.data() + offset, this->_buffer.size() - offset);
+            if (written < 0) {
+                // Interrupted by a signal before anything was written, so try again
+                if (errno == EINTR) continue;
+                throw std::runtime_error("DescriptionWriter: Error writing to file descriptor: " + std::to_string(this->_fd));
+            }
+
+            offset += written;
+        }
+
+        this->_buffer.clear();
+        return *this;
+    }
+
+
+    // Internal Functions
+    inline
+    void DescriptionWriter::_digits(unsigned long long value, bool negative) {
+        char buffer[24];
+        char* end = buffer + sizeof(buffer);
+        char* cursor = end;
+
+        do {
+            *--cursor = char('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+
+        if (negative) {
+            *--cursor = '-';
+        }
+
+        this->write(cursor, end - cursor);
+    }
+
+    inline
+    void DescriptionWriter::_decimal(const char* buffer, size_t length) {
+        // snprintf writes the decimal point of the locale, which may be a comma or more than
+        // one byte. Nothing else it writes is outside these characters, so any other run is it
+        static const char* const allowed = "0123456789+-eEinfaINFA";
+        size_t from = 0;
+        for (size_t i = 0; i < length; ++i) {
+            if (std::strchr(allowed, buffer[i]) != nullptr) continue;
+
+            this->write(buffer + from, i - from).write('.');
+            while (i + 1 < length && std::strchr(allowed, buffer[i + 1]) == nullptr) {
+                ++i;
+            }
+            from = i + 1;
+        }
+
+        this->write(buffer + from, length - from);
+    }
+
+    inline
+    void DescriptionWriter::_flushIfFull(size_t length) {
+        // Only a writer with a file descriptor has a limit, a string buffer just grows
+        if (this->_fd >= 0 && this->_buffer.size() + length > this->_flush_size) {
+            this->flush();
+        }
+    }
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Writing Values
+    template <typename T>
+    DescriptionWriter& DescriptionWriter::value(const T& object) {
+        this->_value(object, std::integral_constant<int, DescriptionKind<T>::value>());
+        return *this;
+    }
+
+
+    // Describing Containers
+    template <typename C>
+    const std::string& DescriptionWriter::describe(const C& container) {
+        this->clear();
+        container.describeTo(*this);
+        return this->_buffer;
+    }
+
+
+    // Writing Containers
+    template <typename It>
+    DescriptionWriter& DescriptionWriter::sequence(It begin, size_t size) {
+        bool truncated = this->isTruncated(size);
+        this->write('[');
+
+        for (size_t i = 0; i < size; ++i) {
+            if (truncated && i == this->_head) {
+                this->write(i == 0 ? "..." : ", ...");
+                i = size - this->_tail;
+                if (i == size) break;
+            }
+
+            if (i != 0) {
+                this->write(", ", 2);
+            }
+
+            this->value(*(begin + i));
+        }
+
+        this->write(']');
+        return *this;
+    }
+
+    template <typename It>
+    DescriptionWriter& DescriptionWriter::mapping(It begin, size_t size) {
+        bool truncated = this->isTruncated(size);
+        this->write('{');
+
+        It it = begin;
+        for (size_t i = 0; i < size; ++i, ++it) {
+            if (truncated && i == this->_head) {
+                this->write(i == 0 ? "..." : ", ...");
+                std::advance(it, size - this->_tail - i);
+                i = size - this->_tail;
+                if (i == size) break;
+            }
+
+            if (i != 0) {
+                this->write(", ", 2);
+            }
+
+            this->value(it->first).write(" => ", 4).value(it->second);
+        }
+
+        this->write('}');
+        return *this;
+    }
+
+
+    // Internal Functions
+    template <typename T>
+    void DescriptionWriter::_value(const T& object, std::integral_constant<int, 0>) {
+        this->write(object ? '1' : '0');
+    }
+
+    template <typename T>
+    void DescriptionWriter::_value(const T& object, std::integral_constant<int, 1>) {
+        this->write(char(object));
+    }
+
+    template <typename T>
+    void DescriptionWriter::_value(const T& object, std::integral_constant<int, 2>) {
+        this->_integer(object, std::is_signed<T>());
+    }
+
+    template <typename T>
+    void DescriptionWriter::_value(const T& object, std::integral_constant<int, 3>) {
+        // Six significant digits, the same as the default stream precision
+        char buffer[64];
+        int length = std::snprintf(buffer, sizeof(buffer), "%Lg", static_cast<long double>(object));
+        this->_decimal(buffer, size_t(length));
+    }
+
+    template <typename T>
+    void DescriptionWriter::_value(const T& object, std::integral_constant<int, 4>) {
+        std::ostringstream oss;
+        oss << object;
+        this->write(oss.str());
+    }
+
+    template <typename T>
+    void DescriptionWriter::_integer(const T& object, std::true_type) {
+        if (object < 0) {
+            this->_digits(0ull - static_cast<unsigned long long>(object), true);
+        }
+        else {
+            this->_digits(static_cast<unsigned long long>(object), false);
+        }
+    }
+
+    template <typename T>
+    void DescriptionWriter::_integer(const T& object, std::false_type) {
+        this->_digits(static_cast<unsigned long long>(object), false);
+    }
+}
+
+#endif // MRLIB_DESCRIPTION_WRITER_HPP
@@ -9,6 +9,29 @@
 /*
  * The purpose of this class was to add a full featured and generic
  * dictionary to C++.
+ *
+ * The storage is a template parameter with the interface of std::map. It
+ * defaults to std::map, which keeps the keys in order. HashDictionary
+ * stores the same objects in an open addressing hash table instead, and
+ * FlatDictionary in sorted arrays.
+ *
+ * Lookups that do not add a key accept any type the storage can search
+ * with. The ordered storage converts it to a key first, while a
+ * HashDictionary with a transparent hash searches with it directly.
+ *
+ * Adding a single key goes through DictionaryInsert, which finds the key
+ * and only builds the object when the key is missing. A hit on an existing
+ * key does not allocate or copy anything.
+ *
+ * addAll, getMany and removeMany hand a whole batch to DictionaryBatch,
+ * which storages specialize to do better than one key at a time. An
+ * ordered storage sorts the batch and walks it in order, and a hash table
+ * prefetches the groups of several keys before probing any of them.
+ *
+ * memoryUsage() reports the bytes a dictionary uses through
+ * DictionaryMemory, which every storage specializes. It does not count
+ * memory that the keys and objects own themselves, like the characters of
+ * a long std::string.
  */
 
 
@@ -20,11 +43,93 @@
 #include <vector>
 #include <string>
 #include <sstream>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+
+#include "DescriptionWriter.hpp"
+
+// Batch Constants
+#define DICTIONARY_BATCH_WALK 8
+
+// Memory Constants
+#define DICTIONARY_TREE_NODE_LINKS (4 * sizeof(void*))   // Colour, parent, left and right of a tree node
+#define DICTIONARY_HEAP_HEADER sizeof(size_t)
+#define DICTIONARY_HEAP_ALIGNMENT 16
 
 
 namespace mrlib {
 
-    template <typename K, typename V>
+    // Finds a key or adds it with the object make() returns, make is only called on a miss
+    template <typename Storage>
+    struct DictionaryInsert {
+        typedef typename Storage::key_type  K;
+        typedef typename Storage::iterator  Iterator;
+
+        template <typename F>
+        static std::pair<Iterator, bool>  findOrEmplace(Storage& storage, const K& key, F make);
+    };
+
+
+    // Searches the tree once and uses the position it found as the hint to add the key
+    template <typename K, typename V, typename Compare, typename Allocator>
+    struct DictionaryInsert<std::map<K, V, Compare, Allocator>> {
+        typedef std::map<K, V, Compare, Allocator>  Storage;
+        typedef typename Storage::iterator          Iterator;
+
+        template <typename F>
+        static std::pair<Iterator, bool>  findOrEmplace(Storage& storage, const K& key, F make);
+    };
+
+
+    // Applies a batch of operations to a storage one key at a time, storages that can do better specialize it
+    template <typename Storage>
+    struct DictionaryBatch {
+        typedef typename Storage::key_type     K;
+        typedef typename Storage::mapped_type  V;
+
+        static void     assign(Storage& storage, std::vector<std::pair<K, V>>& entries);
+        template <typename Map, typename Value>
+        static void     find(Map& storage, const std::vector<K>& keys, std::vector<Value*>& values);
+        static void     erase(Storage& storage, const std::vector<K>& keys);
+        static Storage  merge(const Storage& first, const Storage& second);
+    };
+
+
+    // Sorts the batch and walks the tree in order, so keys close together do not search from the root
+    template <typename K, typename V, typename Compare, typename Allocator>
+    struct DictionaryBatch<std::map<K, V, Compare, Allocator>> {
+        typedef std::map<K, V, Compare, Allocator>  Storage;
+
+        static void     assign(Storage& storage, std::vector<std::pair<K, V>>& entries);
+        template <typename Map, typename Value>
+        static void     find(Map& storage, const std::vector<K>& keys, std::vector<Value*>& values);
+        static void     erase(Storage& storage, const std::vector<K>& keys);
+        static Storage  merge(const Storage& first, const Storage& second);
+
+    private:
+        template <typename Map, typename It>
+        static It                   _seek(Map& storage, It it, const K& key);
+        static std::vector<size_t>  _order(const Storage& storage, const std::vector<K>& keys);
+    };
+
+
+    // Bytes of heap memory a storage uses. This counts the objects only, storages specialize it with their overhead
+    template <typename Storage>
+    struct DictionaryMemory {
+        static size_t  usage(const Storage& storage);
+    };
+
+
+    // Estimates a heap node per key, with the links of the tree and the header and rounding of the allocator
+    template <typename K, typename V, typename Compare, typename Allocator>
+    struct DictionaryMemory<std::map<K, V, Compare, Allocator>> {
+        static size_t  usage(const std::map<K, V, Compare, Allocator>& storage);
+    };
+
+
+    template <typename K, typename V, typename Storage = std::map<K, V>>
     class Dictionary {
     private:
         bool _default_flag;
@@ -32,7 +137,7 @@ namespace mrlib {
 
     public:
         // Internal Data
-        std::map<K, V> _data;
+        Storage _data;
 
         // Constructors
         Dictionary();
@@ -40,40 +145,72 @@ namespace mrlib {
         Dictionary(std::initializer_list<std::pair<const K, V>> i_list);
         Dictionary(const std::map<K, V>& map);
         Dictionary(const std::unordered_map<K, V>& map);
-        Dictionary(const Dictionary<K, V>& dictionary);
+        Dictionary(const Dictionary<K, V, Storage>& dictionary);
+        Dictionary(Dictionary<K, V, Storage>&& dictionary);
 
         // Operator Overloading
-        V&                      operator[](const K& key);
-        Dictionary<K, V>&       operator=(const Dictionary<K, V>& dictionary);
-        const Dictionary<K, V>  operator+(const Dictionary<K, V>& dictionary) const;
-        Dictionary<K, V>&       operator+=(const Dictionary<K, V>& dictionary);
-        bool                    operator==(const Dictionary<K, V>& dictionary) const;
-        bool                    operator!=(const Dictionary<K, V>& dictionary) const;
+        V&                          operator[](const K& key);
+        Dictionary<K, V, Storage>&  operator=(const Dictionary<K, V, Storage>& dictionary);
+        Dictionary<K, V, Storage>&  operator=(Dictionary<K, V, Storage>&& dictionary);
+        Dictionary<K, V, Storage>   operator+(const Dictionary<K, V, Storage>& dictionary) const;
+        Dictionary<K, V, Storage>   operator+(Dictionary<K, V, Storage>&& dictionary) const;
+        Dictionary<K, V, Storage>&  operator+=(const Dictionary<K, V, Storage>& dictionary);
+        Dictionary<K, V, Storage>&  operator+=(Dictionary<K, V, Storage>&& dictionary);
+        bool                        operator==(const Dictionary<K, V, Storage>& dictionary) const;
+        bool                        operator!=(const Dictionary<K, V, Storage>& dictionary) const;
+
+        // Iteration
+        typename Storage::iterator        begin();
+        typename Storage::const_iterator  begin() const;
+        typename Storage::iterator        end();
+        typename Storage::const_iterator  end() const;
 
         // Querying Dictionary
-        V               objectForKey(const K& key);
-        bool            containsKey(const K& key) const;
+        template <typename Key = K>
+        V               objectForKey(const Key& key);
+        template <typename Key = K>
+        V*              tryGet(const Key& key);
+        template <typename Key = K>
+        const V*        tryGet(const Key& key) const;
+        template <typename Key = K>
+        bool            containsKey(const Key& key) const;
         size_t          size() const;
         bool            isEmpty() const;
         bool            hasDefaultValue() const;
         V               getDefaultValue() const;
         std::vector<K>  getKeys() const;
         std::vector<V>  getValues() const;
+        size_t          memoryUsage() const;
 
         // Adding Objects
-        Dictionary<K, V>&  addObject(const K& key, const V& value);
+        Dictionary<K, V, Storage>&  addObject(const K& key, const V& value);
+        template <typename F>
+        V&                          getOrInsert(const K& key, F factory);
+        Dictionary<K, V, Storage>&  insertOrAssign(const K& key, const V& value);
+        template <typename F>
+        Dictionary<K, V, Storage>&  upsert(const K& key, F function);
 
         // Removing Objects
-        Dictionary<K, V>&  remove(const K& key);
-        Dictionary<K, V>&  removeObjects(const std::vector<K>& keys);
-        Dictionary<K, V>&  removeAll();
+        Dictionary<K, V, Storage>&  remove(const K& key);
+        Dictionary<K, V, Storage>&  removeObjects(const std::vector<K>& keys);
+        Dictionary<K, V, Storage>&  removeAll();
 
         // Replace Objects
-        Dictionary<K, V>&  replace(const K& key, const V& new_value);
-        Dictionary<K, V>&  swap(const K& first_key, const K& second_key);
+        Dictionary<K, V, Storage>&  replace(const K& key, const V& new_value);
+        Dictionary<K, V, Storage>&  swap(const K& first_key, const K& second_key);
+
+        // Batch Operations
+        template <typename InputIt>
+        Dictionary<K, V, Storage>&  addAll(InputIt first, InputIt last);
+        template <typename Range>
+        Dictionary<K, V, Storage>&  addAll(const Range& range);
+        Dictionary<K, V, Storage>&  addAll(std::initializer_list<std::pair<const K, V>> i_list);
+        std::vector<V*>             getMany(const std::vector<K>& keys);
+        std::vector<const V*>       getMany(const std::vector<K>& keys) const;
+        Dictionary<K, V, Storage>&  removeMany(const std::vector<K>& keys);
 
         // Comparing Dictionary
-        bool  isEqualTo(const Dictionary<K, V>& dictionary) const;
+        bool  isEqualTo(const Dictionary<K, V, Storage>& dictionary) const;
 
         // Getting Standard Containers
         std::map<K, V>            std_map() const;
@@ -81,10 +218,15 @@ namespace mrlib {
 
         // String Representation
         std::string  description() const;
+        std::string  description(size_t head, size_t tail) const;
+        void         describeTo(DescriptionWriter& writer) const;
         std::string  inspect() const;
 
         // Dictionary Copy
-        Dictionary<K, V>  copy() const;
+        Dictionary<K, V, Storage>  copy() const;
+
+    private:
+        std::pair<typename Storage::iterator, bool>  _insert(const K& key);
     };
 }
 
@@ -96,156 +238,228 @@ namespace mrlib {
 using namespace mrlib;
 
 // Constructors
-template <typename K, typename V>
-Dictionary<K, V>::Dictionary() {
-    this->_data = std::map<K, V>();
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>::Dictionary() {
+    this->_data = Storage();
     this->_default_flag = false;
 }
 
-template <typename K, typename V>
-Dictionary<K, V>::Dictionary(const V& default_value) {
-    this->_data = std::map<K, V>();
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>::Dictionary(const V& default_value) {
+    this->_data = Storage();
     this->_default_flag = true;
     this->_default_value = default_value;
 }
 
-template <typename K, typename V>
-Dictionary<K, V>::Dictionary(const std::map<K, V>& map) {
-    this->_data = map;
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>::Dictionary(const std::map<K, V>& map) {
+    this->_data = Storage(map.begin(), map.end());
     this->_default_flag = false;
 }
 
-template <typename K, typename V>
-Dictionary<K, V>::Dictionary(const std::unordered_map<K, V>& map) {
-    for (auto it = map.begin(); it != map.end(); ++it) {
-        this->_data[it->first] = it->second;
-    }
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>::Dictionary(const std::unordered_map<K, V>& map) {
+    this->_data = Storage(map.begin(), map.end());
     this->_default_flag = false;
 }
 
-template <typename K, typename V>
-Dictionary<K, V>::Dictionary(const Dictionary<K, V>& dictionary) {
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>::Dictionary(const Dictionary<K, V, Storage>& dictionary) {
     this->_data = dictionary._data;
     this->_default_flag = dictionary._default_flag;
     this->_default_value = dictionary._default_value;
 }
 
-template <typename K, typename V>
-Dictionary<K, V>::Dictionary(std::initializer_list<std::pair<const K, V>> i_list) {
-    this->_data = i_list;
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>::Dictionary(Dictionary<K, V, Storage>&& dictionary) {
+    this->_data = std::move(dictionary._data);
+    this->_default_flag = dictionary._default_flag;
+    this->_default_value = std::move(dictionary._default_value);
+}
+
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>::Dictionary(std::initializer_list<std::pair<const K, V>> i_list) {
+    this->_data = Storage(i_list);
     this->_default_flag = false;
 }
 
 
 // Operator Overloading
-template <typename K, typename V>
-V& Dictionary<K, V>::operator[](const K& key) {
-    if (_default_flag && !this->containsKey(key)) {
-        this->_data[key] = this->_default_value;
-        return this->_data[key];
-    }
-    else {
-        return this->_data[key];
-    }
+template <typename K, typename V, typename Storage>
+V& Dictionary<K, V, Storage>::operator[](const K& key) {
+    return this->_insert(key).first->second;
 }
 
-template <typename K, typename V>
-Dictionary<K, V>& Dictionary<K, V>::operator=(const Dictionary<K, V>& dictionary) {
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::operator=(const Dictionary<K, V, Storage>& dictionary) {
     // Check self assignment
     if (this == &dictionary) return *this;
 
     this->_data = dictionary._data;
+    this->_default_flag = dictionary._default_flag;
+    this->_default_value = dictionary._default_value;
     return *this;
 }
 
-template <typename K, typename V>
-const Dictionary<K, V> Dictionary<K, V>::operator+(const Dictionary<K, V>& dictionary) const {
-    Dictionary<K, V> buffer = this->_data;
-    for (auto it : dictionary._data) {
-        buffer[it.first] = it.second;
-    }
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::operator=(Dictionary<K, V, Storage>&& dictionary) {
+    // Check self assignment
+    if (this == &dictionary) return *this;
+
+    this->_data = std::move(dictionary._data);
+    this->_default_flag = dictionary._default_flag;
+    this->_default_value = std::move(dictionary._default_value);
+    return *this;
+}
+
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage> Dictionary<K, V, Storage>::operator+(const Dictionary<K, V, Storage>& dictionary) const {
+    Dictionary<K, V, Storage> buffer = Dictionary<K, V, Storage>();
+    buffer._data = DictionaryBatch<Storage>::merge(this->_data, dictionary._data);
+
+    return buffer;
+}
+
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage> Dictionary<K, V, Storage>::operator+(Dictionary<K, V, Storage>&& dictionary) const {
+    Dictionary<K, V, Storage> buffer = Dictionary<K, V, Storage>();
+    buffer._data = this->_data;
+    buffer += std::move(dictionary);
 
     return buffer;
 }
 
-template <typename K, typename V>
-Dictionary<K, V>& Dictionary<K, V>::operator+=(const Dictionary<K, V>& dictionary) {
-    for (auto it : dictionary._data) {
-        this->_data[it.first] = it.second;
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::operator+=(const Dictionary<K, V, Storage>& dictionary) {
+    return this->addAll(dictionary);
+}
+
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::operator+=(Dictionary<K, V, Storage>&& dictionary) {
+    // Nothing to merge into, so take the other storage as it is
+    if (this->_data.empty()) {
+        this->_data = std::move(dictionary._data);
+        return *this;
+    }
+
+    for (auto&& entry : dictionary._data) {
+        this->_data[entry.first] = std::move(entry.second);
     }
 
     return *this;
 }
 
-template <typename K, typename V>
-bool Dictionary<K, V>::operator==(const Dictionary<K, V>& dictionary) const {
+template <typename K, typename V, typename Storage>
+bool Dictionary<K, V, Storage>::operator==(const Dictionary<K, V, Storage>& dictionary) const {
     return this->_data == dictionary._data;
 }
 
-template <typename K, typename V>
-bool Dictionary<K, V>::operator!=(const Dictionary<K, V>& dictionary) const {
+template <typename K, typename V, typename Storage>
+bool Dictionary<K, V, Storage>::operator!=(const Dictionary<K, V, Storage>& dictionary) const {
     return this->_data != dictionary._data;
 }
 
 
+// Iteration
+template <typename K, typename V, typename Storage>
+typename Storage::iterator Dictionary<K, V, Storage>::begin() {
+    return this->_data.begin();
+}
+
+template <typename K, typename V, typename Storage>
+typename Storage::const_iterator Dictionary<K, V, Storage>::begin() const {
+    return this->_data.begin();
+}
+
+template <typename K, typename V, typename Storage>
+typename Storage::iterator Dictionary<K, V, Storage>::end() {
+    return this->_data.end();
+}
+
+template <typename K, typename V, typename Storage>
+typename Storage::const_iterator Dictionary<K, V, Storage>::end() const {
+    return this->_data.end();
+}
+
+
 // Querying Dictionary
-template <typename K, typename V>
-V Dictionary<K, V>::objectForKey(const K& key) {
-    if (this->_data.count(key) == 1) {
-        return this->_data[key];
+template <typename K, typename V, typename Storage>
+template <typename Key>
+V Dictionary<K, V, Storage>::objectForKey(const Key& key) {
+    auto it = this->_data.find(key);
+    if (it != this->_data.end()) {
+        return it->second;
     }
     else {
         throw std::invalid_argument("Dictionary: Key does not exist in dictionary");
     }
 }
 
-template <typename K, typename V>
-bool Dictionary<K, V>::containsKey(const K& key) const {
-    return this->_data.count(key) == 1;
+template <typename K, typename V, typename Storage>
+template <typename Key>
+V* Dictionary<K, V, Storage>::tryGet(const Key& key) {
+    auto it = this->_data.find(key);
+    return it != this->_data.end() ? &it->second : nullptr;
+}
+
+template <typename K, typename V, typename Storage>
+template <typename Key>
+const V* Dictionary<K, V, Storage>::tryGet(const Key& key) const {
+    auto it = this->_data.find(key);
+    return it != this->_data.end() ? &it->second : nullptr;
 }
 
-template <typename K, typename V>
-size_t Dictionary<K, V>::size() const {
+template <typename K, typename V, typename Storage>
+template <typename Key>
+bool Dictionary<K, V, Storage>::containsKey(const Key& key) const {
+    return this->_data.find(key) != this->_data.end();
+}
+
+template <typename K, typename V, typename Storage>
+size_t Dictionary<K, V, Storage>::size() const {
     return this->_data.size();
 }
 
-template <typename K, typename V>
-bool Dictionary<K, V>::isEmpty() const {
+template <typename K, typename V, typename Storage>
+bool Dictionary<K, V, Storage>::isEmpty() const {
     return this->_data.size() == 0;
 }
 
-template <typename K, typename V>
-bool Dictionary<K, V>::hasDefaultValue() const {
+template <typename K, typename V, typename Storage>
+bool Dictionary<K, V, Storage>::hasDefaultValue() const {
     return this->_default_flag;
 }
 
-template <typename K, typename V>
-V Dictionary<K, V>::getDefaultValue() const {
+template <typename K, typename V, typename Storage>
+V Dictionary<K, V, Storage>::getDefaultValue() const {
     if (this->_default_flag)
         return this->_default_value;
     else
         return V();
 }
 
-template <typename K, typename V>
-std::vector<K> Dictionary<K, V>::getKeys() const {
-    std::vector<K> keys = std::vector<K>(this->_data.size());
-    size_t index = 0;
-    for (auto it = this->_data.begin(); it != this->_data.end(); ++it) {
-        keys[index] = it->first;
-        ++index;
+template <typename K, typename V, typename Storage>
+size_t Dictionary<K, V, Storage>::memoryUsage() const {
+    return sizeof(*this) + DictionaryMemory<Storage>::usage(this->_data);
+}
+
+template <typename K, typename V, typename Storage>
+std::vector<K> Dictionary<K, V, Storage>::getKeys() const {
+    std::vector<K> keys = std::vector<K>();
+    keys.reserve(this->_data.size());
+    for (const auto& entry : this->_data) {
+        keys.push_back(entry.first);
     }
 
     return keys;
 }
 
-template <typename K, typename V>
-std::vector<V> Dictionary<K, V>::getValues() const {
-    std::vector<V> values = std::vector<V>(this->_data.size());
-    size_t index = 0;
-    for (auto it = this->_data.begin(); it != this->_data.end(); ++it) {
-        values[index] = it->second;
-        ++index;
+template <typename K, typename V, typename Storage>
+std::vector<V> Dictionary<K, V, Storage>::getValues() const {
+    std::vector<V> values = std::vector<V>();
+    values.reserve(this->_data.size());
+    for (const auto& entry : this->_data) {
+        values.push_back(entry.second);
     }
 
     return values;
@@ -253,10 +467,9 @@ std::vector<V> Dictionary<K, V>::getValues() const {
 
 
 // Adding Objects
-template <typename K, typename V>
-Dictionary<K, V>& Dictionary<K, V>::addObject(const K& key, const V& value) {
-    if (this->_data.count(key) == 0) {
-        this->_data[key] = value;
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::addObject(const K& key, const V& value) {
+    if (DictionaryInsert<Storage>::findOrEmplace(this->_data, key, [&value]() { return value; }).second) {
         return *this;
     }
     else {
@@ -264,35 +477,55 @@ Dictionary<K, V>& Dictionary<K, V>::addObject(const K& key, const V& value) {
     }
 }
 
+template <typename K, typename V, typename Storage>
+template <typename F>
+V& Dictionary<K, V, Storage>::getOrInsert(const K& key, F factory) {
+    return DictionaryInsert<Storage>::findOrEmplace(this->_data, key, factory).first->second;
+}
+
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::insertOrAssign(const K& key, const V& value) {
+    auto result = DictionaryInsert<Storage>::findOrEmplace(this->_data, key, [&value]() { return value; });
+    if (!result.second) {
+        result.first->second = value;
+    }
 
-// Removing Objects
-template <typename K, typename V>
-Dictionary<K, V>& Dictionary<K, V>::remove(const K& key) {
-    this->_data.erase(key);
     return *this;
 }
 
-template <typename K, typename V>
-Dictionary<K, V>& Dictionary<K, V>::removeObjects(const std::vector<K>& keys) {
-    for (const K& key : keys) {
-        this->_data.erase(key);
-    }
+template <typename K, typename V, typename Storage>
+template <typename F>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::upsert(const K& key, F function) {
+    function(this->_insert(key).first->second);
+    return *this;
+}
+
 
+// Removing Objects
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::remove(const K& key) {
+    this->_data.erase(key);
     return *this;
 }
 
-template <typename K, typename V>
-Dictionary<K, V>& Dictionary<K, V>::removeAll() {
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::removeObjects(const std::vector<K>& keys) {
+    return this->removeMany(keys);
+}
+
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::removeAll() {
     this->_data.clear();
     return *this;
 }
 
 
 // Replace Objects
-template <typename K, typename V>
-Dictionary<K, V>& Dictionary<K, V>::replace(const K& key, const V& new_value) {
-    if (this->_data.count(key) == 1) {
-        this->_data[key] = new_value;
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::replace(const K& key, const V& new_value) {
+    auto it = this->_data.find(key);
+    if (it != this->_data.end()) {
+        it->second = new_value;
         return *this;
     }
     else {
@@ -300,12 +533,13 @@ Dictionary<K, V>& Dictionary<K, V>::replace(const K& key, const V& new_value) {
     }
 }
 
-template <typename K, typename V>
-Dictionary<K, V>& Dictionary<K, V>::swap(const K& first_key, const K& second_key) {
-    if (this->_data.count(first_key) == 1 && this->_data.count(second_key) == 1) {
-        V first = this->_data[first_key];
-        this->_data[first_key] = this->_data[second_key];
-        this->_data[second_key] = first;
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::swap(const K& first_key, const K& second_key) {
+    auto first = this->_data.find(first_key);
+    auto second = this->_data.find(second_key);
+
+    if (first != this->_data.end() && second != this->_data.end()) {
+        std::swap(first->second, second->second);
         return *this;
     }
     else {
@@ -314,73 +548,296 @@ Dictionary<K, V>& Dictionary<K, V>::swap(const K& first_key, const K& second_key
 }
 
 
+// Batch Operations
+template <typename K, typename V, typename Storage>
+template <typename InputIt>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::addAll(InputIt first, InputIt last) {
+    // Later entries win over earlier ones with the same key, as if they were added one at a time
+    std::vector<std::pair<K, V>> entries = std::vector<std::pair<K, V>>(first, last);
+    DictionaryBatch<Storage>::assign(this->_data, entries);
+    return *this;
+}
+
+template <typename K, typename V, typename Storage>
+template <typename Range>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::addAll(const Range& range) {
+    return this->addAll(std::begin(range), std::end(range));
+}
+
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::addAll(std::initializer_list<std::pair<const K, V>> i_list) {
+    return this->addAll(i_list.begin(), i_list.end());
+}
+
+template <typename K, typename V, typename Storage>
+std::vector<V*> Dictionary<K, V, Storage>::getMany(const std::vector<K>& keys) {
+    // The object of each key in the same order, nullptr for keys that do not exist
+    std::vector<V*> values = std::vector<V*>();
+    DictionaryBatch<Storage>::find(this->_data, keys, values);
+    return values;
+}
+
+template <typename K, typename V, typename Storage>
+std::vector<const V*> Dictionary<K, V, Storage>::getMany(const std::vector<K>& keys) const {
+    std::vector<const V*> values = std::vector<const V*>();
+    DictionaryBatch<Storage>::find(this->_data, keys, values);
+    return values;
+}
+
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage>& Dictionary<K, V, Storage>::removeMany(const std::vector<K>& keys) {
+    DictionaryBatch<Storage>::erase(this->_data, keys);
+    return *this;
+}
+
+
 // Comparing Dictionary
-template <typename K, typename V>
-bool Dictionary<K, V>::isEqualTo(const Dictionary<K, V>& dictionary) const {
+template <typename K, typename V, typename Storage>
+bool Dictionary<K, V, Storage>::isEqualTo(const Dictionary<K, V, Storage>& dictionary) const {
     return this->_data == dictionary._data;
 }
 
 
 // Getting Standard Containers
-template <typename K, typename V>
-std::map<K, V> Dictionary<K, V>::std_map() const {
-    return this->_data;
+template <typename K, typename V, typename Storage>
+std::map<K, V> Dictionary<K, V, Storage>::std_map() const {
+    return std::map<K, V>(this->_data.begin(), this->_data.end());
 }
 
-template <typename K, typename V>
-std::unordered_map<K, V> Dictionary<K, V>::std_unordered_map() const {
-    std::unordered_map<K, V> hash_map = std::unordered_map<K, V>();
-    for (auto it : this->_data) {
-        hash_map[it.first] = it.second;
-    }
+template <typename K, typename V, typename Storage>
+std::unordered_map<K, V> Dictionary<K, V, Storage>::std_unordered_map() const {
+    std::unordered_map<K, V> hash_map = std::unordered_map<K, V>(this->_data.begin(), this->_data.end(), this->_data.size());
 
     return hash_map;
 }
 
 
 // String Representation
-template <typename K, typename V>
-std::string Dictionary<K, V>::description() const {
-    std::ostringstream oss;
-    oss << "{";
-
-    size_t last = this->_data.size() - 1;
-    size_t i = 0;
-
-    for (auto it = this->_data.begin(); it != this->_data.end(); ++it) {
-        oss << it->first << " => " << it->second;
+template <typename K, typename V, typename Storage>
+std::string Dictionary<K, V, Storage>::description() const {
+    DescriptionWriter writer;
+    this->describeTo(writer);
+    return writer.take();
+}
 
-        if (i != last) {
-            oss << ", ";
-            ++i;
-        }
-    }
+template <typename K, typename V, typename Storage>
+std::string Dictionary<K, V, Storage>::description(size_t head, size_t tail) const {
+    DescriptionWriter writer;
+    writer.truncate(head, tail);
+    this->describeTo(writer);
+    return writer.take();
+}
 
-    oss << "}";
-    return oss.str();
+template <typename K, typename V, typename Storage>
+void Dictionary<K, V, Storage>::describeTo(DescriptionWriter& writer) const {
+    writer.mapping(this->_data.begin(), this->_data.size());
 }
 
-template <typename K, typename V>
-std::string Dictionary<K, V>::inspect() const {
-    std::ostringstream oss;
+template <typename K, typename V, typename Storage>
+std::string Dictionary<K, V, Storage>::inspect() const {
+    DescriptionWriter writer;
 
     // Dictionary Address
-    oss << "Address: " << this << " ";
+    writer.write("Address: ").address(this).write(' ');
 
     // Dictionary Size
-    oss << "Size: " << this->_data.size() << " ";
+    writer.write("Size: ").value(this->_data.size()).write(' ');
 
     // Dictionary Contents
-    oss << this->description();
+    this->describeTo(writer);
 
-    return oss.str();
+    return writer.take();
 }
 
 
 // Dictionary Copy
-template <typename K, typename V>
-Dictionary<K, V> Dictionary<K, V>::copy() const {
-    return Dictionary<K, V>(this->_data);
+template <typename K, typename V, typename Storage>
+Dictionary<K, V, Storage> Dictionary<K, V, Storage>::copy() const {
+    Dictionary<K, V, Storage> dictionary = Dictionary<K, V, Storage>();
+    dictionary._data = this->_data;
+    return dictionary;
+}
+
+
+// Internal Functions
+template <typename K, typename V, typename Storage>
+std::pair<typename Storage::iterator, bool> Dictionary<K, V, Storage>::_insert(const K& key) {
+    // Finds the key or adds it with the default value in a single lookup
+    return DictionaryInsert<Storage>::findOrEmplace(this->_data, key, [this]() { return this->_default_flag ? this->_default_value : V(); });
+}
+
+
+// Storage Insert
+template <typename Storage>
+template <typename F>
+std::pair<typename Storage::iterator, bool> DictionaryInsert<Storage>::findOrEmplace(Storage& storage, const K& key, F make) {
+    auto it = storage.find(key);
+    if (it != storage.end()) {
+        return std::make_pair(it, false);
+    }
+
+    return storage.emplace(key, make());
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+template <typename F>
+std::pair<typename std::map<K, V, Compare, Allocator>::iterator, bool> DictionaryInsert<std::map<K, V, Compare, Allocator>>::findOrEmplace(Storage& storage, const K& key, F make) {
+    auto it = storage.lower_bound(key);
+    if (it != storage.end() && !storage.key_comp()(key, it->first)) {
+        return std::make_pair(it, false);
+    }
+
+    return std::make_pair(storage.emplace_hint(it, key, make()), true);
+}
+
+
+// Batch Storage
+template <typename Storage>
+void DictionaryBatch<Storage>::assign(Storage& storage, std::vector<std::pair<K, V>>& entries) {
+    for (std::pair<K, V>& entry : entries) {
+        storage[entry.first] = std::move(entry.second);
+    }
+}
+
+template <typename Storage>
+template <typename Map, typename Value>
+void DictionaryBatch<Storage>::find(Map& storage, const std::vector<K>& keys, std::vector<Value*>& values) {
+    values.assign(keys.size(), nullptr);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto it = storage.find(keys[i]);
+        if (it != storage.end()) {
+            values[i] = &it->second;
+        }
+    }
+}
+
+template <typename Storage>
+void DictionaryBatch<Storage>::erase(Storage& storage, const std::vector<K>& keys) {
+    for (const K& key : keys) {
+        storage.erase(key);
+    }
+}
+
+template <typename Storage>
+Storage DictionaryBatch<Storage>::merge(const Storage& first, const Storage& second) {
+    Storage storage = first;
+    for (const auto& entry : second) {
+        storage[entry.first] = entry.second;
+    }
+
+    return storage;
+}
+
+
+// Batch Ordered Storage
+template <typename K, typename V, typename Compare, typename Allocator>
+void DictionaryBatch<std::map<K, V, Compare, Allocator>>::assign(Storage& storage, std::vector<std::pair<K, V>>& entries) {
+    Compare compare = storage.key_comp();
+    auto less = [&compare](const std::pair<K, V>& a, const std::pair<K, V>& b) { return compare(a.first, b.first); };
+    if (!std::is_sorted(entries.begin(), entries.end(), less)) {
+        std::stable_sort(entries.begin(), entries.end(), less);
+    }
+
+    // The hint is always where the key belongs, so adding it does not search the tree again
+    auto hint = storage.begin();
+    for (std::pair<K, V>& entry : entries) {
+        hint = _seek(storage, hint, entry.first);
+        if (hint != storage.end() && !compare(entry.first, hint->first)) {
+            hint->second = std::move(entry.second);
+        }
+        else {
+            hint = storage.emplace_hint(hint, std::move(entry.first), std::move(entry.second));
+        }
+    }
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+template <typename Map, typename Value>
+void DictionaryBatch<std::map<K, V, Compare, Allocator>>::find(Map& storage, const std::vector<K>& keys, std::vector<Value*>& values) {
+    Compare compare = storage.key_comp();
+    values.assign(keys.size(), nullptr);
+
+    auto it = storage.begin();
+    for (size_t index : _order(storage, keys)) {
+        it = _seek(storage, it, keys[index]);
+        if (it != storage.end() && !compare(keys[index], it->first)) {
+            values[index] = &it->second;
+        }
+    }
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+void DictionaryBatch<std::map<K, V, Compare, Allocator>>::erase(Storage& storage, const std::vector<K>& keys) {
+    Compare compare = storage.key_comp();
+
+    auto it = storage.begin();
+    for (size_t index : _order(storage, keys)) {
+        it = _seek(storage, it, keys[index]);
+        if (it != storage.end() && !compare(keys[index], it->first)) {
+            it = storage.erase(it);
+        }
+    }
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+std::map<K, V, Compare, Allocator> DictionaryBatch<std::map<K, V, Compare, Allocator>>::merge(const Storage& first, const Storage& second) {
+    Compare compare = first.key_comp();
+    Storage storage = Storage(compare);
+
+    // Every key is larger than the one before, so adding at the end is constant time
+    auto a = first.begin();
+    auto b = second.begin();
+    while (a != first.end() || b != second.end()) {
+        if (b == second.end() || (a != first.end() && compare(a->first, b->first))) {
+            storage.emplace_hint(storage.end(), *a++);
+        }
+        else {
+            if (a != first.end() && !compare(b->first, a->first)) ++a;
+            storage.emplace_hint(storage.end(), *b++);
+        }
+    }
+
+    return storage;
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+template <typename Map, typename It>
+It DictionaryBatch<std::map<K, V, Compare, Allocator>>::_seek(Map& storage, It it, const K& key) {
+    // Finds the first key not less than this one, walking a few keys before searching from the root
+    Compare compare = storage.key_comp();
+    for (size_t step = 0; step < DICTIONARY_BATCH_WALK; ++step) {
+        if (it == storage.end() || !compare(it->first, key)) {
+            return it;
+        }
+        ++it;
+    }
+
+    return storage.lower_bound(key);
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+std::vector<size_t> DictionaryBatch<std::map<K, V, Compare, Allocator>>::_order(const Storage& storage, const std::vector<K>& keys) {
+    Compare compare = storage.key_comp();
+    std::vector<size_t> order = std::vector<size_t>(keys.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+
+    std::sort(order.begin(), order.end(), [&compare, &keys](size_t a, size_t b) { return compare(keys[a], keys[b]); });
+    return order;
+}
+
+
+// Storage Memory
+template <typename Storage>
+size_t DictionaryMemory<Storage>::usage(const Storage& storage) {
+    return storage.size() * sizeof(typename Storage::value_type);
+}
+
+template <typename K, typename V, typename Compare, typename Allocator>
+size_t DictionaryMemory<std::map<K, V, Compare, Allocator>>::usage(const std::map<K, V, Compare, Allocator>& storage) {
+    size_t node = DICTIONARY_TREE_NODE_LINKS + sizeof(std::pair<const K, V>) + DICTIONARY_HEAP_HEADER;
+    return storage.size() * ((node + DICTIONARY_HEAP_ALIGNMENT - 1) / DICTIONARY_HEAP_ALIGNMENT * DICTIONARY_HEAP_ALIGNMENT);
 }
 
 #endif // MRLIB_DICTIONARY_HPP
\ No newline at end of file
@@ -0,0 +1,535 @@
+//
+// DictionaryFile.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to write a Dictionary to a file once and
+ * look keys up in it many times without loading it first. The file is a
+ * fixed size header, a hash index, and the entries sorted by their keys
+ * with std::less, the order of a Dictionary. Each entry is the length of
+ * its key and object followed by their bytes, and each slot of the index
+ * holds the hash of a key and the offset of its entry, probed linearly
+ * from the slot the hash gives. Writing streams the header, the index
+ * and the entries to the file through a small buffer, without building
+ * the whole file in memory first.
+ *
+ * DictionaryFile::map maps the file as a read only MappedDictionary.
+ * Opening it only checks the header, so it takes the same time for any
+ * size of file, and a lookup reads one run of the index and the one
+ * entry it points at. The bytes of an object can be read straight from
+ * the mapping with tryGetBytes, or copied out as an object with tryGet.
+ *
+ * Keys and objects are stored as bytes through DictionaryFileBytes,
+ * which supports std::string, String and arithmetic types and can be
+ * specialized for others. Keys are hashed and compared by their bytes,
+ * so a struct with padding needs a specialization that writes only its
+ * members. Like ArrayFile, the header records the byte order of the
+ * machine that wrote the file, and files written with a different byte
+ * order are rejected.
+ */
+
+
+#ifndef MRLIB_DICTIONARY_FILE_HPP
+#define MRLIB_DICTIONARY_FILE_HPP
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ArrayFile.hpp"
+#include "Dictionary.hpp"
+
+// File format constants
+#define DICTIONARY_FILE_MAGIC "MRDI"
+#define DICTIONARY_FILE_VERSION 1u
+#define DICTIONARY_FILE_MAX_LOAD 0.5
+#define DICTIONARY_FILE_WRITE_BUFFER (1 << 16)
+
+// File format exceptions
+#define DICTIONARY_FILE_INV_FORMAT std::invalid_argument("DictionaryFile: Invalid file format")
+#define DICTIONARY_FILE_INV_ENDIAN std::invalid_argument("DictionaryFile: File was written with a different byte order")
+#define DICTIONARY_FILE_INV_TYPE std::invalid_argument("DictionaryFile: Key or object type does not match file")
+#define DICTIONARY_FILE_INV_LENGTH std::invalid_argument("DictionaryFile: Key or object is too long to be stored")
+#define DICTIONARY_FILE_MISSING_KEY std::invalid_argument("DictionaryFile: Key does not exist in dictionary")
+
+namespace mrlib {
+
+    struct DictionaryFileHeader {
+        char      magic[4];
+        uint32_t  endian;
+        uint32_t  version;
+        uint32_t  flags;
+        uint64_t  count;
+        uint64_t  slot_count;   // Always a power of two, the entries start right after the slots
+    };
+
+    struct DictionaryFileSlot {
+        uint64_t  hash;
+        uint64_t  offset;       // Zero for an empty slot, since no entry starts inside the header
+    };
+
+
+    // An entry laid out for writing, its slices point into the dictionary
+    template <typename K>
+    struct DictionaryFileEntry {
+        const K*          object;
+        ArraySlice<char>  key;
+        ArraySlice<char>  value;
+        uint64_t          hash;
+        uint32_t          lengths[2];
+    };
+
+
+    // Byte conversion hook, specialize for other types of keys and objects
+    template <typename T, typename Enable = void>
+    struct DictionaryFileBytes;
+
+    template <typename T>
+    struct DictionaryFileBytes<T, typename std::enable_if<std::is_arithmetic<T>::value>::type> {
+        static ArraySlice<char> bytes(const T& object) {
+            return ArraySlice<char>(reinterpret_cast<const char*>(&object), sizeof(T));
+        }
+
+        static T read(const char* bytes, size_t length) {
+            if (length != sizeof(T)) {
+                throw DICTIONARY_FILE_INV_TYPE;
+            }
+
+            // Entries are not aligned, so the object is copied out rather than cast
+            T object;
+            std::memcpy(&object, bytes, sizeof(T));
+            return object;
+        }
+    };
+
+    template <>
+    struct DictionaryFileBytes<std::string> {
+        static ArraySlice<char> bytes(const std::string& object) {
+            return ArraySlice<char>(object.data(), object.size());
+        }
+
+        static std::string read(const char* bytes, size_t length) {
+            return std::string(bytes, length);
+        }
+    };
+
+    template <>
+    struct DictionaryFileBytes<String> {
+        static ArraySlice<char> bytes(const String& object) {
+            return DictionaryFileBytes<std::string>::bytes(object._data);
+        }
+
+        static String read(const char* bytes, size_t length) {
+            return String(std::string(bytes, length));
+        }
+    };
+
+
+    // Zero copy view of a dictionary file
+    template <typename K, typename V>
+    class MappedDictionary {
+    public:
+        // Internal Data
+        ArrayFileMapping           _mapping;
+        const DictionaryFileSlot*  _slots;
+        size_t                     _slot_count;
+        size_t                     _size;
+
+        // Constructors
+        MappedDictionary();
+        MappedDictionary(ArrayFileMapping&& mapping, const DictionaryFileSlot* slots, size_t slot_count, size_t size);
+
+        // Querying Dictionary
+        V               objectForKey(const K& key) const;
+        bool            tryGet(const K& key, V& value) const;
+        bool            tryGetBytes(const K& key, ArraySlice<char>& bytes) const;
+        bool            containsKey(const K& key) const;
+        size_t          size() const;
+        bool            isEmpty() const;
+        std::vector<K>  getKeys() const;
+        std::vector<V>  getValues() const;
+
+        // Getting Containers
+        Dictionary<K, V>  copy() const;
+
+    private:
+        template <typename F>
+        void         _forEach(F function) const;
+        const char*  _entry(uint64_t offset, ArraySlice<char>& key, ArraySlice<char>& value) const;
+    };
+
+
+    class DictionaryFile {
+    public:
+        // Serializing Dictionaries
+        template <typename K, typename V, typename Storage>
+        static std::string       serialize(const Dictionary<K, V, Storage>& dictionary);
+
+        // Reading and Writing Files
+        template <typename K, typename V, typename Storage>
+        static void              write(const std::string& path, const Dictionary<K, V, Storage>& dictionary);
+        template <typename K, typename V>
+        static Dictionary<K, V>  read(const std::string& path);
+        template <typename K, typename V>
+        static MappedDictionary<K, V>  map(const std::string& path);
+
+        // Hashing Keys
+        static uint64_t  hash(const char* bytes, size_t length);
+
+    private:
+        static const DictionaryFileSlot*  _validate(const char* bytes, size_t length, DictionaryFileHeader& header);
+        template <typename K, typename V, typename Storage>
+        static uint64_t                   _layout(const Dictionary<K, V, Storage>& dictionary, DictionaryFileHeader& header,
+                                                  std::vector<DictionaryFileSlot>& slots, std::vector<DictionaryFileEntry<K>>& entries);
+    };
+
+
+    ////////////////////
+    // IMPLEMENTATION //
+    ////////////////////
+
+    // Hashing Keys
+    inline
+    uint64_t DictionaryFile::hash(const char* bytes, size_t length) {
+        // FNV-1a with a final mix, since the low bits pick the slot. This is
+        // part of the file format, so it must not depend on std::hash
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < length; ++i) {
+            hash ^= uint64_t(static_cast<unsigned char>(bytes[i]));
+            hash *= 1099511628211ull;
+        }
+
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+
+    // Internal Functions
+    inline
+    const DictionaryFileSlot* DictionaryFile::_validate(const char* bytes, size_t length, DictionaryFileHeader& header) {
+        if (length < sizeof(DictionaryFileHeader)) {
+            throw DICTIONARY_FILE_INV_FORMAT;
+        }
+
+        std::memcpy(&header, bytes, sizeof(header));
+
+        if (std::memcmp(header.magic, DICTIONARY_FILE_MAGIC, sizeof(header.magic)) != 0 || header.version != DICTIONARY_FILE_VERSION) {
+            throw DICTIONARY_FILE_INV_FORMAT;
+        }
+
+        if (header.endian != ARRAY_FILE_ENDIAN_MARK) {
+            throw DICTIONARY_FILE_INV_ENDIAN;
+        }
+
+        // Only the index is checked here, each entry is checked when it is read
+        if (header.slot_count == 0 || (header.slot_count & (header.slot_count - 1)) != 0 ||
+            header.count >= header.slot_count || (length - sizeof(header)) / sizeof(DictionaryFileSlot) < header.slot_count) {
+            throw DICTIONARY_FILE_INV_FORMAT;
+        }
+
+        return reinterpret_cast<const DictionaryFileSlot*>(bytes + sizeof(header));
+    }
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename K, typename V>
+    MappedDictionary<K, V>::MappedDictionary() {
+        this->_slots = nullptr;
+        this->_slot_count = 0;
+        this->_size = 0;
+    }
+
+    template <typename K, typename V>
+    MappedDictionary<K, V>::MappedDictionary(ArrayFileMapping&& mapping, const DictionaryFileSlot* slots, size_t slot_count, size_t size) : _mapping(std::move(mapping)) {
+        this->_slots = slots;
+        this->_slot_count = slot_count;
+        this->_size = size;
+    }
+
+
+    // Querying Dictionary
+    template <typename K, typename V>
+    V MappedDictionary<K, V>::objectForKey(const K& key) const {
+        ArraySlice<char> bytes;
+        if (!this->tryGetBytes(key, bytes)) {
+            throw DICTIONARY_FILE_MISSING_KEY;
+        }
+
+        return DictionaryFileBytes<V>::read(bytes._begin, bytes._size);
+    }
+
+    template <typename K, typename V>
+    bool MappedDictionary<K, V>::tryGet(const K& key, V& value) const {
+        ArraySlice<char> bytes;
+        if (!this->tryGetBytes(key, bytes)) {
+            return false;
+        }
+
+        value = DictionaryFileBytes<V>::read(bytes._begin, bytes._size);
+        return true;
+    }
+
+    template <typename K, typename V>
+    bool MappedDictionary<K, V>::tryGetBytes(const K& key, ArraySlice<char>& bytes) const {
+        if (this->_slot_count == 0) return false;
+
+        ArraySlice<char> search = DictionaryFileBytes<K>::bytes(key);
+        uint64_t hash = DictionaryFile::hash(search._begin, search._size);
+        size_t mask = this->_slot_count - 1;
+
+        // A written index is never full, so every run of slots ends at an empty one. The probe is still
+        // bounded, since opening does not read the index and a damaged file may have no empty slot
+        size_t i = size_t(hash) & mask;
+        for (size_t step = 0; step < this->_slot_count && this->_slots[i].offset != 0; ++step, i = (i + 1) & mask) {
+            if (this->_slots[i].hash != hash) continue;
+
+            ArraySlice<char> found;
+            ArraySlice<char> value;
+            this->_entry(this->_slots[i].offset, found, value);
+            if (found._size == search._size && std::memcmp(found._begin, search._begin, search._size) == 0) {
+                bytes = value;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template <typename K, typename V>
+    bool MappedDictionary<K, V>::containsKey(const K& key) const {
+        ArraySlice<char> bytes;
+        return this->tryGetBytes(key, bytes);
+    }
+
+    template <typename K, typename V>
+    size_t MappedDictionary<K, V>::size() const {
+        return this->_size;
+    }
+
+    template <typename K, typename V>
+    bool MappedDictionary<K, V>::isEmpty() const {
+        return this->_size == 0;
+    }
+
+    template <typename K, typename V>
+    std::vector<K> MappedDictionary<K, V>::getKeys() const {
+        std::vector<K> keys = std::vector<K>();
+        keys.reserve(this->_size);
+        this->_forEach([&](const ArraySlice<char>& key, const ArraySlice<char>&) {
+            keys.push_back(DictionaryFileBytes<K>::read(key._begin, key._size));
+        });
+
+        return keys;
+    }
+
+    template <typename K, typename V>
+    std::vector<V> MappedDictionary<K, V>::getValues() const {
+        std::vector<V> values = std::vector<V>();
+        values.reserve(this->_size);
+        this->_forEach([&](const ArraySlice<char>&, const ArraySlice<char>& value) {
+            values.push_back(DictionaryFileBytes<V>::read(value._begin, value._size));
+        });
+
+        return values;
+    }
+
+
+    // Getting Containers
+    template <typename K, typename V>
+    Dictionary<K, V> MappedDictionary<K, V>::copy() const {
+        Dictionary<K, V> dictionary = Dictionary<K, V>();
+        this->_forEach([&](const ArraySlice<char>& key, const ArraySlice<char>& value) {
+            dictionary._data.emplace_hint(dictionary._data.end(), DictionaryFileBytes<K>::read(key._begin, key._size), DictionaryFileBytes<V>::read(value._begin, value._size));
+        });
+
+        return dictionary;
+    }
+
+
+    // Internal Functions
+    template <typename K, typename V>
+    template <typename F>
+    void MappedDictionary<K, V>::_forEach(F function) const {
+        // The entries follow each other in key order, starting after the index
+        uint64_t offset = sizeof(DictionaryFileHeader) + this->_slot_count * sizeof(DictionaryFileSlot);
+        for (size_t i = 0; i < this->_size; ++i) {
+            ArraySlice<char> key;
+            ArraySlice<char> value;
+            offset = uint64_t(this->_entry(offset, key, value) - this->_mapping.data());
+            function(key, value);
+        }
+    }
+
+    template <typename K, typename V>
+    const char* MappedDictionary<K, V>::_entry(uint64_t offset, ArraySlice<char>& key, ArraySlice<char>& value) const {
+        uint64_t length = this->_mapping.size();
+        if (offset > length || length - offset < 2 * sizeof(uint32_t)) {
+            throw DICTIONARY_FILE_INV_FORMAT;
+        }
+
+        const char* cursor = this->_mapping.data() + offset;
+        uint32_t key_length;
+        uint32_t value_length;
+        std::memcpy(&key_length, cursor, sizeof(uint32_t));
+        std::memcpy(&value_length, cursor + sizeof(uint32_t), sizeof(uint32_t));
+        cursor += 2 * sizeof(uint32_t);
+
+        if (length - offset - 2 * sizeof(uint32_t) < uint64_t(key_length) + value_length) {
+            throw DICTIONARY_FILE_INV_FORMAT;
+        }
+
+        key = ArraySlice<char>(cursor, key_length);
+        value = ArraySlice<char>(cursor + key_length, value_length);
+        return cursor + key_length + value_length;
+    }
+
+
+    // Serializing Dictionaries
+    template <typename K, typename V, typename Storage>
+    std::string DictionaryFile::serialize(const Dictionary<K, V, Storage>& dictionary) {
+        DictionaryFileHeader header;
+        std::vector<DictionaryFileSlot> slots;
+        std::vector<DictionaryFileEntry<K>> entries;
+        uint64_t length = DictionaryFile::_layout(dictionary, header, slots, entries);
+
+        std::string buffer = std::string();
+        buffer.reserve(size_t(length));
+        buffer.append(reinterpret_cast<const char*>(&header), sizeof(header));
+        buffer.append(reinterpret_cast<const char*>(slots.data()), slots.size() * sizeof(DictionaryFileSlot));
+
+        for (const DictionaryFileEntry<K>& entry : entries) {
+            buffer.append(reinterpret_cast<const char*>(entry.lengths), sizeof(entry.lengths));
+            buffer.append(entry.key._begin, entry.key._size);
+            buffer.append(entry.value._begin, entry.value._size);
+        }
+
+        return buffer;
+    }
+
+
+    // Reading and Writing Files
+    template <typename K, typename V, typename Storage>
+    void DictionaryFile::write(const std::string& path, const Dictionary<K, V, Storage>& dictionary) {
+        DictionaryFileHeader header;
+        std::vector<DictionaryFileSlot> slots;
+        std::vector<DictionaryFileEntry<K>> entries;
+        DictionaryFile::_layout(dictionary, header, slots, entries);
+
+        ArrayFileWriter writer(path);
+        struct iovec parts[3] = {{&header, sizeof(header)}, {slots.data(), slots.size() * sizeof(DictionaryFileSlot)}};
+        writer.write(parts, 2);
+
+        // Small entries are gathered into a bounded buffer, larger ones are written straight from the dictionary
+        std::string buffer = std::string();
+        buffer.reserve(DICTIONARY_FILE_WRITE_BUFFER);
+        for (const DictionaryFileEntry<K>& entry : entries) {
+            size_t length = sizeof(entry.lengths) + entry.key._size + entry.value._size;
+            if (buffer.size() + length > DICTIONARY_FILE_WRITE_BUFFER) {
+                writer.write(buffer.data(), buffer.size());
+                buffer.clear();
+            }
+
+            if (length > DICTIONARY_FILE_WRITE_BUFFER) {
+                parts[0] = {const_cast<uint32_t*>(entry.lengths), sizeof(entry.lengths)};
+                parts[1] = {const_cast<char*>(entry.key._begin), entry.key._size};
+                parts[2] = {const_cast<char*>(entry.value._begin), entry.value._size};
+                writer.write(parts, 3);
+                continue;
+            }
+
+            buffer.append(reinterpret_cast<const char*>(entry.lengths), sizeof(entry.lengths));
+            buffer.append(entry.key._begin, entry.key._size);
+            buffer.append(entry.value._begin, entry.value._size);
+        }
+
+        writer.write(buffer.data(), buffer.size());
+        writer.commit();
+    }
+
+    template <typename K, typename V>
+    Dictionary<K, V> DictionaryFile::read(const std::string& path) {
+        return DictionaryFile::map<K, V>(path).copy();
+    }
+
+    template <typename K, typename V>
+    MappedDictionary<K, V> DictionaryFile::map(const std::string& path) {
+        ArrayFileMapping mapping = ArrayFileMapping(path);
+        DictionaryFileHeader header;
+        const DictionaryFileSlot* slots = DictionaryFile::_validate(mapping.data(), mapping.size(), header);
+
+        return MappedDictionary<K, V>(std::move(mapping), slots, size_t(header.slot_count), size_t(header.count));
+    }
+
+    // Internal Functions
+    template <typename K, typename V, typename Storage>
+    uint64_t DictionaryFile::_layout(const Dictionary<K, V, Storage>& dictionary, DictionaryFileHeader& header,
+                                     std::vector<DictionaryFileSlot>& slots, std::vector<DictionaryFileEntry<K>>& entries) {
+        // The slices point into the dictionary, so nothing is copied until the file is written
+        entries.reserve(dictionary._data.size());
+        for (const auto& pair : dictionary._data) {
+            DictionaryFileEntry<K> entry;
+            entry.object = &pair.first;
+            entry.key = DictionaryFileBytes<K>::bytes(pair.first);
+            entry.value = DictionaryFileBytes<V>::bytes(pair.second);
+            if (entry.key._size > UINT32_MAX || entry.value._size > UINT32_MAX) {
+                throw DICTIONARY_FILE_INV_LENGTH;
+            }
+
+            entry.hash = DictionaryFile::hash(entry.key._begin, entry.key._size);
+            entry.lengths[0] = uint32_t(entry.key._size);
+            entry.lengths[1] = uint32_t(entry.value._size);
+            entries.push_back(entry);
+        }
+
+        // Written in the order of a Dictionary, so reading it back adds every key at the end
+        std::less<K> less = std::less<K>();
+        std::sort(entries.begin(), entries.end(), [&less](const DictionaryFileEntry<K>& first, const DictionaryFileEntry<K>& second) {
+            return less(*first.object, *second.object);
+        });
+
+        std::memcpy(header.magic, DICTIONARY_FILE_MAGIC, sizeof(header.magic));
+        header.endian = ARRAY_FILE_ENDIAN_MARK;
+        header.version = DICTIONARY_FILE_VERSION;
+        header.flags = 0;
+        header.count = entries.size();
+        header.slot_count = 1;
+        while (header.slot_count * DICTIONARY_FILE_MAX_LOAD <= header.count) {
+            header.slot_count *= 2;
+        }
+
+        // Entries are laid out first so the index can point at them, the offset ends at the length of the file
+        slots = std::vector<DictionaryFileSlot>(size_t(header.slot_count), DictionaryFileSlot{0, 0});
+        uint64_t offset = sizeof(header) + header.slot_count * sizeof(DictionaryFileSlot);
+        size_t mask = size_t(header.slot_count) - 1;
+        for (const DictionaryFileEntry<K>& entry : entries) {
+            size_t i = size_t(entry.hash) & mask;
+            while (slots[i].offset != 0) {
+                i = (i + 1) & mask;
+            }
+
+            slots[i].hash = entry.hash;
+            slots[i].offset = offset;
+            offset += sizeof(entry.lengths) + entry.key._size + entry.value._size;
+        }
+
+        return offset;
+    }
+}
+
+#endif // MRLIB_DICTIONARY_FILE_HPP
@@ -0,0 +1,59 @@
+//
+// FixedArray.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to have an Array that never touches the
+ * heap. FixedArray is a SmallArray whose allocator refuses to allocate,
+ * so it holds at most N elements and throws when more are added.
+ */
+
+
+#ifndef MRLIB_FIXED_ARRAY_HPP
+#define MRLIB_FIXED_ARRAY_HPP
+
+#include <stdexcept>
+
+#include "SmallArray.hpp"
+
+// Capacity exceeded exception
+#define FIXED_ARRAY_FULL std::invalid_argument("FixedArray: Capacity exceeded")
+
+
+namespace mrlib {
+
+    template <typename T>
+    struct FixedArrayAllocator {
+        typedef T value_type;
+
+        FixedArrayAllocator() {}
+        template <typename U>
+        FixedArrayAllocator(const FixedArrayAllocator<U>&) {}
+
+        T* allocate(size_t) {
+            throw FIXED_ARRAY_FULL;
+        }
+
+        void deallocate(T*, size_t) {
+        }
+    };
+
+    template <typename T, typename U>
+    bool operator==(const FixedArrayAllocator<T>&, const FixedArrayAllocator<U>&) {
+        return true;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const FixedArrayAllocator<T>&, const FixedArrayAllocator<U>&) {
+        return false;
+    }
+
+    // Array with room for exactly N elements and no heap storage
+    template <typename T, size_t N>
+    using FixedArray = Array<T, SmallBuffer<T, N, FixedArrayAllocator<T>>>;
+}
+
+#endif // MRLIB_FIXED_ARRAY_HPP
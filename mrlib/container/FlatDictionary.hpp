@@ -0,0 +1,535 @@
+//
+// FlatDictionary.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to make dictionaries that are built once
+ * and then read many times as fast to search as possible. FlatMap keeps
+ * its keys in one sorted array and its values in another array in the same
+ * order, so a lookup is a binary search that only touches keys, packed next
+ * to each other, and then reads a single value. FlatDictionary is a
+ * Dictionary that uses a FlatMap for storage, so it has the same interface
+ * as Dictionary and its keys are kept in order.
+ *
+ * Building a FlatMap from a range sorts it once, so it is O(n log n).
+ * Adding or removing a single key moves every key after it, so those are
+ * linear, and references to the objects are invalidated by them.
+ *
+ * Since keys and values are stored apart, iterating a FlatMap gives pairs
+ * of references instead of references to pairs. Use auto&& or const auto&
+ * to bind them in a range based for loop.
+ */
+
+
+#ifndef MRLIB_FLAT_DICTIONARY_HPP
+#define MRLIB_FLAT_DICTIONARY_HPP
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <initializer_list>
+
+#include "Dictionary.hpp"
+
+
+namespace mrlib {
+
+    // Lets operator-> return a pair of references that only lives as long as the expression
+    template <typename Reference>
+    struct FlatMapArrow {
+        Reference  entry;
+
+        const Reference*  operator->() const { return &this->entry; }
+    };
+
+
+    template <typename Map, typename Value>
+    class FlatMapIterator {
+    public:
+        typedef typename std::remove_const<Map>::type::key_type        Key;
+        typedef std::random_access_iterator_tag                         iterator_category;
+        typedef std::pair<const Key, typename std::remove_const<Value>::type>  value_type;
+        typedef std::ptrdiff_t                                          difference_type;
+        typedef std::pair<const Key&, Value&>                           reference;
+        typedef FlatMapArrow<reference>                                 pointer;
+
+        // Internal Data
+        Map*    _map;
+        size_t  _index;
+
+        // Constructors
+        FlatMapIterator() : _map(nullptr), _index(0) {}
+        FlatMapIterator(Map* map, size_t index) : _map(map), _index(index) {}
+
+        // Conversion to const iterator
+        operator FlatMapIterator<const Map, const Value>() const {
+            return FlatMapIterator<const Map, const Value>(this->_map, this->_index);
+        }
+
+        // Access
+        reference  operator*() const { return reference(this->_map->_keys[this->_index], this->_map->_values[this->_index]); }
+        pointer    operator->() const { return pointer{**this}; }
+        reference  operator[](difference_type n) const { return *(*this + n); }
+
+        // Movement
+        FlatMapIterator&  operator++() { ++this->_index; return *this; }
+        FlatMapIterator   operator++(int) { FlatMapIterator it = *this; ++this->_index; return it; }
+        FlatMapIterator&  operator--() { --this->_index; return *this; }
+        FlatMapIterator   operator--(int) { FlatMapIterator it = *this; --this->_index; return it; }
+        FlatMapIterator&  operator+=(difference_type n) { this->_index += n; return *this; }
+        FlatMapIterator&  operator-=(difference_type n) { this->_index -= n; return *this; }
+        FlatMapIterator   operator+(difference_type n) const { return FlatMapIterator(this->_map, this->_index + n); }
+        FlatMapIterator   operator-(difference_type n) const { return FlatMapIterator(this->_map, this->_index - n); }
+        difference_type   operator-(const FlatMapIterator& it) const { return difference_type(this->_index) - difference_type(it._index); }
+
+        // Comparison
+        bool  operator==(const FlatMapIterator& it) const { return this->_index == it._index; }
+        bool  operator!=(const FlatMapIterator& it) const { return this->_index != it._index; }
+        bool  operator<(const FlatMapIterator& it) const { return this->_index < it._index; }
+        bool  operator>(const FlatMapIterator& it) const { return this->_index > it._index; }
+        bool  operator<=(const FlatMapIterator& it) const { return this->_index <= it._index; }
+        bool  operator>=(const FlatMapIterator& it) const { return this->_index >= it._index; }
+    };
+
+
+    template <typename K, typename V, typename Compare = std::less<K>>
+    class FlatMap {
+        static_assert(!std::is_same<V, bool>::value, "FlatMap: std::vector<bool> can not give references to its values");
+
+    public:
+        typedef K                                                  key_type;
+        typedef V                                                  mapped_type;
+        typedef std::pair<const K, V>                              value_type;
+        typedef FlatMapIterator<FlatMap, V>                        iterator;
+        typedef FlatMapIterator<const FlatMap, const V>            const_iterator;
+        typedef size_t                                             size_type;
+
+        // Internal Data
+        std::vector<K>  _keys;     // Sorted, searched on their own
+        std::vector<V>  _values;   // The value of _keys[i] is _values[i]
+        Compare         _compare;
+
+        // Constructors
+        FlatMap();
+        FlatMap(std::initializer_list<value_type> i_list);
+        template <typename InputIt>
+        FlatMap(InputIt first, InputIt last);
+
+        // Operator Overloading
+        V&     operator[](const K& key);
+        bool   operator==(const FlatMap& map) const;
+        bool   operator!=(const FlatMap& map) const;
+
+        // Iteration
+        iterator        begin();
+        const_iterator  begin() const;
+        iterator        end();
+        const_iterator  end() const;
+
+        // Querying Map
+        size_t          size() const;
+        bool            empty() const;
+        size_t          count(const K& key) const;
+        iterator        find(const K& key);
+        const_iterator  find(const K& key) const;
+        iterator        lower_bound(const K& key);
+        const_iterator  lower_bound(const K& key) const;
+
+        // Modifiers
+        std::pair<iterator, bool>  insert(const value_type& value);
+        template <typename... Args>
+        std::pair<iterator, bool>  try_emplace(const K& key, Args&&... args);
+        size_t                     erase(const K& key);
+        iterator                   erase(const_iterator position);
+        void                       clear();
+        void                       reserve(size_t size);
+
+    private:
+        size_t  _lowerBound(const K& key) const;
+        size_t  _find(const K& key) const;
+    };
+
+
+    // Dictionary backed by sorted arrays instead of a tree
+    template <typename K, typename V, typename Compare = std::less<K>>
+    using FlatDictionary = Dictionary<K, V, FlatMap<K, V, Compare>>;
+
+
+    // Builds the object only when the key is missing, and before adding it, since adding shifts the objects after it
+    template <typename K, typename V, typename Compare>
+    struct DictionaryInsert<FlatMap<K, V, Compare>> {
+        typedef FlatMap<K, V, Compare>      Storage;
+        typedef typename Storage::iterator  Iterator;
+
+        template <typename F>
+        static std::pair<Iterator, bool>  findOrEmplace(Storage& storage, const K& key, F make);
+    };
+
+
+    // Sorts the batch and merges it with the arrays in one pass, instead of shifting them once per key
+    template <typename K, typename V, typename Compare>
+    struct DictionaryBatch<FlatMap<K, V, Compare>> {
+        typedef FlatMap<K, V, Compare>  Storage;
+
+        static void     assign(Storage& storage, std::vector<std::pair<K, V>>& entries);
+        template <typename Map, typename Value>
+        static void     find(Map& storage, const std::vector<K>& keys, std::vector<Value*>& values);
+        static void     erase(Storage& storage, const std::vector<K>& keys);
+        static Storage  merge(const Storage& first, const Storage& second);
+
+    private:
+        static std::vector<size_t>  _order(const Storage& storage, const std::vector<K>& keys);
+    };
+
+
+    // The capacity of both arrays, with nothing between the objects
+    template <typename K, typename V, typename Compare>
+    struct DictionaryMemory<FlatMap<K, V, Compare>> {
+        static size_t  usage(const FlatMap<K, V, Compare>& storage);
+    };
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename K, typename V, typename Compare>
+    FlatMap<K, V, Compare>::FlatMap() {
+    }
+
+    template <typename K, typename V, typename Compare>
+    FlatMap<K, V, Compare>::FlatMap(std::initializer_list<value_type> i_list) : FlatMap(i_list.begin(), i_list.end()) {
+    }
+
+    template <typename K, typename V, typename Compare>
+    template <typename InputIt>
+    FlatMap<K, V, Compare>::FlatMap(InputIt first, InputIt last) {
+        std::vector<std::pair<K, V>> entries = std::vector<std::pair<K, V>>(first, last);
+
+        // Sorted input, like a std::map, skips the sort. A stable sort keeps the first of equal keys, like std::map does
+        auto compare = [this](const std::pair<K, V>& a, const std::pair<K, V>& b) { return this->_compare(a.first, b.first); };
+        if (!std::is_sorted(entries.begin(), entries.end(), compare)) {
+            std::stable_sort(entries.begin(), entries.end(), compare);
+        }
+
+        this->_keys.reserve(entries.size());
+        this->_values.reserve(entries.size());
+        for (std::pair<K, V>& entry : entries) {
+            if (this->_keys.empty() || this->_compare(this->_keys.back(), entry.first)) {
+                this->_keys.push_back(std::move(entry.first));
+                this->_values.push_back(std::move(entry.second));
+            }
+        }
+    }
+
+
+    // Operator Overloading
+    template <typename K, typename V, typename Compare>
+    V& FlatMap<K, V, Compare>::operator[](const K& key) {
+        return this->try_emplace(key).first->second;
+    }
+
+    template <typename K, typename V, typename Compare>
+    bool FlatMap<K, V, Compare>::operator==(const FlatMap& map) const {
+        return this->_keys == map._keys && this->_values == map._values;
+    }
+
+    template <typename K, typename V, typename Compare>
+    bool FlatMap<K, V, Compare>::operator!=(const FlatMap& map) const {
+        return !(*this == map);
+    }
+
+
+    // Iteration
+    template <typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::iterator FlatMap<K, V, Compare>::begin() {
+        return iterator(this, 0);
+    }
+
+    template <typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::const_iterator FlatMap<K, V, Compare>::begin() const {
+        return const_iterator(this, 0);
+    }
+
+    template <typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::iterator FlatMap<K, V, Compare>::end() {
+        return iterator(this, this->_keys.size());
+    }
+
+    template <typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::const_iterator FlatMap<K, V, Compare>::end() const {
+        return const_iterator(this, this->_keys.size());
+    }
+
+
+    // Querying Map
+    template <typename K, typename V, typename Compare>
+    size_t FlatMap<K, V, Compare>::size() const {
+        return this->_keys.size();
+    }
+
+    template <typename K, typename V, typename Compare>
+    bool FlatMap<K, V, Compare>::empty() const {
+        return this->_keys.empty();
+    }
+
+    template <typename K, typename V, typename Compare>
+    size_t FlatMap<K, V, Compare>::count(const K& key) const {
+        return this->_find(key) != this->_keys.size() ? 1 : 0;
+    }
+
+    template <typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::iterator FlatMap<K, V, Compare>::find(const K& key) {
+        return iterator(this, this->_find(key));
+    }
+
+    template <typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::const_iterator FlatMap<K, V, Compare>::find(const K& key) const {
+        return const_iterator(this, this->_find(key));
+    }
+
+    template <typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::iterator FlatMap<K, V, Compare>::lower_bound(const K& key) {
+        return iterator(this, this->_lowerBound(key));
+    }
+
+    template <typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::const_iterator FlatMap<K, V, Compare>::lower_bound(const K& key) const {
+        return const_iterator(this, this->_lowerBound(key));
+    }
+
+
+    // Modifiers
+    template <typename K, typename V, typename Compare>
+    std::pair<typename FlatMap<K, V, Compare>::iterator, bool> FlatMap<K, V, Compare>::insert(const value_type& value) {
+        return this->try_emplace(value.first, value.second);
+    }
+
+    template <typename K, typename V, typename Compare>
+    template <typename... Args>
+    std::pair<typename FlatMap<K, V, Compare>::iterator, bool> FlatMap<K, V, Compare>::try_emplace(const K& key, Args&&... args) {
+        size_t index = this->_lowerBound(key);
+        if (index != this->_keys.size() && !this->_compare(key, this->_keys[index])) {
+            return std::make_pair(iterator(this, index), false);
+        }
+
+        // Take the key back out if the value throws, so both arrays stay the same size
+        this->_keys.insert(this->_keys.begin() + index, key);
+        try {
+            this->_values.emplace(this->_values.begin() + index, std::forward<Args>(args)...);
+        }
+        catch (...) {
+            this->_keys.erase(this->_keys.begin() + index);
+            throw;
+        }
+
+        return std::make_pair(iterator(this, index), true);
+    }
+
+    template <typename K, typename V, typename Compare>
+    size_t FlatMap<K, V, Compare>::erase(const K& key) {
+        size_t index = this->_find(key);
+        if (index == this->_keys.size()) return 0;
+
+        this->erase(const_iterator(this, index));
+        return 1;
+    }
+
+    template <typename K, typename V, typename Compare>
+    typename FlatMap<K, V, Compare>::iterator FlatMap<K, V, Compare>::erase(const_iterator position) {
+        this->_keys.erase(this->_keys.begin() + position._index);
+        this->_values.erase(this->_values.begin() + position._index);
+        return iterator(this, position._index);
+    }
+
+    template <typename K, typename V, typename Compare>
+    void FlatMap<K, V, Compare>::clear() {
+        this->_keys.clear();
+        this->_values.clear();
+    }
+
+    template <typename K, typename V, typename Compare>
+    void FlatMap<K, V, Compare>::reserve(size_t size) {
+        this->_keys.reserve(size);
+        this->_values.reserve(size);
+    }
+
+
+    // Internal Functions
+    template <typename K, typename V, typename Compare>
+    size_t FlatMap<K, V, Compare>::_lowerBound(const K& key) const {
+        if (this->_keys.empty()) return 0;
+
+        // Halving without a branch on the comparison, so it compiles to a conditional move
+        const K* first = this->_keys.data();
+        const K* base = first;
+        size_t length = this->_keys.size();
+
+        while (length > 1) {
+            size_t half = length / 2;
+            base = this->_compare(base[half], key) ? base + half : base;
+            length -= half;
+        }
+
+        return size_t(base - first) + (this->_compare(*base, key) ? 1 : 0);
+    }
+
+    template <typename K, typename V, typename Compare>
+    size_t FlatMap<K, V, Compare>::_find(const K& key) const {
+        size_t index = this->_lowerBound(key);
+        if (index != this->_keys.size() && !this->_compare(key, this->_keys[index])) {
+            return index;
+        }
+
+        return this->_keys.size();
+    }
+
+
+    // Storage Insert
+    template <typename K, typename V, typename Compare>
+    template <typename F>
+    std::pair<typename FlatMap<K, V, Compare>::iterator, bool> DictionaryInsert<FlatMap<K, V, Compare>>::findOrEmplace(Storage& storage, const K& key, F make) {
+        auto it = storage.find(key);
+        if (it != storage.end()) {
+            return std::make_pair(it, false);
+        }
+
+        // make() may return a reference into this storage, so the object is copied out before anything moves
+        V value = make();
+        return storage.try_emplace(key, std::move(value));
+    }
+
+
+    // Batch Storage
+    template <typename K, typename V, typename Compare>
+    void DictionaryBatch<FlatMap<K, V, Compare>>::assign(Storage& storage, std::vector<std::pair<K, V>>& entries) {
+        Compare& compare = storage._compare;
+        auto less = [&compare](const std::pair<K, V>& a, const std::pair<K, V>& b) { return compare(a.first, b.first); };
+        if (!std::is_sorted(entries.begin(), entries.end(), less)) {
+            std::stable_sort(entries.begin(), entries.end(), less);
+        }
+
+        std::vector<K> keys = std::vector<K>();
+        std::vector<V> values = std::vector<V>();
+        keys.reserve(storage._keys.size() + entries.size());
+        values.reserve(storage._keys.size() + entries.size());
+
+        size_t i = 0;
+        size_t j = 0;
+        while (i < storage._keys.size() || j < entries.size()) {
+            if (j == entries.size() || (i < storage._keys.size() && compare(storage._keys[i], entries[j].first))) {
+                keys.push_back(std::move(storage._keys[i]));
+                values.push_back(std::move(storage._values[i]));
+                ++i;
+                continue;
+            }
+
+            // The last of equal keys in the batch wins, and replaces the key in the arrays
+            while (j + 1 < entries.size() && !compare(entries[j].first, entries[j + 1].first)) ++j;
+            if (i < storage._keys.size() && !compare(entries[j].first, storage._keys[i])) ++i;
+
+            keys.push_back(std::move(entries[j].first));
+            values.push_back(std::move(entries[j].second));
+            ++j;
+        }
+
+        storage._keys = std::move(keys);
+        storage._values = std::move(values);
+    }
+
+    template <typename K, typename V, typename Compare>
+    template <typename Map, typename Value>
+    void DictionaryBatch<FlatMap<K, V, Compare>>::find(Map& storage, const std::vector<K>& keys, std::vector<Value*>& values) {
+        values.assign(keys.size(), nullptr);
+
+        // Each key in order is searched for after the one before it
+        auto first = storage._keys.begin();
+        for (size_t index : _order(storage, keys)) {
+            first = std::lower_bound(first, storage._keys.end(), keys[index], storage._compare);
+            if (first != storage._keys.end() && !storage._compare(keys[index], *first)) {
+                values[index] = &storage._values[first - storage._keys.begin()];
+            }
+        }
+    }
+
+    template <typename K, typename V, typename Compare>
+    void DictionaryBatch<FlatMap<K, V, Compare>>::erase(Storage& storage, const std::vector<K>& keys) {
+        std::vector<bool> removed = std::vector<bool>(storage._keys.size(), false);
+
+        size_t first = 0;
+        for (size_t index : _order(storage, keys)) {
+            first = std::lower_bound(storage._keys.begin() + first, storage._keys.end(), keys[index], storage._compare) - storage._keys.begin();
+            if (first != storage._keys.size() && !storage._compare(keys[index], storage._keys[first])) {
+                removed[first] = true;
+            }
+        }
+
+        // Close every gap in one pass
+        size_t size = 0;
+        for (size_t i = 0; i < storage._keys.size(); ++i) {
+            if (removed[i]) continue;
+
+            if (size != i) {
+                storage._keys[size] = std::move(storage._keys[i]);
+                storage._values[size] = std::move(storage._values[i]);
+            }
+            ++size;
+        }
+
+        storage._keys.erase(storage._keys.begin() + size, storage._keys.end());
+        storage._values.erase(storage._values.begin() + size, storage._values.end());
+    }
+
+    template <typename K, typename V, typename Compare>
+    FlatMap<K, V, Compare> DictionaryBatch<FlatMap<K, V, Compare>>::merge(const Storage& first, const Storage& second) {
+        const Compare& compare = first._compare;
+        Storage storage = Storage();
+        storage.reserve(first.size() + second.size());
+
+        size_t i = 0;
+        size_t j = 0;
+        while (i < first._keys.size() || j < second._keys.size()) {
+            if (j == second._keys.size() || (i < first._keys.size() && compare(first._keys[i], second._keys[j]))) {
+                storage._keys.push_back(first._keys[i]);
+                storage._values.push_back(first._values[i]);
+                ++i;
+                continue;
+            }
+
+            if (i < first._keys.size() && !compare(second._keys[j], first._keys[i])) ++i;
+            storage._keys.push_back(second._keys[j]);
+            storage._values.push_back(second._values[j]);
+            ++j;
+        }
+
+        return storage;
+    }
+
+    template <typename K, typename V, typename Compare>
+    std::vector<size_t> DictionaryBatch<FlatMap<K, V, Compare>>::_order(const Storage& storage, const std::vector<K>& keys) {
+        std::vector<size_t> order = std::vector<size_t>(keys.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+
+        std::sort(order.begin(), order.end(), [&storage, &keys](size_t a, size_t b) { return storage._compare(keys[a], keys[b]); });
+        return order;
+    }
+
+
+    // Storage Memory
+    template <typename K, typename V, typename Compare>
+    size_t DictionaryMemory<FlatMap<K, V, Compare>>::usage(const FlatMap<K, V, Compare>& storage) {
+        return storage._keys.capacity() * sizeof(K) + storage._values.capacity() * sizeof(V);
+    }
+}
+
+#endif // MRLIB_FLAT_DICTIONARY_HPP
@@ -0,0 +1,376 @@
+//
+// FrozenDictionary.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to look up keys that are all known ahead of
+ * time, like static configuration or routing tables, with exactly one
+ * probe. A FrozenDictionary is built once from its keys and can not be
+ * changed afterwards.
+ *
+ * Building it computes a minimal perfect hash in the style of CHD (hash,
+ * displace and compress). The keys are split into small buckets by their
+ * hash, and each bucket, largest first, searches for a seed that sends all
+ * of its keys to slots that are still free. Like PTHash, the first buckets
+ * get more of the keys than the rest, so the large buckets are placed
+ * while most slots are still free. There is one spare slot for every
+ * FROZEN_DICTIONARY_SPARE_SLOTS keys, so the last buckets still find free
+ * slots quickly. Keys sent past the last object are then moved into the
+ * spare slots among the objects, and a small table records where, so there
+ * are exactly as many objects as keys. A lookup hashes the key, reads the
+ * seed of its bucket, and compares the one key in the slot that gives.
+ * The seeds add four bytes for every FROZEN_DICTIONARY_BUCKET_SIZE keys,
+ * and the table four bytes for every spare slot.
+ *
+ * Different keys with the same hash can not be told apart by any seed, so
+ * building from them throws.
+ */
+
+
+#ifndef MRLIB_FROZEN_DICTIONARY_HPP
+#define MRLIB_FROZEN_DICTIONARY_HPP
+
+#include <map>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include <initializer_list>
+
+#include "HashDictionary.hpp"
+
+// Perfect Hash Constants
+#define FROZEN_DICTIONARY_BUCKET_SIZE 4
+#define FROZEN_DICTIONARY_SPARE_SLOTS 10
+
+// Key exceptions
+#define FROZEN_DICTIONARY_MISSING_KEY std::invalid_argument("FrozenDictionary: Key does not exist in dictionary")
+#define FROZEN_DICTIONARY_HASH_COLLISION std::invalid_argument("FrozenDictionary: Different keys have the same hash")
+
+namespace mrlib {
+
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    class FrozenDictionary {
+    public:
+        typedef std::pair<const K, V>                             value_type;
+        typedef typename std::vector<value_type>::const_iterator  const_iterator;
+
+        // Internal Data
+        std::vector<value_type>  _entries;   // Each object in the slot the perfect hash gives its key
+        std::vector<uint32_t>    _seeds;     // One per bucket
+        std::vector<uint32_t>    _moved;     // The object of each slot past the last one
+        Hash                     _hash;
+        KeyEqual                 _equal;
+
+        // Constructors
+        FrozenDictionary();
+        FrozenDictionary(std::initializer_list<value_type> i_list);
+        template <typename InputIt>
+        FrozenDictionary(InputIt first, InputIt last);
+        template <typename Storage>
+        FrozenDictionary(const Dictionary<K, V, Storage>& dictionary);
+
+        // Iteration
+        const_iterator  begin() const;
+        const_iterator  end() const;
+
+        // Querying Dictionary
+        V               objectForKey(const K& key) const;
+        const V*        tryGet(const K& key) const;
+        bool            containsKey(const K& key) const;
+        size_t          size() const;
+        bool            isEmpty() const;
+        std::vector<K>  getKeys() const;
+        std::vector<V>  getValues() const;
+
+        // Getting Standard Containers
+        std::map<K, V>  std_map() const;
+
+        // String Representation
+        std::string  description() const;
+
+    private:
+        template <typename InputIt>
+        void            _build(InputIt first, InputIt last, size_t size);
+        uint64_t        _hashOf(const K& key) const;
+        size_t          _bucket(uint64_t hash) const;
+        size_t          _index(uint64_t hash) const;
+        static size_t   _slot(uint64_t hash, uint32_t seed, size_t size);
+        static uint64_t _mix(uint64_t hash);
+    };
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    FrozenDictionary<K, V, Hash, KeyEqual>::FrozenDictionary() {
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    FrozenDictionary<K, V, Hash, KeyEqual>::FrozenDictionary(std::initializer_list<value_type> i_list) : FrozenDictionary(i_list.begin(), i_list.end()) {
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename InputIt>
+    FrozenDictionary<K, V, Hash, KeyEqual>::FrozenDictionary(InputIt first, InputIt last) {
+        // Keeps the first of equal keys, like the other dictionaries
+        HashMap<K, V, Hash, KeyEqual> unique = HashMap<K, V, Hash, KeyEqual>(first, last);
+        this->_build(unique.begin(), unique.end(), unique.size());
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename Storage>
+    FrozenDictionary<K, V, Hash, KeyEqual>::FrozenDictionary(const Dictionary<K, V, Storage>& dictionary) {
+        this->_build(dictionary.begin(), dictionary.end(), dictionary.size());
+    }
+
+
+    // Iteration
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename FrozenDictionary<K, V, Hash, KeyEqual>::const_iterator FrozenDictionary<K, V, Hash, KeyEqual>::begin() const {
+        return this->_entries.begin();
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename FrozenDictionary<K, V, Hash, KeyEqual>::const_iterator FrozenDictionary<K, V, Hash, KeyEqual>::end() const {
+        return this->_entries.end();
+    }
+
+
+    // Querying Dictionary
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    V FrozenDictionary<K, V, Hash, KeyEqual>::objectForKey(const K& key) const {
+        const V* value = this->tryGet(key);
+        if (value == nullptr) {
+            throw FROZEN_DICTIONARY_MISSING_KEY;
+        }
+
+        return *value;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    const V* FrozenDictionary<K, V, Hash, KeyEqual>::tryGet(const K& key) const {
+        if (this->_entries.empty()) return nullptr;
+
+        // Any key lands in exactly one slot, which holds it if the key is in the dictionary
+        uint64_t hash = this->_hashOf(key);
+        const value_type& entry = this->_entries[this->_index(hash)];
+        return this->_equal(entry.first, key) ? &entry.second : nullptr;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool FrozenDictionary<K, V, Hash, KeyEqual>::containsKey(const K& key) const {
+        return this->tryGet(key) != nullptr;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t FrozenDictionary<K, V, Hash, KeyEqual>::size() const {
+        return this->_entries.size();
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool FrozenDictionary<K, V, Hash, KeyEqual>::isEmpty() const {
+        return this->_entries.empty();
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    std::vector<K> FrozenDictionary<K, V, Hash, KeyEqual>::getKeys() const {
+        std::vector<K> keys = std::vector<K>();
+        keys.reserve(this->_entries.size());
+        for (const value_type& entry : this->_entries) {
+            keys.push_back(entry.first);
+        }
+
+        return keys;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    std::vector<V> FrozenDictionary<K, V, Hash, KeyEqual>::getValues() const {
+        std::vector<V> values = std::vector<V>();
+        values.reserve(this->_entries.size());
+        for (const value_type& entry : this->_entries) {
+            values.push_back(entry.second);
+        }
+
+        return values;
+    }
+
+
+    // Getting Standard Containers
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    std::map<K, V> FrozenDictionary<K, V, Hash, KeyEqual>::std_map() const {
+        return std::map<K, V>(this->_entries.begin(), this->_entries.end());
+    }
+
+
+    // String Representation
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    std::string FrozenDictionary<K, V, Hash, KeyEqual>::description() const {
+        DescriptionWriter writer;
+        writer.mapping(this->_entries.begin(), this->_entries.size());
+        return writer.take();
+    }
+
+
+    // Internal Functions
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename InputIt>
+    void FrozenDictionary<K, V, Hash, KeyEqual>::_build(InputIt first, InputIt last, size_t size) {
+        if (size == 0) return;
+
+        std::vector<uint64_t> hashes = std::vector<uint64_t>();
+        hashes.reserve(size);
+        for (InputIt it = first; it != last; ++it) {
+            hashes.push_back(this->_hashOf(it->first));
+        }
+
+        // Group the keys by bucket, then place the largest buckets while the most slots are free
+        size_t slot_count = size + size / FROZEN_DICTIONARY_SPARE_SLOTS + 1;
+        this->_seeds = std::vector<uint32_t>(size / FROZEN_DICTIONARY_BUCKET_SIZE + 1, 0);
+        std::vector<size_t> starts = std::vector<size_t>(this->_seeds.size() + 1, 0);
+        for (uint64_t hash : hashes) {
+            ++starts[this->_bucket(hash) + 1];
+        }
+        for (size_t bucket = 0; bucket < this->_seeds.size(); ++bucket) {
+            starts[bucket + 1] += starts[bucket];
+        }
+
+        // The hashes are copied next to the others of their bucket, so trying a seed reads one cache line
+        std::vector<size_t> members = std::vector<size_t>(size);
+        std::vector<uint64_t> grouped = std::vector<uint64_t>(size);
+        std::vector<size_t> filled = std::vector<size_t>(starts.begin(), starts.end() - 1);
+        for (size_t i = 0; i < size; ++i) {
+            size_t position = filled[this->_bucket(hashes[i])]++;
+            members[position] = i;
+            grouped[position] = hashes[i];
+        }
+
+        std::vector<size_t> order = std::vector<size_t>(this->_seeds.size());
+        for (size_t bucket = 0; bucket < order.size(); ++bucket) {
+            order[bucket] = bucket;
+        }
+        std::stable_sort(order.begin(), order.end(), [&starts](size_t a, size_t b) {
+            return starts[a + 1] - starts[a] > starts[b + 1] - starts[b];
+        });
+
+        std::vector<bool> taken = std::vector<bool>(slot_count, false);
+        std::vector<size_t> slots = std::vector<size_t>(size);
+        std::vector<size_t> candidate = std::vector<size_t>();
+
+        for (size_t bucket : order) {
+            size_t begin = starts[bucket];
+            size_t end = starts[bucket + 1];
+            if (begin == end) break;
+
+            // Keys with the same hash are always in the same bucket, and no seed can separate them
+            for (size_t i = begin; i < end; ++i) {
+                if (std::find(grouped.begin() + i + 1, grouped.begin() + end, grouped[i]) != grouped.begin() + end) {
+                    throw FROZEN_DICTIONARY_HASH_COLLISION;
+                }
+            }
+
+            for (uint32_t seed = 0; ; ++seed) {
+                candidate.clear();
+                for (size_t i = begin; i < end; ++i) {
+                    size_t slot = _slot(grouped[i], seed, slot_count);
+                    if (taken[slot] || std::find(candidate.begin(), candidate.end(), slot) != candidate.end()) break;
+                    candidate.push_back(slot);
+                }
+
+                if (candidate.size() == end - begin) {
+                    this->_seeds[bucket] = seed;
+                    break;
+                }
+            }
+
+            for (size_t i = begin; i < end; ++i) {
+                taken[candidate[i - begin]] = true;
+                slots[members[i]] = candidate[i - begin];
+            }
+        }
+
+        // Move the keys past the last object into the free slots before it, there are as many of each
+        this->_moved = std::vector<uint32_t>(slot_count - size, 0);
+        size_t free = 0;
+        for (size_t slot = size; slot < slot_count; ++slot) {
+            if (!taken[slot]) continue;
+
+            while (taken[free]) {
+                ++free;
+            }
+
+            taken[free] = true;
+            this->_moved[slot - size] = uint32_t(free);
+        }
+
+        for (size_t i = 0; i < size; ++i) {
+            if (slots[i] >= size) {
+                slots[i] = this->_moved[slots[i] - size];
+            }
+        }
+
+        // Lay the objects out in slot order
+        std::vector<InputIt> entries = std::vector<InputIt>(size);
+        size_t index = 0;
+        for (InputIt it = first; it != last; ++it) {
+            entries[slots[index++]] = it;
+        }
+
+        this->_entries.reserve(size);
+        for (const InputIt& it : entries) {
+            this->_entries.emplace_back(it->first, it->second);
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    uint64_t FrozenDictionary<K, V, Hash, KeyEqual>::_hashOf(const K& key) const {
+        return _mix(uint64_t(this->_hash(key)));
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t FrozenDictionary<K, V, Hash, KeyEqual>::_bucket(uint64_t hash) const {
+        // Six in ten keys go to the first three in ten buckets
+        size_t count = this->_seeds.size();
+        size_t dense = count * 3 / 10;
+        if ((hash & 0xFFFFFFFFull) < 0x99999999ull) {
+            return size_t(((hash >> 32) * dense) >> 32);
+        }
+
+        return dense + size_t(((hash >> 32) * (count - dense)) >> 32);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t FrozenDictionary<K, V, Hash, KeyEqual>::_index(uint64_t hash) const {
+        size_t size = this->_entries.size();
+        size_t slot = _slot(hash, this->_seeds[this->_bucket(hash)], size + this->_moved.size());
+        return slot < size ? slot : this->_moved[slot - size];
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t FrozenDictionary<K, V, Hash, KeyEqual>::_slot(uint64_t hash, uint32_t seed, size_t size) {
+        // Scales the top bits to the slot count, which is much cheaper than a division
+        return size_t(((_mix(hash ^ (uint64_t(seed) * 0x9E3779B97F4A7C15ull)) >> 32) * size) >> 32);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    uint64_t FrozenDictionary<K, V, Hash, KeyEqual>::_mix(uint64_t hash) {
+        // The finalizer of MurmurHash3, so std::hash of integers still spreads over every bit
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        hash *= 0xC4CEB9FE1A85EC53ull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+}
+
+#endif // MRLIB_FROZEN_DICTIONARY_HPP
@@ -0,0 +1,357 @@
+//
+// GrowthArray.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to control how an Array allocates and grows.
+ * GrowthVector is a std::vector with a custom allocator that decides its
+ * own capacity whenever it has to grow, using a growth policy instead of
+ * the standard library's fixed factor. GrowthArray is an Array that uses a
+ * GrowthVector for storage, so it has exactly the same interface as Array.
+ *
+ * A growth policy is a type with a static capacity(current, required,
+ * object_size) function that returns the new capacity, which must be at
+ * least required. GeometricGrowth multiplies the capacity by a fixed
+ * ratio, and PageGrowth rounds large arrays up to whole pages, which lets
+ * huge page backed allocators use every page they map.
+ */
+
+
+#ifndef MRLIB_GROWTH_ARRAY_HPP
+#define MRLIB_GROWTH_ARRAY_HPP
+
+#include <vector>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <initializer_list>
+
+#include "Array.hpp"
+
+// Growth Constants
+#define GROWTH_MIN_CAPACITY 4
+#define GROWTH_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+
+namespace mrlib {
+
+    // Multiply the capacity by Numerator / Denominator
+    template <size_t Numerator = 2, size_t Denominator = 1>
+    struct GeometricGrowth {
+        static_assert(Numerator > Denominator, "GeometricGrowth: ratio must be greater than one");
+
+        static size_t capacity(size_t current, size_t required, size_t) {
+            size_t grown = current / Denominator * Numerator + current % Denominator * Numerator / Denominator;
+            return std::max(std::max(grown, required), size_t(GROWTH_MIN_CAPACITY));
+        }
+    };
+
+    // Grow with Base, then round arrays of at least one page up to a whole number of pages
+    template <typename Base = GeometricGrowth<>, size_t PageSize = GROWTH_HUGE_PAGE_SIZE>
+    struct PageGrowth {
+        static size_t capacity(size_t current, size_t required, size_t object_size) {
+            size_t capacity = Base::capacity(current, required, object_size);
+            size_t bytes = capacity * object_size;
+
+            if (bytes < PageSize) {
+                return capacity;
+            }
+
+            size_t pages = (bytes + PageSize - 1) / PageSize;
+            return pages * PageSize / object_size;
+        }
+    };
+
+
+    template <typename T, typename Growth = GeometricGrowth<>, typename Allocator = std::allocator<T>>
+    class GrowthVector {
+    public:
+        typedef std::vector<T, Allocator>                  vector_type;
+        typedef T                                          value_type;
+        typedef T&                                         reference;
+        typedef const T&                                   const_reference;
+        typedef typename vector_type::iterator             iterator;
+        typedef typename vector_type::const_iterator       const_iterator;
+        typedef size_t                                     size_type;
+
+        // Internal Data
+        vector_type  _vector;
+
+        // Constructors
+        GrowthVector();
+        GrowthVector(size_t size);
+        GrowthVector(std::initializer_list<T> i_list);
+        template <typename InputIt>
+        GrowthVector(InputIt first, InputIt last);
+
+        // Operator Overloading
+        T&        operator[](size_t index);
+        const T&  operator[](size_t index) const;
+        bool      operator==(const GrowthVector& vector) const;
+        bool      operator!=(const GrowthVector& vector) const;
+
+        // Iteration
+        iterator        begin();
+        const_iterator  begin() const;
+        iterator        end();
+        const_iterator  end() const;
+        T*              data();
+        const T*        data() const;
+
+        // Querying Vector
+        size_t    size() const;
+        bool      empty() const;
+        size_t    capacity() const;
+        T&        front();
+        const T&  front() const;
+        T&        back();
+        const T&  back() const;
+
+        // Capacity
+        void  reserve(size_t capacity);
+        void  shrink_to_fit();
+
+        // Modifiers
+        void      push_back(const T& object);
+        void      push_back(T&& object);
+        void      pop_back();
+        iterator  insert(const_iterator position, const T& object);
+        template <typename InputIt>
+        iterator  insert(const_iterator position, InputIt first, InputIt last);
+        iterator  erase(const_iterator position);
+        iterator  erase(const_iterator first, const_iterator last);
+        template <typename InputIt>
+        void      assign(InputIt first, InputIt last);
+        void      clear();
+
+    private:
+        void  _grow(size_t added);
+    };
+
+    // Array with a custom growth policy and allocator
+    template <typename T, typename Growth = GeometricGrowth<>, typename Allocator = std::allocator<T>>
+    using GrowthArray = Array<T, GrowthVector<T, Growth, Allocator>>;
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename T, typename Growth, typename Allocator>
+    GrowthVector<T, Growth, Allocator>::GrowthVector() {
+        this->_vector = vector_type();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    GrowthVector<T, Growth, Allocator>::GrowthVector(size_t size) {
+        this->_vector = vector_type(size);
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    GrowthVector<T, Growth, Allocator>::GrowthVector(std::initializer_list<T> i_list) {
+        this->_vector = vector_type(i_list);
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    template <typename InputIt>
+    GrowthVector<T, Growth, Allocator>::GrowthVector(InputIt first, InputIt last) {
+        this->_vector = vector_type(first, last);
+    }
+
+
+    // Operator Overloading
+    template <typename T, typename Growth, typename Allocator>
+    T& GrowthVector<T, Growth, Allocator>::operator[](size_t index) {
+        return this->_vector[index];
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    const T& GrowthVector<T, Growth, Allocator>::operator[](size_t index) const {
+        return this->_vector[index];
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    bool GrowthVector<T, Growth, Allocator>::operator==(const GrowthVector& vector) const {
+        return this->_vector == vector._vector;
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    bool GrowthVector<T, Growth, Allocator>::operator!=(const GrowthVector& vector) const {
+        return this->_vector != vector._vector;
+    }
+
+
+    // Iteration
+    template <typename T, typename Growth, typename Allocator>
+    typename GrowthVector<T, Growth, Allocator>::iterator GrowthVector<T, Growth, Allocator>::begin() {
+        return this->_vector.begin();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    typename GrowthVector<T, Growth, Allocator>::const_iterator GrowthVector<T, Growth, Allocator>::begin() const {
+        return this->_vector.begin();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    typename GrowthVector<T, Growth, Allocator>::iterator GrowthVector<T, Growth, Allocator>::end() {
+        return this->_vector.end();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    typename GrowthVector<T, Growth, Allocator>::const_iterator GrowthVector<T, Growth, Allocator>::end() const {
+        return this->_vector.end();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    T* GrowthVector<T, Growth, Allocator>::data() {
+        return this->_vector.data();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    const T* GrowthVector<T, Growth, Allocator>::data() const {
+        return this->_vector.data();
+    }
+
+
+    // Querying Vector
+    template <typename T, typename Growth, typename Allocator>
+    size_t GrowthVector<T, Growth, Allocator>::size() const {
+        return this->_vector.size();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    bool GrowthVector<T, Growth, Allocator>::empty() const {
+        return this->_vector.empty();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    size_t GrowthVector<T, Growth, Allocator>::capacity() const {
+        return this->_vector.capacity();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    T& GrowthVector<T, Growth, Allocator>::front() {
+        return this->_vector.front();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    const T& GrowthVector<T, Growth, Allocator>::front() const {
+        return this->_vector.front();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    T& GrowthVector<T, Growth, Allocator>::back() {
+        return this->_vector.back();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    const T& GrowthVector<T, Growth, Allocator>::back() const {
+        return this->_vector.back();
+    }
+
+
+    // Capacity
+    template <typename T, typename Growth, typename Allocator>
+    void GrowthVector<T, Growth, Allocator>::reserve(size_t capacity) {
+        this->_vector.reserve(capacity);
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    void GrowthVector<T, Growth, Allocator>::shrink_to_fit() {
+        this->_vector.shrink_to_fit();
+    }
+
+
+    // Modifiers
+    template <typename T, typename Growth, typename Allocator>
+    void GrowthVector<T, Growth, Allocator>::push_back(const T& object) {
+        if (this->_vector.size() == this->_vector.capacity()) {
+            // The object may live in this vector, so copy it before reallocating
+            T copy = object;
+            this->_grow(1);
+            this->_vector.push_back(std::move(copy));
+        }
+        else {
+            this->_vector.push_back(object);
+        }
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    void GrowthVector<T, Growth, Allocator>::push_back(T&& object) {
+        if (this->_vector.size() == this->_vector.capacity()) {
+            // The object may live in this vector, so move it out before reallocating
+            T moved = std::move(object);
+            this->_grow(1);
+            this->_vector.push_back(std::move(moved));
+        }
+        else {
+            this->_vector.push_back(std::move(object));
+        }
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    void GrowthVector<T, Growth, Allocator>::pop_back() {
+        this->_vector.pop_back();
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    typename GrowthVector<T, Growth, Allocator>::iterator GrowthVector<T, Growth, Allocator>::insert(const_iterator position, const T& object) {
+        size_t index = position - this->_vector.begin();
+        T copy = object;
+        this->_grow(1);
+        return this->_vector.insert(this->_vector.begin() + index, std::move(copy));
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    template <typename InputIt>
+    typename GrowthVector<T, Growth, Allocator>::iterator GrowthVector<T, Growth, Allocator>::insert(const_iterator position, InputIt first, InputIt last) {
+        size_t index = position - this->_vector.begin();
+
+        // Single pass iterators can not be measured up front, the vector grows those itself
+        if (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>::value) {
+            this->_grow(std::distance(first, last));
+        }
+
+        return this->_vector.insert(this->_vector.begin() + index, first, last);
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    typename GrowthVector<T, Growth, Allocator>::iterator GrowthVector<T, Growth, Allocator>::erase(const_iterator position) {
+        return this->_vector.erase(position);
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    typename GrowthVector<T, Growth, Allocator>::iterator GrowthVector<T, Growth, Allocator>::erase(const_iterator first, const_iterator last) {
+        return this->_vector.erase(first, last);
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    template <typename InputIt>
+    void GrowthVector<T, Growth, Allocator>::assign(InputIt first, InputIt last) {
+        this->_vector.assign(first, last);
+    }
+
+    template <typename T, typename Growth, typename Allocator>
+    void GrowthVector<T, Growth, Allocator>::clear() {
+        this->_vector.clear();
+    }
+
+
+    // Internal Functions
+    template <typename T, typename Growth, typename Allocator>
+    void GrowthVector<T, Growth, Allocator>::_grow(size_t added) {
+        size_t required = this->_vector.size() + added;
+
+        // Reserving ahead of the vector means it never picks a capacity itself
+        if (required > this->_vector.capacity()) {
+            this->_vector.reserve(Growth::capacity(this->_vector.capacity(), required, sizeof(T)));
+        }
+    }
+}
+
+#endif // MRLIB_GROWTH_ARRAY_HPP
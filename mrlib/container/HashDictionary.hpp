@@ -0,0 +1,927 @@
+//
+// HashDictionary.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to give Dictionary constant time lookups.
+ * HashMap is an open addressing hash table that keeps one control byte per
+ * slot next to the slots themselves. A control byte is either empty,
+ * deleted, or the low seven bits of the hash of the key in that slot, so a
+ * lookup compares a whole group of sixteen control bytes at once (with
+ * SSE2 when it is available) and only compares keys whose bytes match.
+ * HashDictionary is a Dictionary that uses a HashMap for storage, so it has
+ * the same interface as Dictionary, but its keys are not kept in order.
+ *
+ * Adding an object may move every object in the table, so references to
+ * the objects of a HashMap are invalidated by adding to it.
+ *
+ * When both the hash and the key equality define is_transparent, a
+ * HashMap can be searched with any type they accept. StringHash and
+ * StringEqual accept String, std::string and const char*, so a
+ * HashDictionary<String, V, StringHash, StringEqual> can be probed with a
+ * string literal without building a temporary String.
+ */
+
+
+#ifndef MRLIB_HASH_DICTIONARY_HPP
+#define MRLIB_HASH_DICTIONARY_HPP
+
+#include <new>
+#include <tuple>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <initializer_list>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "Dictionary.hpp"
+#include "String.hpp"
+
+// Table Constants
+#define HASH_GROUP_WIDTH 16
+#define HASH_CONTROL_EMPTY int8_t(-128)
+#define HASH_CONTROL_DELETED int8_t(-2)
+#define HASH_BATCH_SIZE 16
+
+
+namespace mrlib {
+
+    // True if a hash or equality type accepts keys of other types
+    template <typename T>
+    struct HashVoid { typedef void type; };
+
+    template <typename T, typename = void>
+    struct HashTransparent : std::false_type {};
+
+    template <typename T>
+    struct HashTransparent<T, typename HashVoid<typename T::is_transparent>::type> : std::true_type {};
+
+
+    // Hashes and compares the characters of any string type, so they can be used to find each other
+    struct StringHash {
+        typedef void is_transparent;
+
+        size_t  operator()(const char* string) const;
+        size_t  operator()(const std::string& string) const;
+        size_t  operator()(const String& string) const;
+        static size_t  hash(const char* data, size_t length);
+    };
+
+    struct StringEqual {
+        typedef void is_transparent;
+
+        template <typename A, typename B>
+        bool  operator()(const A& a, const B& b) const;
+        static const char*  data(const char* string) { return string; }
+        static const char*  data(const std::string& string) { return string.data(); }
+        static const char*  data(const String& string) { return string._data.data(); }
+        static size_t       size(const char* string) { return std::strlen(string); }
+        static size_t       size(const std::string& string) { return string.size(); }
+        static size_t       size(const String& string) { return string._data.size(); }
+    };
+
+
+    // Bit masks of the slots in a group of control bytes that match
+    struct HashGroup {
+        static uint32_t  match(const int8_t* control, int8_t hash);
+        static uint32_t  matchEmpty(const int8_t* control);
+        static uint32_t  matchEmptyOrDeleted(const int8_t* control);
+        static size_t    lowestBit(uint32_t mask);
+        static void      prefetch(const void* address);
+    };
+
+
+    template <typename Table, typename Value>
+    class HashMapIterator {
+    public:
+        typedef std::forward_iterator_tag                    iterator_category;
+        typedef typename std::remove_const<Value>::type      value_type;
+        typedef std::ptrdiff_t                               difference_type;
+        typedef Value*                                       pointer;
+        typedef Value&                                       reference;
+
+        // Internal Data
+        Table*  _table;
+        size_t  _index;
+
+        // Constructors
+        HashMapIterator() : _table(nullptr), _index(0) {}
+        HashMapIterator(Table* table, size_t index) : _table(table), _index(index) { this->_skip(); }
+
+        // Conversion to const iterator
+        operator HashMapIterator<const Table, const Value>() const {
+            return HashMapIterator<const Table, const Value>(this->_table, this->_index);
+        }
+
+        // Access
+        reference  operator*() const { return this->_table->_slots[this->_index]; }
+        pointer    operator->() const { return &this->_table->_slots[this->_index]; }
+
+        // Movement
+        HashMapIterator&  operator++() { ++this->_index; this->_skip(); return *this; }
+        HashMapIterator   operator++(int) { HashMapIterator it = *this; ++*this; return it; }
+
+        // Comparison
+        bool  operator==(const HashMapIterator& it) const { return this->_index == it._index; }
+        bool  operator!=(const HashMapIterator& it) const { return this->_index != it._index; }
+
+    private:
+        void _skip() {
+            while (this->_index < this->_table->_capacity && this->_table->_control[this->_index] < 0) {
+                ++this->_index;
+            }
+        }
+    };
+
+
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    class HashMap {
+    public:
+        typedef K                                                  key_type;
+        typedef V                                                  mapped_type;
+        typedef std::pair<const K, V>                              value_type;
+        typedef HashMapIterator<HashMap, value_type>               iterator;
+        typedef HashMapIterator<const HashMap, const value_type>   const_iterator;
+        typedef size_t                                             size_type;
+
+        // Internal Data
+        int8_t*      _control;
+        value_type*  _slots;
+        size_t       _capacity;   // Zero or a power of two of at least one group
+        size_t       _size;
+        size_t       _growth_left;
+        Hash         _hash;
+        KeyEqual     _equal;
+
+        // Constructors
+        HashMap();
+        HashMap(std::initializer_list<value_type> i_list);
+        template <typename InputIt>
+        HashMap(InputIt first, InputIt last);
+        HashMap(const HashMap& map);
+        HashMap(HashMap&& map);
+        ~HashMap();
+
+        // Operator Overloading
+        V&        operator[](const K& key);
+        HashMap&  operator=(const HashMap& map);
+        HashMap&  operator=(HashMap&& map);
+        bool      operator==(const HashMap& map) const;
+        bool      operator!=(const HashMap& map) const;
+
+        // Iteration
+        iterator        begin();
+        const_iterator  begin() const;
+        iterator        end();
+        const_iterator  end() const;
+
+        // Querying Map
+        size_t          size() const;
+        bool            empty() const;
+        size_t          capacity() const;
+        size_t          count(const K& key) const;
+        iterator        find(const K& key);
+        const_iterator  find(const K& key) const;
+        template <typename Key, typename = typename std::enable_if<HashTransparent<Hash>::value && HashTransparent<KeyEqual>::value, Key>::type>
+        size_t          count(const Key& key) const;
+        template <typename Key, typename = typename std::enable_if<HashTransparent<Hash>::value && HashTransparent<KeyEqual>::value, Key>::type>
+        iterator        find(const Key& key);
+        template <typename Key, typename = typename std::enable_if<HashTransparent<Hash>::value && HashTransparent<KeyEqual>::value, Key>::type>
+        const_iterator  find(const Key& key) const;
+
+        // Batch Lookups
+        size_t          hash(const K& key) const;
+        void            prefetch(size_t hash) const;
+        iterator        find(const K& key, size_t hash);
+        const_iterator  find(const K& key, size_t hash) const;
+
+        // Modifiers
+        std::pair<iterator, bool>  insert(const value_type& value);
+        std::pair<iterator, bool>  insert(value_type&& value);
+        template <typename... Args>
+        std::pair<iterator, bool>  try_emplace(const K& key, Args&&... args);
+        template <typename... Args>
+        iterator                   emplace_missing(const K& key, size_t hash, Args&&... args);
+        size_t                     erase(const K& key);
+        iterator                   erase(const_iterator position);
+        void                       clear();
+        void                       reserve(size_t size);
+
+    private:
+        template <typename Key>
+        size_t  _hashOf(const Key& key) const;
+        template <typename Key>
+        size_t  _find(const Key& key, size_t hash) const;
+        size_t  _prepareInsert(size_t hash);
+        size_t  _freeSlot(size_t hash) const;
+        void    _eraseSlot(size_t index);
+        void    _rehash(size_t capacity);
+        void    _release();
+        static size_t  _maxSize(size_t capacity);
+    };
+
+    // Dictionary backed by a hash table instead of a tree
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    using HashDictionary = Dictionary<K, V, HashMap<K, V, Hash, KeyEqual>>;
+
+
+    // Builds the object only when the key is missing, and before adding it, since adding may move an object it was copied from
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    struct DictionaryInsert<HashMap<K, V, Hash, KeyEqual>> {
+        typedef HashMap<K, V, Hash, KeyEqual>  Storage;
+        typedef typename Storage::iterator     Iterator;
+
+        template <typename F>
+        static std::pair<Iterator, bool>  findOrEmplace(Storage& storage, const K& key, F make);
+    };
+
+
+    // Prefetches the groups of a chunk of keys before probing any of them, so their cache misses overlap
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    struct DictionaryBatch<HashMap<K, V, Hash, KeyEqual>> {
+        typedef HashMap<K, V, Hash, KeyEqual>  Storage;
+
+        static void     assign(Storage& storage, std::vector<std::pair<K, V>>& entries);
+        template <typename Map, typename Value>
+        static void     find(Map& storage, const std::vector<K>& keys, std::vector<Value*>& values);
+        static void     erase(Storage& storage, const std::vector<K>& keys);
+        static Storage  merge(const Storage& first, const Storage& second);
+    };
+
+
+    // A control byte and a slot for every slot of the table, full or not
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    struct DictionaryMemory<HashMap<K, V, Hash, KeyEqual>> {
+        static size_t  usage(const HashMap<K, V, Hash, KeyEqual>& storage);
+    };
+
+
+    ////////////////////
+    // IMPLEMENTATION //
+    ////////////////////
+
+#ifdef __SSE2__
+    inline
+    uint32_t HashGroup::match(const int8_t* control, int8_t hash) {
+        __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+        return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(hash))));
+    }
+
+    inline
+    uint32_t HashGroup::matchEmpty(const int8_t* control) {
+        __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+        return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(HASH_CONTROL_EMPTY))));
+    }
+
+    inline
+    uint32_t HashGroup::matchEmptyOrDeleted(const int8_t* control) {
+        // Empty and deleted are the only control bytes with the sign bit set
+        __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+        return uint32_t(_mm_movemask_epi8(group));
+    }
+#else
+    inline
+    uint32_t HashGroup::match(const int8_t* control, int8_t hash) {
+        uint32_t mask = 0;
+        for (size_t i = 0; i < HASH_GROUP_WIDTH; ++i) {
+            mask |= uint32_t(control[i] == hash) << i;
+        }
+
+        return mask;
+    }
+
+    inline
+    uint32_t HashGroup::matchEmpty(const int8_t* control) {
+        return match(control, HASH_CONTROL_EMPTY);
+    }
+
+    inline
+    uint32_t HashGroup::matchEmptyOrDeleted(const int8_t* control) {
+        uint32_t mask = 0;
+        for (size_t i = 0; i < HASH_GROUP_WIDTH; ++i) {
+            mask |= uint32_t(control[i] < 0) << i;
+        }
+
+        return mask;
+    }
+#endif
+
+    inline
+    size_t HashGroup::lowestBit(uint32_t mask) {
+#if defined(__GNUC__)
+        return size_t(__builtin_ctz(mask));
+#else
+        // Only sixteen bits are ever set, so a short scan is enough
+        size_t index = 0;
+        while ((mask & 1) == 0) {
+            mask >>= 1;
+            ++index;
+        }
+
+        return index;
+#endif
+    }
+
+    inline
+    void HashGroup::prefetch(const void* address) {
+#if defined(__GNUC__)
+        __builtin_prefetch(address);
+#else
+        // Only a hint, so without the builtin the first probe simply takes the miss
+        (void)address;
+#endif
+    }
+
+    inline
+    size_t StringHash::operator()(const char* string) const {
+        return hash(string, std::strlen(string));
+    }
+
+    inline
+    size_t StringHash::operator()(const std::string& string) const {
+        return hash(string.data(), string.size());
+    }
+
+    inline
+    size_t StringHash::operator()(const String& string) const {
+        return hash(string._data.data(), string._data.size());
+    }
+
+    inline
+    size_t StringHash::hash(const char* data, size_t length) {
+        // FNV-1a, HashMap mixes the result again before using it
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < length; ++i) {
+            hash = (hash ^ uint8_t(data[i])) * 1099511628211ull;
+        }
+
+        return size_t(hash);
+    }
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    template <typename A, typename B>
+    bool StringEqual::operator()(const A& a, const B& b) const {
+        size_t length = size(a);
+        return length == size(b) && std::memcmp(data(a), data(b), length) == 0;
+    }
+
+
+    // Constructors
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    HashMap<K, V, Hash, KeyEqual>::HashMap() {
+        this->_control = nullptr;
+        this->_slots = nullptr;
+        this->_capacity = 0;
+        this->_size = 0;
+        this->_growth_left = 0;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    HashMap<K, V, Hash, KeyEqual>::HashMap(std::initializer_list<value_type> i_list) : HashMap(i_list.begin(), i_list.end()) {
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename InputIt>
+    HashMap<K, V, Hash, KeyEqual>::HashMap(InputIt first, InputIt last) : HashMap() {
+        for (; first != last; ++first) {
+            this->insert(*first);
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    HashMap<K, V, Hash, KeyEqual>::HashMap(const HashMap& map) : HashMap() {
+        *this = map;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    HashMap<K, V, Hash, KeyEqual>::HashMap(HashMap&& map) : HashMap() {
+        *this = std::move(map);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    HashMap<K, V, Hash, KeyEqual>::~HashMap() {
+        this->_release();
+    }
+
+
+    // Operator Overloading
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    V& HashMap<K, V, Hash, KeyEqual>::operator[](const K& key) {
+        return this->try_emplace(key).first->second;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    HashMap<K, V, Hash, KeyEqual>& HashMap<K, V, Hash, KeyEqual>::operator=(const HashMap& map) {
+        // Check self assignment
+        if (this == &map) return *this;
+
+        this->clear();
+        this->_hash = map._hash;
+        this->_equal = map._equal;
+        this->reserve(map._size);
+
+        for (const value_type& value : map) {
+            // Keys are already unique, so each one goes straight to a free slot
+            size_t hash = this->_hashOf(value.first);
+            size_t index = this->_freeSlot(hash);
+            ::new (static_cast<void*>(&this->_slots[index])) value_type(value);
+
+            this->_control[index] = int8_t(hash & 0x7f);
+            --this->_growth_left;
+            ++this->_size;
+        }
+
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    HashMap<K, V, Hash, KeyEqual>& HashMap<K, V, Hash, KeyEqual>::operator=(HashMap&& map) {
+        // Check self assignment
+        if (this == &map) return *this;
+
+        this->_release();
+
+        this->_control = map._control;
+        this->_slots = map._slots;
+        this->_capacity = map._capacity;
+        this->_size = map._size;
+        this->_growth_left = map._growth_left;
+        this->_hash = std::move(map._hash);
+        this->_equal = std::move(map._equal);
+
+        map._control = nullptr;
+        map._slots = nullptr;
+        map._capacity = 0;
+        map._size = 0;
+        map._growth_left = 0;
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool HashMap<K, V, Hash, KeyEqual>::operator==(const HashMap& map) const {
+        if (this->_size != map._size) return false;
+
+        for (const value_type& value : *this) {
+            const_iterator it = map.find(value.first);
+            if (it == map.end() || !(it->second == value.second)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool HashMap<K, V, Hash, KeyEqual>::operator!=(const HashMap& map) const {
+        return !(*this == map);
+    }
+
+
+    // Iteration
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename HashMap<K, V, Hash, KeyEqual>::iterator HashMap<K, V, Hash, KeyEqual>::begin() {
+        return iterator(this, 0);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename HashMap<K, V, Hash, KeyEqual>::const_iterator HashMap<K, V, Hash, KeyEqual>::begin() const {
+        return const_iterator(this, 0);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename HashMap<K, V, Hash, KeyEqual>::iterator HashMap<K, V, Hash, KeyEqual>::end() {
+        return iterator(this, this->_capacity);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename HashMap<K, V, Hash, KeyEqual>::const_iterator HashMap<K, V, Hash, KeyEqual>::end() const {
+        return const_iterator(this, this->_capacity);
+    }
+
+
+    // Querying Map
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HashMap<K, V, Hash, KeyEqual>::size() const {
+        return this->_size;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool HashMap<K, V, Hash, KeyEqual>::empty() const {
+        return this->_size == 0;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HashMap<K, V, Hash, KeyEqual>::capacity() const {
+        return this->_capacity;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HashMap<K, V, Hash, KeyEqual>::count(const K& key) const {
+        return this->_find(key, this->_hashOf(key)) != this->_capacity ? 1 : 0;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename HashMap<K, V, Hash, KeyEqual>::iterator HashMap<K, V, Hash, KeyEqual>::find(const K& key) {
+        return iterator(this, this->_find(key, this->_hashOf(key)));
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename HashMap<K, V, Hash, KeyEqual>::const_iterator HashMap<K, V, Hash, KeyEqual>::find(const K& key) const {
+        return const_iterator(this, this->_find(key, this->_hashOf(key)));
+    }
+
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename Key, typename>
+    size_t HashMap<K, V, Hash, KeyEqual>::count(const Key& key) const {
+        return this->_find(key, this->_hashOf(key)) != this->_capacity ? 1 : 0;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename Key, typename>
+    typename HashMap<K, V, Hash, KeyEqual>::iterator HashMap<K, V, Hash, KeyEqual>::find(const Key& key) {
+        return iterator(this, this->_find(key, this->_hashOf(key)));
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename Key, typename>
+    typename HashMap<K, V, Hash, KeyEqual>::const_iterator HashMap<K, V, Hash, KeyEqual>::find(const Key& key) const {
+        return const_iterator(this, this->_find(key, this->_hashOf(key)));
+    }
+
+
+    // Batch Lookups
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HashMap<K, V, Hash, KeyEqual>::hash(const K& key) const {
+        return this->_hashOf(key);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    void HashMap<K, V, Hash, KeyEqual>::prefetch(size_t hash) const {
+        if (this->_capacity == 0) return;
+
+        // Loads the first group a lookup with this hash probes, so it is cached by the time find gets to it
+        size_t group = (hash >> 7) & (this->_capacity / HASH_GROUP_WIDTH - 1);
+        HashGroup::prefetch(this->_control + group * HASH_GROUP_WIDTH);
+        HashGroup::prefetch(this->_slots + group * HASH_GROUP_WIDTH);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename HashMap<K, V, Hash, KeyEqual>::iterator HashMap<K, V, Hash, KeyEqual>::find(const K& key, size_t hash) {
+        return iterator(this, this->_find(key, hash));
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename HashMap<K, V, Hash, KeyEqual>::const_iterator HashMap<K, V, Hash, KeyEqual>::find(const K& key, size_t hash) const {
+        return const_iterator(this, this->_find(key, hash));
+    }
+
+
+    // Modifiers
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    std::pair<typename HashMap<K, V, Hash, KeyEqual>::iterator, bool> HashMap<K, V, Hash, KeyEqual>::insert(const value_type& value) {
+        return this->try_emplace(value.first, value.second);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    std::pair<typename HashMap<K, V, Hash, KeyEqual>::iterator, bool> HashMap<K, V, Hash, KeyEqual>::insert(value_type&& value) {
+        return this->try_emplace(value.first, std::move(value.second));
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename... Args>
+    std::pair<typename HashMap<K, V, Hash, KeyEqual>::iterator, bool> HashMap<K, V, Hash, KeyEqual>::try_emplace(const K& key, Args&&... args) {
+        size_t hash = this->_hashOf(key);
+        size_t index = this->_find(key, hash);
+
+        if (index != this->_capacity) {
+            return std::make_pair(iterator(this, index), false);
+        }
+
+        return std::make_pair(this->emplace_missing(key, hash, std::forward<Args>(args)...), true);
+    }
+
+    // Adds a key that find(key, hash) just missed, without searching for it again
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename... Args>
+    typename HashMap<K, V, Hash, KeyEqual>::iterator HashMap<K, V, Hash, KeyEqual>::emplace_missing(const K& key, size_t hash, Args&&... args) {
+        size_t index = this->_prepareInsert(hash);
+        ::new (static_cast<void*>(&this->_slots[index])) value_type(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+
+        // Only mark the slot once the object is constructed, in case it throws
+        if (this->_control[index] == HASH_CONTROL_EMPTY) {
+            --this->_growth_left;
+        }
+
+        this->_control[index] = int8_t(hash & 0x7f);
+        ++this->_size;
+        return iterator(this, index);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HashMap<K, V, Hash, KeyEqual>::erase(const K& key) {
+        size_t index = this->_find(key, this->_hashOf(key));
+        if (index == this->_capacity) return 0;
+
+        this->_eraseSlot(index);
+        return 1;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename HashMap<K, V, Hash, KeyEqual>::iterator HashMap<K, V, Hash, KeyEqual>::erase(const_iterator position) {
+        this->_eraseSlot(position._index);
+        return iterator(this, position._index + 1);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    void HashMap<K, V, Hash, KeyEqual>::clear() {
+        for (size_t i = 0; i < this->_capacity; ++i) {
+            if (this->_control[i] >= 0) {
+                this->_slots[i].~value_type();
+            }
+        }
+
+        if (this->_capacity != 0) {
+            std::memset(this->_control, HASH_CONTROL_EMPTY, this->_capacity);
+        }
+
+        this->_size = 0;
+        this->_growth_left = _maxSize(this->_capacity);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    void HashMap<K, V, Hash, KeyEqual>::reserve(size_t size) {
+        size_t capacity = HASH_GROUP_WIDTH;
+        while (_maxSize(capacity) < size) {
+            capacity *= 2;
+        }
+
+        if (capacity > this->_capacity) {
+            this->_rehash(capacity);
+        }
+    }
+
+
+    // Internal Functions
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename Key>
+    size_t HashMap<K, V, Hash, KeyEqual>::_hashOf(const Key& key) const {
+        // Many standard hashes are the identity, so spread the bits before splitting them
+        uint64_t hash = uint64_t(this->_hash(key)) * 0x9E3779B97F4A7C15ull;
+        return size_t(hash ^ (hash >> 32));
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename Key>
+    size_t HashMap<K, V, Hash, KeyEqual>::_find(const Key& key, size_t hash) const {
+        if (this->_capacity == 0) return 0;
+
+        // The low seven bits are stored in the control byte, the rest pick the first group
+        size_t mask = this->_capacity / HASH_GROUP_WIDTH - 1;
+        size_t group = (hash >> 7) & mask;
+        int8_t tag = int8_t(hash & 0x7f);
+
+        // Triangular steps visit every group when the group count is a power of two
+        for (size_t step = 1; ; ++step) {
+            const int8_t* control = this->_control + group * HASH_GROUP_WIDTH;
+
+            for (uint32_t bits = HashGroup::match(control, tag); bits != 0; bits &= bits - 1) {
+                size_t index = group * HASH_GROUP_WIDTH + HashGroup::lowestBit(bits);
+                if (this->_equal(this->_slots[index].first, key)) {
+                    return index;
+                }
+            }
+
+            // An empty slot means the key would have been stored in this group
+            if (HashGroup::matchEmpty(control) != 0) {
+                return this->_capacity;
+            }
+
+            group = (group + step) & mask;
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HashMap<K, V, Hash, KeyEqual>::_prepareInsert(size_t hash) {
+        if (this->_capacity == 0) {
+            this->_rehash(HASH_GROUP_WIDTH);
+        }
+
+        size_t index = this->_freeSlot(hash);
+
+        // Deleted slots can be reused freely, but empty ones are limited by the load factor
+        if (this->_control[index] == HASH_CONTROL_EMPTY && this->_growth_left == 0) {
+            if (this->_size + 1 > _maxSize(this->_capacity) / 2) {
+                this->_rehash(std::max(this->_capacity * 2, size_t(HASH_GROUP_WIDTH)));
+            }
+            else {
+                // Mostly deleted slots, so rehash at the same size to clear them
+                this->_rehash(this->_capacity);
+            }
+
+            index = this->_freeSlot(hash);
+        }
+
+        return index;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HashMap<K, V, Hash, KeyEqual>::_freeSlot(size_t hash) const {
+        if (this->_capacity == 0) return 0;
+
+        size_t mask = this->_capacity / HASH_GROUP_WIDTH - 1;
+        size_t group = (hash >> 7) & mask;
+
+        for (size_t step = 1; ; ++step) {
+            uint32_t bits = HashGroup::matchEmptyOrDeleted(this->_control + group * HASH_GROUP_WIDTH);
+            if (bits != 0) {
+                return group * HASH_GROUP_WIDTH + HashGroup::lowestBit(bits);
+            }
+
+            group = (group + step) & mask;
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    void HashMap<K, V, Hash, KeyEqual>::_eraseSlot(size_t index) {
+        this->_slots[index].~value_type();
+        --this->_size;
+
+        // A group with an empty slot has never been full, so no probe has passed over it
+        const int8_t* control = this->_control + index / HASH_GROUP_WIDTH * HASH_GROUP_WIDTH;
+        if (HashGroup::matchEmpty(control) != 0) {
+            this->_control[index] = HASH_CONTROL_EMPTY;
+            ++this->_growth_left;
+        }
+        else {
+            this->_control[index] = HASH_CONTROL_DELETED;
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    void HashMap<K, V, Hash, KeyEqual>::_rehash(size_t capacity) {
+        int8_t* old_control = this->_control;
+        value_type* old_slots = this->_slots;
+        size_t old_capacity = this->_capacity;
+
+        this->_control = static_cast<int8_t*>(::operator new(capacity));
+        this->_slots = static_cast<value_type*>(::operator new(capacity * sizeof(value_type)));
+        this->_capacity = capacity;
+        std::memset(this->_control, HASH_CONTROL_EMPTY, capacity);
+
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (old_control[i] < 0) continue;
+
+            size_t hash = this->_hashOf(old_slots[i].first);
+            size_t index = this->_freeSlot(hash);
+            ::new (static_cast<void*>(&this->_slots[index])) value_type(std::move(old_slots[i]));
+            old_slots[i].~value_type();
+
+            this->_control[index] = int8_t(hash & 0x7f);
+        }
+
+        this->_growth_left = _maxSize(capacity) - this->_size;
+
+        ::operator delete(old_control);
+        ::operator delete(old_slots);
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    void HashMap<K, V, Hash, KeyEqual>::_release() {
+        this->clear();
+
+        ::operator delete(this->_control);
+        ::operator delete(this->_slots);
+
+        this->_control = nullptr;
+        this->_slots = nullptr;
+        this->_capacity = 0;
+        this->_growth_left = 0;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t HashMap<K, V, Hash, KeyEqual>::_maxSize(size_t capacity) {
+        // Keep at least one slot in eight empty so every probe ends
+        return capacity - capacity / 8;
+    }
+
+
+    // Storage Insert
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename F>
+    std::pair<typename HashMap<K, V, Hash, KeyEqual>::iterator, bool> DictionaryInsert<HashMap<K, V, Hash, KeyEqual>>::findOrEmplace(Storage& storage, const K& key, F make) {
+        size_t hash = storage.hash(key);
+        auto it = storage.find(key, hash);
+        if (it != storage.end()) {
+            return std::make_pair(it, false);
+        }
+
+        // make() may return a reference into this table, so the object is copied out before a rehash can move it
+        V value = make();
+        return std::make_pair(storage.emplace_missing(key, hash, std::move(value)), true);
+    }
+
+
+    // Batch Storage
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    void DictionaryBatch<HashMap<K, V, Hash, KeyEqual>>::assign(Storage& storage, std::vector<std::pair<K, V>>& entries) {
+        // Grows at most once, some of the keys may already exist
+        storage.reserve(storage.size() + entries.size());
+
+        for (std::pair<K, V>& entry : entries) {
+            auto result = storage.try_emplace(entry.first, std::move(entry.second));
+            if (!result.second) {
+                result.first->second = std::move(entry.second);
+            }
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename Map, typename Value>
+    void DictionaryBatch<HashMap<K, V, Hash, KeyEqual>>::find(Map& storage, const std::vector<K>& keys, std::vector<Value*>& values) {
+        values.assign(keys.size(), nullptr);
+        size_t hashes[HASH_BATCH_SIZE];
+
+        for (size_t begin = 0; begin < keys.size(); begin += HASH_BATCH_SIZE) {
+            size_t end = std::min(begin + HASH_BATCH_SIZE, keys.size());
+
+            for (size_t i = begin; i < end; ++i) {
+                hashes[i - begin] = storage.hash(keys[i]);
+                storage.prefetch(hashes[i - begin]);
+            }
+
+            for (size_t i = begin; i < end; ++i) {
+                auto it = storage.find(keys[i], hashes[i - begin]);
+                if (it != storage.end()) {
+                    values[i] = &it->second;
+                }
+            }
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    void DictionaryBatch<HashMap<K, V, Hash, KeyEqual>>::erase(Storage& storage, const std::vector<K>& keys) {
+        size_t hashes[HASH_BATCH_SIZE];
+
+        // Erasing never moves the table, so the prefetched groups stay valid
+        for (size_t begin = 0; begin < keys.size(); begin += HASH_BATCH_SIZE) {
+            size_t end = std::min(begin + HASH_BATCH_SIZE, keys.size());
+
+            for (size_t i = begin; i < end; ++i) {
+                hashes[i - begin] = storage.hash(keys[i]);
+                storage.prefetch(hashes[i - begin]);
+            }
+
+            for (size_t i = begin; i < end; ++i) {
+                auto it = storage.find(keys[i], hashes[i - begin]);
+                if (it != storage.end()) {
+                    storage.erase(it);
+                }
+            }
+        }
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    HashMap<K, V, Hash, KeyEqual> DictionaryBatch<HashMap<K, V, Hash, KeyEqual>>::merge(const Storage& first, const Storage& second) {
+        // Reserving before anything is added sizes the table once, copying first would size it for first alone
+        Storage storage = Storage();
+        storage._hash = first._hash;
+        storage._equal = first._equal;
+        storage.reserve(first.size() + second.size());
+
+        // The keys of first are all different, so they are added without searching for them
+        for (const auto& entry : first) {
+            storage.emplace_missing(entry.first, storage.hash(entry.first), entry.second);
+        }
+
+        for (const auto& entry : second) {
+            storage[entry.first] = entry.second;
+        }
+
+        return storage;
+    }
+
+
+    // Storage Memory
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t DictionaryMemory<HashMap<K, V, Hash, KeyEqual>>::usage(const HashMap<K, V, Hash, KeyEqual>& storage) {
+        return storage.capacity() * (sizeof(int8_t) + sizeof(typename HashMap<K, V, Hash, KeyEqual>::value_type));
+    }
+}
+
+#endif // MRLIB_HASH_DICTIONARY_HPP
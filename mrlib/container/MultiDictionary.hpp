@@ -0,0 +1,322 @@
+//
+// MultiDictionary.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to map each key to any number of objects.
+ * The objects of a key are kept next to each other in one vector, which is
+ * found with a single HashMap lookup and appended to in place, so adding
+ * an object never copies the objects already there. objectsForKey returns
+ * an ArraySlice over them rather than a copy.
+ *
+ * A key is in the dictionary for as long as it has at least one object,
+ * so removing the last object of a key removes the key. size() is the
+ * number of keys and objectCount() the number of objects of all keys.
+ * Iterating gives each key and its vector read only, since changing a
+ * vector in place would leave the object count wrong.
+ */
+
+
+#ifndef MRLIB_MULTI_DICTIONARY_HPP
+#define MRLIB_MULTI_DICTIONARY_HPP
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+
+#include "Array.hpp"
+#include "HashDictionary.hpp"
+#include "DescriptionWriter.hpp"
+
+
+namespace mrlib {
+
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    class MultiDictionary {
+    public:
+        typedef HashMap<K, std::vector<V>, Hash, KeyEqual>  Storage;
+        typedef typename Storage::const_iterator            iterator;
+        typedef typename Storage::const_iterator            const_iterator;
+
+        // Internal Data
+        Storage  _data;
+        size_t   _count;   // Objects of all keys
+
+        // Constructors
+        MultiDictionary();
+        MultiDictionary(std::initializer_list<std::pair<K, V>> i_list);
+
+        // Operator Overloading
+        bool  operator==(const MultiDictionary<K, V, Hash, KeyEqual>& dictionary) const;
+        bool  operator!=(const MultiDictionary<K, V, Hash, KeyEqual>& dictionary) const;
+
+        // Iteration
+        const_iterator  begin() const;
+        const_iterator  end() const;
+
+        // Querying Dictionary
+        ArraySlice<V>   objectsForKey(const K& key) const;
+        V*              firstObject(const K& key);
+        const V*        firstObject(const K& key) const;
+        bool            containsKey(const K& key) const;
+        bool            containsObject(const K& key, const V& object) const;
+        size_t          countForKey(const K& key) const;
+        size_t          size() const;
+        size_t          objectCount() const;
+        bool            isEmpty() const;
+        std::vector<K>  getKeys() const;
+
+        // Adding Objects
+        MultiDictionary<K, V, Hash, KeyEqual>&  addObject(const K& key, const V& object);
+        MultiDictionary<K, V, Hash, KeyEqual>&  addObject(const K& key, V&& object);
+        template <typename InputIt>
+        MultiDictionary<K, V, Hash, KeyEqual>&  addObjects(const K& key, InputIt first, InputIt last);
+        MultiDictionary<K, V, Hash, KeyEqual>&  addObjects(const K& key, std::initializer_list<V> i_list);
+        MultiDictionary<K, V, Hash, KeyEqual>&  merge(const MultiDictionary<K, V, Hash, KeyEqual>& dictionary);
+
+        // Removing Objects
+        MultiDictionary<K, V, Hash, KeyEqual>&  remove(const K& key);
+        MultiDictionary<K, V, Hash, KeyEqual>&  removeObject(const K& key, const V& object);
+        MultiDictionary<K, V, Hash, KeyEqual>&  removeAll();
+
+        // String Representation
+        std::string  description() const;
+
+        // Dictionary Copy
+        MultiDictionary<K, V, Hash, KeyEqual>  copy() const;
+    };
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    MultiDictionary<K, V, Hash, KeyEqual>::MultiDictionary() {
+        this->_count = 0;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    MultiDictionary<K, V, Hash, KeyEqual>::MultiDictionary(std::initializer_list<std::pair<K, V>> i_list) : MultiDictionary() {
+        for (const std::pair<K, V>& pair : i_list) {
+            this->addObject(pair.first, pair.second);
+        }
+    }
+
+
+    // Operator Overloading
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool MultiDictionary<K, V, Hash, KeyEqual>::operator==(const MultiDictionary<K, V, Hash, KeyEqual>& dictionary) const {
+        return this->_count == dictionary._count && this->_data == dictionary._data;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool MultiDictionary<K, V, Hash, KeyEqual>::operator!=(const MultiDictionary<K, V, Hash, KeyEqual>& dictionary) const {
+        return !(*this == dictionary);
+    }
+
+
+    // Iteration
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename MultiDictionary<K, V, Hash, KeyEqual>::const_iterator MultiDictionary<K, V, Hash, KeyEqual>::begin() const {
+        return this->_data.begin();
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    typename MultiDictionary<K, V, Hash, KeyEqual>::const_iterator MultiDictionary<K, V, Hash, KeyEqual>::end() const {
+        return this->_data.end();
+    }
+
+
+    // Querying Dictionary
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    ArraySlice<V> MultiDictionary<K, V, Hash, KeyEqual>::objectsForKey(const K& key) const {
+        // The slice is only valid until objects are next added to or removed from the key
+        const_iterator it = this->_data.find(key);
+        if (it == this->_data.end()) {
+            return ArraySlice<V>();
+        }
+
+        return ArraySlice<V>(it->second.data(), it->second.size());
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    V* MultiDictionary<K, V, Hash, KeyEqual>::firstObject(const K& key) {
+        typename Storage::iterator it = this->_data.find(key);
+        return it != this->_data.end() ? &it->second.front() : nullptr;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    const V* MultiDictionary<K, V, Hash, KeyEqual>::firstObject(const K& key) const {
+        const_iterator it = this->_data.find(key);
+        return it != this->_data.end() ? &it->second.front() : nullptr;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool MultiDictionary<K, V, Hash, KeyEqual>::containsKey(const K& key) const {
+        return this->_data.count(key) != 0;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool MultiDictionary<K, V, Hash, KeyEqual>::containsObject(const K& key, const V& object) const {
+        const_iterator it = this->_data.find(key);
+        return it != this->_data.end() && std::find(it->second.begin(), it->second.end(), object) != it->second.end();
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t MultiDictionary<K, V, Hash, KeyEqual>::countForKey(const K& key) const {
+        const_iterator it = this->_data.find(key);
+        return it != this->_data.end() ? it->second.size() : 0;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t MultiDictionary<K, V, Hash, KeyEqual>::size() const {
+        return this->_data.size();
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    size_t MultiDictionary<K, V, Hash, KeyEqual>::objectCount() const {
+        return this->_count;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    bool MultiDictionary<K, V, Hash, KeyEqual>::isEmpty() const {
+        return this->_data.empty();
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    std::vector<K> MultiDictionary<K, V, Hash, KeyEqual>::getKeys() const {
+        std::vector<K> keys = std::vector<K>();
+        keys.reserve(this->_data.size());
+        for (const auto& pair : this->_data) {
+            keys.push_back(pair.first);
+        }
+
+        return keys;
+    }
+
+
+    // Adding Objects
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    MultiDictionary<K, V, Hash, KeyEqual>& MultiDictionary<K, V, Hash, KeyEqual>::addObject(const K& key, const V& object) {
+        this->_data[key].push_back(object);
+        ++this->_count;
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    MultiDictionary<K, V, Hash, KeyEqual>& MultiDictionary<K, V, Hash, KeyEqual>::addObject(const K& key, V&& object) {
+        this->_data[key].push_back(std::move(object));
+        ++this->_count;
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    template <typename InputIt>
+    MultiDictionary<K, V, Hash, KeyEqual>& MultiDictionary<K, V, Hash, KeyEqual>::addObjects(const K& key, InputIt first, InputIt last) {
+        if (first == last) return *this;
+
+        std::vector<V>& objects = this->_data[key];
+        size_t size = objects.size();
+        objects.insert(objects.end(), first, last);
+        this->_count += objects.size() - size;
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    MultiDictionary<K, V, Hash, KeyEqual>& MultiDictionary<K, V, Hash, KeyEqual>::addObjects(const K& key, std::initializer_list<V> i_list) {
+        return this->addObjects(key, i_list.begin(), i_list.end());
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    MultiDictionary<K, V, Hash, KeyEqual>& MultiDictionary<K, V, Hash, KeyEqual>::merge(const MultiDictionary<K, V, Hash, KeyEqual>& dictionary) {
+        // Check self merge, which would append to the vectors being read
+        if (this == &dictionary) {
+            MultiDictionary<K, V, Hash, KeyEqual> copy = dictionary;
+            return this->merge(copy);
+        }
+
+        this->_data.reserve(this->_data.size() + dictionary._data.size());
+        for (const auto& pair : dictionary._data) {
+            this->addObjects(pair.first, pair.second.begin(), pair.second.end());
+        }
+
+        return *this;
+    }
+
+
+    // Removing Objects
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    MultiDictionary<K, V, Hash, KeyEqual>& MultiDictionary<K, V, Hash, KeyEqual>::remove(const K& key) {
+        typename Storage::iterator it = this->_data.find(key);
+        if (it != this->_data.end()) {
+            this->_count -= it->second.size();
+            this->_data.erase(it);
+        }
+
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    MultiDictionary<K, V, Hash, KeyEqual>& MultiDictionary<K, V, Hash, KeyEqual>::removeObject(const K& key, const V& object) {
+        typename Storage::iterator it = this->_data.find(key);
+        if (it == this->_data.end()) return *this;
+
+        // Only the first equal object is removed, and the rest keep their order
+        std::vector<V>& objects = it->second;
+        auto found = std::find(objects.begin(), objects.end(), object);
+        if (found == objects.end()) return *this;
+
+        objects.erase(found);
+        --this->_count;
+        if (objects.empty()) {
+            this->_data.erase(it);
+        }
+
+        return *this;
+    }
+
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    MultiDictionary<K, V, Hash, KeyEqual>& MultiDictionary<K, V, Hash, KeyEqual>::removeAll() {
+        this->_data.clear();
+        this->_count = 0;
+        return *this;
+    }
+
+
+    // String Representation
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    std::string MultiDictionary<K, V, Hash, KeyEqual>::description() const {
+        DescriptionWriter writer;
+        writer.write('{');
+
+        bool first = true;
+        for (const auto& pair : this->_data) {
+            if (!first) {
+                writer.write(", ", 2);
+            }
+
+            writer.value(pair.first).write(" => ", 4).sequence(pair.second.begin(), pair.second.size());
+            first = false;
+        }
+
+        writer.write('}');
+        return writer.take();
+    }
+
+
+    // Dictionary Copy
+    template <typename K, typename V, typename Hash, typename KeyEqual>
+    MultiDictionary<K, V, Hash, KeyEqual> MultiDictionary<K, V, Hash, KeyEqual>::copy() const {
+        return MultiDictionary<K, V, Hash, KeyEqual>(*this);
+    }
+}
+
+#endif // MRLIB_MULTI_DICTIONARY_HPP
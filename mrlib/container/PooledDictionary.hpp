@@ -0,0 +1,282 @@
+//
+// PooledDictionary.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to make node based dictionaries smaller.
+ * A std::map allocates every node on its own, and the heap adds a header
+ * and rounds every node up, which for small keys and objects is a large
+ * part of each entry. PoolResource hands out blocks carved from large
+ * slabs instead, so a node only takes its own size, and freed nodes are
+ * kept for the next node of the same size rather than returned to the
+ * heap. The slabs are released when the resource is destroyed.
+ *
+ * PoolAllocator is a standard allocator that shares a PoolResource between
+ * its copies, so it can be given to any node based container.
+ * PooledDictionary is a Dictionary whose std::map uses it. A copy of a
+ * container gets a pool of its own, and a PoolResource is not thread safe,
+ * so one pooled dictionary must only be used by one thread at a time.
+ * Moving a container hands its pool to the new one, and the moved from
+ * container starts a new pool the next time it adds a key.
+ *
+ * The packed layouts are FlatDictionary and HashDictionary, which store
+ * their objects next to each other with no node at all. memoryUsage()
+ * reports the bytes of each of them, so they can be compared.
+ */
+
+
+#ifndef MRLIB_POOLED_DICTIONARY_HPP
+#define MRLIB_POOLED_DICTIONARY_HPP
+
+#include <map>
+#include <new>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+#include "Dictionary.hpp"
+
+// Pool Constants
+#define POOL_SLAB_SIZE (64 * 1024)
+#define POOL_ALIGNMENT 8
+#define POOL_MAX_BLOCK 256
+
+
+namespace mrlib {
+
+    class PoolResource {
+    public:
+        // Internal Data
+        std::vector<void*>  _slabs;
+        void*               _free[POOL_MAX_BLOCK / POOL_ALIGNMENT];   // Freed blocks of each size, each linked to the next by its first bytes
+        char*               _cursor;      // First unused byte of the newest slab
+        size_t              _remaining;
+        size_t              _used;        // Bytes handed out and not yet returned
+        size_t              _large;       // Bytes of blocks too large to pool, taken from the heap directly
+
+        // Constructors
+        PoolResource();
+        PoolResource(const PoolResource&) = delete;
+        ~PoolResource();
+
+        // Operator Overloading
+        PoolResource&  operator=(const PoolResource&) = delete;
+
+        // Allocating Memory
+        void*   allocate(size_t size);
+        void    deallocate(void* pointer, size_t size);
+
+        // Querying Memory
+        size_t  reserved() const;
+        size_t  used() const;
+
+    private:
+        static size_t  _blockSize(size_t size);
+    };
+
+
+    template <typename T>
+    class PoolAllocator {
+        static_assert(alignof(T) <= POOL_ALIGNMENT, "PoolAllocator: Blocks are only aligned to POOL_ALIGNMENT");
+
+    public:
+        typedef T               value_type;
+        typedef std::true_type  propagate_on_container_move_assignment;
+        typedef std::true_type  propagate_on_container_swap;
+
+        // Internal Data
+        std::shared_ptr<PoolResource>  _resource;
+
+        // Constructors
+        PoolAllocator();
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U>& allocator);
+
+        // Operator Overloading
+        template <typename U>
+        bool  operator==(const PoolAllocator<U>& allocator) const;
+        template <typename U>
+        bool  operator!=(const PoolAllocator<U>& allocator) const;
+
+        // Allocating Memory
+        T*             allocate(size_t count);
+        void           deallocate(T* pointer, size_t count);
+        PoolAllocator  select_on_container_copy_construction() const;
+    };
+
+
+    // Dictionary whose tree nodes come from a pool
+    template <typename K, typename V, typename Compare = std::less<K>>
+    using PooledDictionary = Dictionary<K, V, std::map<K, V, Compare, PoolAllocator<std::pair<const K, V>>>>;
+
+
+    // Every slab of the pool, which is exact rather than an estimate
+    template <typename K, typename V, typename Compare>
+    struct DictionaryMemory<std::map<K, V, Compare, PoolAllocator<std::pair<const K, V>>>> {
+        static size_t  usage(const std::map<K, V, Compare, PoolAllocator<std::pair<const K, V>>>& storage);
+    };
+
+
+    ////////////////////
+    // IMPLEMENTATION //
+    ////////////////////
+
+    // Constructors
+    inline
+    PoolResource::PoolResource() {
+        for (size_t i = 0; i < POOL_MAX_BLOCK / POOL_ALIGNMENT; ++i) {
+            this->_free[i] = nullptr;
+        }
+
+        this->_cursor = nullptr;
+        this->_remaining = 0;
+        this->_used = 0;
+        this->_large = 0;
+    }
+
+    inline
+    PoolResource::~PoolResource() {
+        for (void* slab : this->_slabs) {
+            ::operator delete(slab);
+        }
+    }
+
+
+    // Allocating Memory
+    inline
+    void* PoolResource::allocate(size_t size) {
+        size_t block = _blockSize(size);
+        if (block > POOL_MAX_BLOCK) {
+            void* pointer = ::operator new(block);
+            this->_large += block;
+            this->_used += block;
+            return pointer;
+        }
+
+        void*& free = this->_free[block / POOL_ALIGNMENT - 1];
+        if (free != nullptr) {
+            void* pointer = free;
+            free = *static_cast<void**>(pointer);
+            this->_used += block;
+            return pointer;
+        }
+
+        // The rest of a slab too small for this block is left unused
+        if (this->_remaining < block) {
+            this->_slabs.reserve(this->_slabs.size() + 1);
+            this->_cursor = static_cast<char*>(::operator new(POOL_SLAB_SIZE));
+            this->_slabs.push_back(this->_cursor);
+            this->_remaining = POOL_SLAB_SIZE;
+        }
+
+        void* pointer = this->_cursor;
+        this->_cursor += block;
+        this->_remaining -= block;
+        this->_used += block;
+        return pointer;
+    }
+
+    inline
+    void PoolResource::deallocate(void* pointer, size_t size) {
+        size_t block = _blockSize(size);
+        this->_used -= block;
+
+        if (block > POOL_MAX_BLOCK) {
+            ::operator delete(pointer);
+            this->_large -= block;
+            return;
+        }
+
+        void*& free = this->_free[block / POOL_ALIGNMENT - 1];
+        *static_cast<void**>(pointer) = free;
+        free = pointer;
+    }
+
+
+    // Querying Memory
+    inline
+    size_t PoolResource::reserved() const {
+        return this->_slabs.size() * POOL_SLAB_SIZE + this->_large;
+    }
+
+    inline
+    size_t PoolResource::used() const {
+        return this->_used;
+    }
+
+
+    // Internal Functions
+    inline
+    size_t PoolResource::_blockSize(size_t size) {
+        // Every block can hold the link of the free list
+        size_t block = (size + POOL_ALIGNMENT - 1) / POOL_ALIGNMENT * POOL_ALIGNMENT;
+        return block < sizeof(void*) ? sizeof(void*) : block;
+    }
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename T>
+    PoolAllocator<T>::PoolAllocator() : _resource(std::make_shared<PoolResource>()) {
+    }
+
+    template <typename T>
+    template <typename U>
+    PoolAllocator<T>::PoolAllocator(const PoolAllocator<U>& allocator) : _resource(allocator._resource) {
+    }
+
+
+    // Operator Overloading
+    template <typename T>
+    template <typename U>
+    bool PoolAllocator<T>::operator==(const PoolAllocator<U>& allocator) const {
+        return this->_resource == allocator._resource;
+    }
+
+    template <typename T>
+    template <typename U>
+    bool PoolAllocator<T>::operator!=(const PoolAllocator<U>& allocator) const {
+        return this->_resource != allocator._resource;
+    }
+
+
+    // Allocating Memory
+    template <typename T>
+    T* PoolAllocator<T>::allocate(size_t count) {
+        // A moved from allocator gave its pool away, so it needs a new one
+        if (!this->_resource) {
+            this->_resource = std::make_shared<PoolResource>();
+        }
+
+        return static_cast<T*>(this->_resource->allocate(count * sizeof(T)));
+    }
+
+    template <typename T>
+    void PoolAllocator<T>::deallocate(T* pointer, size_t count) {
+        this->_resource->deallocate(pointer, count * sizeof(T));
+    }
+
+    template <typename T>
+    PoolAllocator<T> PoolAllocator<T>::select_on_container_copy_construction() const {
+        // A copy gets its own pool, so the two containers can be used apart
+        return PoolAllocator<T>();
+    }
+
+
+    // Storage Memory
+    template <typename K, typename V, typename Compare>
+    size_t DictionaryMemory<std::map<K, V, Compare, PoolAllocator<std::pair<const K, V>>>>::usage(const std::map<K, V, Compare, PoolAllocator<std::pair<const K, V>>>& storage) {
+        PoolAllocator<std::pair<const K, V>> allocator = storage.get_allocator();
+        return allocator._resource ? allocator._resource->reserved() : 0;
+    }
+}
+
+#endif // MRLIB_POOLED_DICTIONARY_HPP
@@ -0,0 +1,1088 @@
+//
+// RadixDictionary.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to find String keys by their prefix. A
+ * RadixDictionary is an adaptive radix tree, where each node branches on
+ * one byte of the key and a key is found by following its bytes, so
+ * looking one up takes time in the length of the key rather than in the
+ * number of keys. Every key that starts with a prefix is below the node
+ * that prefix leads to, so they can be visited without looking at any
+ * other key, and the longest key that is a prefix of another string is the
+ * last one passed on the way down.
+ *
+ * Runs of bytes that do not branch are kept in the node they lead to
+ * rather than as a chain of nodes. Nodes come in four sizes: a node with up
+ * to 4 or 16 children keeps their bytes in a sorted array, which for 16 is
+ * searched with HashGroup like the control bytes of a HashDictionary, a
+ * node with up to 48 children maps every byte to one of its 48 slots, and
+ * a node with more has a slot for every byte. A node grows into the next
+ * size when it is full and shrinks again when most of it is empty.
+ *
+ * Each key and its object are stored together outside the tree, so
+ * iterating gives the same pairs as a Dictionary<String, V>, in the same
+ * order. It has the functions of a Dictionary for looking up, adding,
+ * removing and replacing keys, but not its operators for combining
+ * dictionaries, its batch functions, default object, memoryUsage or
+ * inspect.
+ */
+
+
+#ifndef MRLIB_RADIX_DICTIONARY_HPP
+#define MRLIB_RADIX_DICTIONARY_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <initializer_list>
+
+#include "String.hpp"
+#include "Dictionary.hpp"
+#include "HashDictionary.hpp"
+
+// Node Constants, the most children each size of node can hold
+#define RADIX_NODE_4 4
+#define RADIX_NODE_16 16
+#define RADIX_NODE_48 48
+#define RADIX_NODE_256 256
+#define RADIX_NODE_UNVISITED size_t(-1)
+
+// Key exceptions
+#define RADIX_DICTIONARY_MISSING_KEY std::invalid_argument("RadixDictionary: Key does not exist in dictionary")
+#define RADIX_DICTIONARY_DUPLICATE_KEY std::invalid_argument("RadixDictionary: Cannot add key that already exists")
+#define RADIX_DICTIONARY_REPLACE_MISSING std::invalid_argument("RadixDictionary: Cannot replace key that doesn't exist")
+
+namespace mrlib {
+
+    template <typename V>
+    struct RadixNode {
+        typedef std::pair<const String, V> value_type;
+
+        // Internal Data
+        std::string  _prefix;   // Bytes between the byte that led here and the first byte this node branches on
+        value_type*  _leaf;     // The key that ends at this node
+        uint16_t     _kind;
+        uint16_t     _count;
+
+        // Node Operations
+        static RadixNode*   create(uint16_t kind);
+        static RadixNode*   clone(const RadixNode* node);
+        static void         destroy(RadixNode* node);
+        static void         release(RadixNode* node);
+        static RadixNode**  findChild(RadixNode* node, unsigned char byte);
+        static RadixNode*   nextChild(const RadixNode* node, size_t& position, unsigned char& byte);
+        static void         addChild(RadixNode*& node, unsigned char byte, RadixNode* child);
+        static void         removeChild(RadixNode*& node, unsigned char byte);
+
+    private:
+        static RadixNode*  _resize(RadixNode* node, uint16_t kind);
+        static void        _insertChild(RadixNode* node, unsigned char byte, RadixNode* child);
+    };
+
+    template <typename V, size_t N>
+    struct RadixNodeSorted : RadixNode<V> {
+        unsigned char  _keys[N];
+        RadixNode<V>*  _children[N];
+    };
+
+    template <typename V>
+    struct RadixNode48 : RadixNode<V> {
+        unsigned char  _index[256];     // One more than the slot of the child for each byte, zero for none
+        RadixNode<V>*  _children[RADIX_NODE_48];
+    };
+
+    template <typename V>
+    struct RadixNode256 : RadixNode<V> {
+        RadixNode<V>*  _children[256];
+    };
+
+
+    // Visits the keys below a node in order
+    template <typename V, typename Value>
+    class RadixIterator {
+    public:
+        typedef std::forward_iterator_tag  iterator_category;
+        typedef Value                      value_type;
+        typedef std::ptrdiff_t             difference_type;
+        typedef Value*                     pointer;
+        typedef Value&                     reference;
+
+        // Internal Data
+        std::vector<std::pair<const RadixNode<V>*, size_t>>  _stack;   // Each node on the path and the position of its next child
+        Value*                                               _current;
+
+        // Constructors
+        RadixIterator();
+        RadixIterator(const RadixNode<V>* node);
+
+        // Operator Overloading
+        Value&          operator*() const;
+        Value*          operator->() const;
+        RadixIterator&  operator++();
+        RadixIterator   operator++(int);
+        bool            operator==(const RadixIterator& iterator) const;
+        bool            operator!=(const RadixIterator& iterator) const;
+
+    private:
+        void  _advance();
+    };
+
+
+    template <typename Iterator>
+    class RadixRange {
+    public:
+        // Internal Data
+        Iterator  _begin;
+        Iterator  _end;
+
+        // Constructors
+        RadixRange(Iterator begin, Iterator end);
+
+        // Iteration
+        Iterator  begin() const;
+        Iterator  end() const;
+
+        // Querying Range
+        bool  isEmpty() const;
+    };
+
+
+    template <typename V>
+    class RadixDictionary {
+    public:
+        typedef RadixNode<V>                                 Node;
+        typedef std::pair<const String, V>                   value_type;
+        typedef RadixIterator<V, value_type>                 iterator;
+        typedef RadixIterator<V, const value_type>           const_iterator;
+
+        // Internal Data
+        Node*   _root;
+        size_t  _size;
+
+        // Constructors
+        RadixDictionary();
+        RadixDictionary(std::initializer_list<value_type> i_list);
+        template <typename Storage>
+        RadixDictionary(const Dictionary<String, V, Storage>& dictionary);
+        RadixDictionary(const RadixDictionary<V>& dictionary);
+        RadixDictionary(RadixDictionary<V>&& dictionary);
+        ~RadixDictionary();
+
+        // Operator Overloading
+        V&                   operator[](const String& key);
+        RadixDictionary<V>&  operator=(const RadixDictionary<V>& dictionary);
+        RadixDictionary<V>&  operator=(RadixDictionary<V>&& dictionary);
+        bool                 operator==(const RadixDictionary<V>& dictionary) const;
+        bool                 operator!=(const RadixDictionary<V>& dictionary) const;
+
+        // Iteration
+        iterator        begin();
+        const_iterator  begin() const;
+        iterator        end();
+        const_iterator  end() const;
+
+        // Querying Dictionary
+        V                    objectForKey(const String& key) const;
+        V*                   tryGet(const String& key);
+        const V*             tryGet(const String& key) const;
+        bool                 containsKey(const String& key) const;
+        size_t               size() const;
+        bool                 isEmpty() const;
+        std::vector<String>  getKeys() const;
+        std::vector<V>       getValues() const;
+
+        // Prefix Queries
+        RadixRange<iterator>        withPrefix(const String& prefix);
+        RadixRange<const_iterator>  withPrefix(const String& prefix) const;
+        std::vector<String>         getKeysWithPrefix(const String& prefix) const;
+        value_type*                 longestPrefixOf(const String& key);
+        const value_type*           longestPrefixOf(const String& key) const;
+
+        // Adding Objects
+        RadixDictionary<V>&  addObject(const String& key, const V& value);
+        template <typename F>
+        V&                   getOrInsert(const String& key, F factory);
+        RadixDictionary<V>&  insertOrAssign(const String& key, const V& value);
+        template <typename F>
+        RadixDictionary<V>&  upsert(const String& key, F function);
+
+        // Removing Objects
+        RadixDictionary<V>&  remove(const String& key);
+        RadixDictionary<V>&  removeObjects(const std::vector<String>& keys);
+        RadixDictionary<V>&  removeAll();
+
+        // Replace Objects
+        RadixDictionary<V>&  replace(const String& key, const V& new_value);
+
+        // Getting Standard Containers
+        std::map<String, V>  std_map() const;
+
+        // String Representation
+        std::string  description() const;
+        void         describeTo(DescriptionWriter& writer) const;
+
+        // Dictionary Copy
+        RadixDictionary<V>  copy() const;
+
+    private:
+        template <typename F>
+        std::pair<value_type*, bool>  _insert(const String& key, F make);
+        Node*                         _find(const std::string& key) const;
+        Node*                         _subtree(const std::string& prefix) const;
+        static size_t                 _match(const std::string& prefix, const std::string& key, size_t depth);
+        static void                   _compress(Node*& node);
+    };
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Node Operations
+    template <typename V>
+    RadixNode<V>* RadixNode<V>::create(uint16_t kind) {
+        // Value initialization zeroes the children and index of every size
+        RadixNode<V>* node = nullptr;
+        switch (kind) {
+            case RADIX_NODE_4:   node = new RadixNodeSorted<V, RADIX_NODE_4>(); break;
+            case RADIX_NODE_16:  node = new RadixNodeSorted<V, RADIX_NODE_16>(); break;
+            case RADIX_NODE_48:  node = new RadixNode48<V>(); break;
+            default:             node = new RadixNode256<V>(); break;
+        }
+
+        node->_kind = kind;
+        return node;
+    }
+
+    template <typename V>
+    RadixNode<V>* RadixNode<V>::clone(const RadixNode<V>* node) {
+        RadixNode<V>* copy = RadixNode<V>::create(node->_kind);
+        copy->_prefix = node->_prefix;
+        copy->_leaf = node->_leaf != nullptr ? new value_type(*node->_leaf) : nullptr;
+
+        size_t position = 0;
+        unsigned char byte = 0;
+        while (const RadixNode<V>* child = RadixNode<V>::nextChild(node, position, byte)) {
+            RadixNode<V>::_insertChild(copy, byte, RadixNode<V>::clone(child));
+        }
+
+        return copy;
+    }
+
+    template <typename V>
+    void RadixNode<V>::destroy(RadixNode<V>* node) {
+        size_t position = 0;
+        unsigned char byte = 0;
+        while (RadixNode<V>* child = RadixNode<V>::nextChild(node, position, byte)) {
+            RadixNode<V>::destroy(child);
+        }
+
+        delete node->_leaf;
+        RadixNode<V>::release(node);
+    }
+
+    template <typename V>
+    void RadixNode<V>::release(RadixNode<V>* node) {
+        switch (node->_kind) {
+            case RADIX_NODE_4:   delete static_cast<RadixNodeSorted<V, RADIX_NODE_4>*>(node); break;
+            case RADIX_NODE_16:  delete static_cast<RadixNodeSorted<V, RADIX_NODE_16>*>(node); break;
+            case RADIX_NODE_48:  delete static_cast<RadixNode48<V>*>(node); break;
+            default:             delete static_cast<RadixNode256<V>*>(node); break;
+        }
+    }
+
+    template <typename V>
+    RadixNode<V>** RadixNode<V>::findChild(RadixNode<V>* node, unsigned char byte) {
+        switch (node->_kind) {
+            case RADIX_NODE_4: {
+                RadixNodeSorted<V, RADIX_NODE_4>* sorted = static_cast<RadixNodeSorted<V, RADIX_NODE_4>*>(node);
+                for (size_t i = 0; i < sorted->_count; ++i) {
+                    if (sorted->_keys[i] == byte) return &sorted->_children[i];
+                }
+
+                return nullptr;
+            }
+            case RADIX_NODE_16: {
+                // All sixteen bytes are compared at once, and the unused ones masked off
+                RadixNodeSorted<V, RADIX_NODE_16>* sorted = static_cast<RadixNodeSorted<V, RADIX_NODE_16>*>(node);
+                uint32_t bits = HashGroup::match(reinterpret_cast<const int8_t*>(sorted->_keys), int8_t(byte));
+                bits &= (uint32_t(1) << sorted->_count) - 1;
+                return bits != 0 ? &sorted->_children[__builtin_ctz(bits)] : nullptr;
+            }
+            case RADIX_NODE_48: {
+                RadixNode48<V>* indexed = static_cast<RadixNode48<V>*>(node);
+                return indexed->_index[byte] != 0 ? &indexed->_children[indexed->_index[byte] - 1] : nullptr;
+            }
+            default: {
+                RadixNode256<V>* full = static_cast<RadixNode256<V>*>(node);
+                return full->_children[byte] != nullptr ? &full->_children[byte] : nullptr;
+            }
+        }
+    }
+
+    template <typename V>
+    RadixNode<V>* RadixNode<V>::nextChild(const RadixNode<V>* node, size_t& position, unsigned char& byte) {
+        // The position is an index into the sorted children, or a byte for the larger sizes
+        switch (node->_kind) {
+            case RADIX_NODE_4: {
+                const RadixNodeSorted<V, RADIX_NODE_4>* sorted = static_cast<const RadixNodeSorted<V, RADIX_NODE_4>*>(node);
+                if (position >= sorted->_count) return nullptr;
+                byte = sorted->_keys[position];
+                return sorted->_children[position++];
+            }
+            case RADIX_NODE_16: {
+                const RadixNodeSorted<V, RADIX_NODE_16>* sorted = static_cast<const RadixNodeSorted<V, RADIX_NODE_16>*>(node);
+                if (position >= sorted->_count) return nullptr;
+                byte = sorted->_keys[position];
+                return sorted->_children[position++];
+            }
+            case RADIX_NODE_48: {
+                const RadixNode48<V>* indexed = static_cast<const RadixNode48<V>*>(node);
+                for (; position < 256; ++position) {
+                    if (indexed->_index[position] != 0) {
+                        byte = (unsigned char)(position);
+                        return indexed->_children[indexed->_index[position++] - 1];
+                    }
+                }
+
+                return nullptr;
+            }
+            default: {
+                const RadixNode256<V>* full = static_cast<const RadixNode256<V>*>(node);
+                for (; position < 256; ++position) {
+                    if (full->_children[position] != nullptr) {
+                        byte = (unsigned char)(position);
+                        return full->_children[position++];
+                    }
+                }
+
+                return nullptr;
+            }
+        }
+    }
+
+    template <typename V>
+    void RadixNode<V>::addChild(RadixNode<V>*& node, unsigned char byte, RadixNode<V>* child) {
+        if (node->_kind != RADIX_NODE_256 && node->_count == node->_kind) {
+            node = RadixNode<V>::_resize(node, node->_kind == RADIX_NODE_4 ? RADIX_NODE_16 : node->_kind == RADIX_NODE_16 ? RADIX_NODE_48 : RADIX_NODE_256);
+        }
+
+        RadixNode<V>::_insertChild(node, byte, child);
+    }
+
+    template <typename V>
+    void RadixNode<V>::removeChild(RadixNode<V>*& node, unsigned char byte) {
+        switch (node->_kind) {
+            case RADIX_NODE_4:
+            case RADIX_NODE_16: {
+                // Both sorted sizes share a layout up to the capacity of their arrays
+                unsigned char* keys = node->_kind == RADIX_NODE_4 ? static_cast<RadixNodeSorted<V, RADIX_NODE_4>*>(node)->_keys : static_cast<RadixNodeSorted<V, RADIX_NODE_16>*>(node)->_keys;
+                RadixNode<V>** children = node->_kind == RADIX_NODE_4 ? static_cast<RadixNodeSorted<V, RADIX_NODE_4>*>(node)->_children : static_cast<RadixNodeSorted<V, RADIX_NODE_16>*>(node)->_children;
+
+                size_t i = 0;
+                while (keys[i] != byte) ++i;
+                std::memmove(keys + i, keys + i + 1, node->_count - i - 1);
+                std::memmove(children + i, children + i + 1, (node->_count - i - 1) * sizeof(RadixNode<V>*));
+                break;
+            }
+            case RADIX_NODE_48: {
+                RadixNode48<V>* indexed = static_cast<RadixNode48<V>*>(node);
+                indexed->_children[indexed->_index[byte] - 1] = nullptr;
+                indexed->_index[byte] = 0;
+                break;
+            }
+            default: {
+                static_cast<RadixNode256<V>*>(node)->_children[byte] = nullptr;
+                break;
+            }
+        }
+
+        // Shrink below the size that would grow again, so one key going back and forth does not resize every time
+        --node->_count;
+        if (node->_kind == RADIX_NODE_256 && node->_count <= 36) {
+            node = RadixNode<V>::_resize(node, RADIX_NODE_48);
+        }
+        else if (node->_kind == RADIX_NODE_48 && node->_count <= 12) {
+            node = RadixNode<V>::_resize(node, RADIX_NODE_16);
+        }
+        else if (node->_kind == RADIX_NODE_16 && node->_count <= 3) {
+            node = RadixNode<V>::_resize(node, RADIX_NODE_4);
+        }
+    }
+
+
+    // Internal Functions
+    template <typename V>
+    RadixNode<V>* RadixNode<V>::_resize(RadixNode<V>* node, uint16_t kind) {
+        RadixNode<V>* resized = RadixNode<V>::create(kind);
+        resized->_prefix.swap(node->_prefix);
+        resized->_leaf = node->_leaf;
+
+        size_t position = 0;
+        unsigned char byte = 0;
+        while (RadixNode<V>* child = RadixNode<V>::nextChild(node, position, byte)) {
+            RadixNode<V>::_insertChild(resized, byte, child);
+        }
+
+        RadixNode<V>::release(node);
+        return resized;
+    }
+
+    template <typename V>
+    void RadixNode<V>::_insertChild(RadixNode<V>* node, unsigned char byte, RadixNode<V>* child) {
+        switch (node->_kind) {
+            case RADIX_NODE_4:
+            case RADIX_NODE_16: {
+                unsigned char* keys = node->_kind == RADIX_NODE_4 ? static_cast<RadixNodeSorted<V, RADIX_NODE_4>*>(node)->_keys : static_cast<RadixNodeSorted<V, RADIX_NODE_16>*>(node)->_keys;
+                RadixNode<V>** children = node->_kind == RADIX_NODE_4 ? static_cast<RadixNodeSorted<V, RADIX_NODE_4>*>(node)->_children : static_cast<RadixNodeSorted<V, RADIX_NODE_16>*>(node)->_children;
+
+                size_t i = node->_count;
+                while (i > 0 && keys[i - 1] > byte) {
+                    keys[i] = keys[i - 1];
+                    children[i] = children[i - 1];
+                    --i;
+                }
+
+                keys[i] = byte;
+                children[i] = child;
+                break;
+            }
+            case RADIX_NODE_48: {
+                RadixNode48<V>* indexed = static_cast<RadixNode48<V>*>(node);
+                size_t slot = 0;
+                while (indexed->_children[slot] != nullptr) ++slot;
+                indexed->_children[slot] = child;
+                indexed->_index[byte] = (unsigned char)(slot + 1);
+                break;
+            }
+            default: {
+                static_cast<RadixNode256<V>*>(node)->_children[byte] = child;
+                break;
+            }
+        }
+
+        ++node->_count;
+    }
+
+
+    // Constructors
+    template <typename V, typename Value>
+    RadixIterator<V, Value>::RadixIterator() {
+        this->_current = nullptr;
+    }
+
+    template <typename V, typename Value>
+    RadixIterator<V, Value>::RadixIterator(const RadixNode<V>* node) {
+        this->_current = nullptr;
+        if (node != nullptr) {
+            this->_stack.push_back(std::make_pair(node, RADIX_NODE_UNVISITED));
+            this->_advance();
+        }
+    }
+
+
+    // Operator Overloading
+    template <typename V, typename Value>
+    Value& RadixIterator<V, Value>::operator*() const {
+        return *this->_current;
+    }
+
+    template <typename V, typename Value>
+    Value* RadixIterator<V, Value>::operator->() const {
+        return this->_current;
+    }
+
+    template <typename V, typename Value>
+    RadixIterator<V, Value>& RadixIterator<V, Value>::operator++() {
+        this->_advance();
+        return *this;
+    }
+
+    template <typename V, typename Value>
+    RadixIterator<V, Value> RadixIterator<V, Value>::operator++(int) {
+        RadixIterator<V, Value> iterator = *this;
+        this->_advance();
+        return iterator;
+    }
+
+    template <typename V, typename Value>
+    bool RadixIterator<V, Value>::operator==(const RadixIterator<V, Value>& iterator) const {
+        return this->_current == iterator._current;
+    }
+
+    template <typename V, typename Value>
+    bool RadixIterator<V, Value>::operator!=(const RadixIterator<V, Value>& iterator) const {
+        return this->_current != iterator._current;
+    }
+
+
+    // Internal Functions
+    template <typename V, typename Value>
+    void RadixIterator<V, Value>::_advance() {
+        // A node's own key comes before the keys of its children, which come in byte order
+        while (!this->_stack.empty()) {
+            std::pair<const RadixNode<V>*, size_t>& frame = this->_stack.back();
+            if (frame.second == RADIX_NODE_UNVISITED) {
+                frame.second = 0;
+                if (frame.first->_leaf != nullptr) {
+                    this->_current = frame.first->_leaf;
+                    return;
+                }
+            }
+
+            unsigned char byte = 0;
+            const RadixNode<V>* child = RadixNode<V>::nextChild(frame.first, frame.second, byte);
+            if (child != nullptr) {
+                this->_stack.push_back(std::make_pair(child, RADIX_NODE_UNVISITED));
+            }
+            else {
+                this->_stack.pop_back();
+            }
+        }
+
+        this->_current = nullptr;
+    }
+
+
+    // Constructors
+    template <typename Iterator>
+    RadixRange<Iterator>::RadixRange(Iterator begin, Iterator end) : _begin(begin), _end(end) {
+    }
+
+
+    // Iteration
+    template <typename Iterator>
+    Iterator RadixRange<Iterator>::begin() const {
+        return this->_begin;
+    }
+
+    template <typename Iterator>
+    Iterator RadixRange<Iterator>::end() const {
+        return this->_end;
+    }
+
+
+    // Querying Range
+    template <typename Iterator>
+    bool RadixRange<Iterator>::isEmpty() const {
+        return this->_begin == this->_end;
+    }
+
+
+    // Constructors
+    template <typename V>
+    RadixDictionary<V>::RadixDictionary() {
+        this->_root = nullptr;
+        this->_size = 0;
+    }
+
+    template <typename V>
+    RadixDictionary<V>::RadixDictionary(std::initializer_list<value_type> i_list) : RadixDictionary() {
+        // Like a std::map, the first of any duplicate keys is kept
+        for (const value_type& pair : i_list) {
+            this->_insert(pair.first, [&pair]() -> const V& { return pair.second; });
+        }
+    }
+
+    template <typename V>
+    template <typename Storage>
+    RadixDictionary<V>::RadixDictionary(const Dictionary<String, V, Storage>& dictionary) : RadixDictionary() {
+        for (const auto& pair : dictionary._data) {
+            this->_insert(pair.first, [&pair]() -> const V& { return pair.second; });
+        }
+    }
+
+    template <typename V>
+    RadixDictionary<V>::RadixDictionary(const RadixDictionary<V>& dictionary) {
+        this->_root = dictionary._root != nullptr ? Node::clone(dictionary._root) : nullptr;
+        this->_size = dictionary._size;
+    }
+
+    template <typename V>
+    RadixDictionary<V>::RadixDictionary(RadixDictionary<V>&& dictionary) {
+        this->_root = dictionary._root;
+        this->_size = dictionary._size;
+        dictionary._root = nullptr;
+        dictionary._size = 0;
+    }
+
+    template <typename V>
+    RadixDictionary<V>::~RadixDictionary() {
+        this->removeAll();
+    }
+
+
+    // Operator Overloading
+    template <typename V>
+    V& RadixDictionary<V>::operator[](const String& key) {
+        return this->_insert(key, []() { return V(); }).first->second;
+    }
+
+    template <typename V>
+    RadixDictionary<V>& RadixDictionary<V>::operator=(const RadixDictionary<V>& dictionary) {
+        // Check self assignment
+        if (this == &dictionary) return *this;
+
+        Node* root = dictionary._root != nullptr ? Node::clone(dictionary._root) : nullptr;
+        this->removeAll();
+        this->_root = root;
+        this->_size = dictionary._size;
+        return *this;
+    }
+
+    template <typename V>
+    RadixDictionary<V>& RadixDictionary<V>::operator=(RadixDictionary<V>&& dictionary) {
+        // Check self assignment
+        if (this == &dictionary) return *this;
+
+        this->removeAll();
+        this->_root = dictionary._root;
+        this->_size = dictionary._size;
+        dictionary._root = nullptr;
+        dictionary._size = 0;
+        return *this;
+    }
+
+    template <typename V>
+    bool RadixDictionary<V>::operator==(const RadixDictionary<V>& dictionary) const {
+        if (this->_size != dictionary._size) return false;
+
+        // Both iterate in key order, so equal dictionaries line up pair by pair
+        const_iterator other = dictionary.begin();
+        for (const value_type& pair : *this) {
+            if (!(pair.first == other->first) || !(pair.second == other->second)) return false;
+            ++other;
+        }
+
+        return true;
+    }
+
+    template <typename V>
+    bool RadixDictionary<V>::operator!=(const RadixDictionary<V>& dictionary) const {
+        return !(*this == dictionary);
+    }
+
+
+    // Iteration
+    template <typename V>
+    typename RadixDictionary<V>::iterator RadixDictionary<V>::begin() {
+        return iterator(this->_root);
+    }
+
+    template <typename V>
+    typename RadixDictionary<V>::const_iterator RadixDictionary<V>::begin() const {
+        return const_iterator(this->_root);
+    }
+
+    template <typename V>
+    typename RadixDictionary<V>::iterator RadixDictionary<V>::end() {
+        return iterator();
+    }
+
+    template <typename V>
+    typename RadixDictionary<V>::const_iterator RadixDictionary<V>::end() const {
+        return const_iterator();
+    }
+
+
+    // Querying Dictionary
+    template <typename V>
+    V RadixDictionary<V>::objectForKey(const String& key) const {
+        const V* value = this->tryGet(key);
+        if (value == nullptr) {
+            throw RADIX_DICTIONARY_MISSING_KEY;
+        }
+
+        return *value;
+    }
+
+    template <typename V>
+    V* RadixDictionary<V>::tryGet(const String& key) {
+        Node* node = this->_find(key._data);
+        return node != nullptr && node->_leaf != nullptr ? &node->_leaf->second : nullptr;
+    }
+
+    template <typename V>
+    const V* RadixDictionary<V>::tryGet(const String& key) const {
+        const Node* node = this->_find(key._data);
+        return node != nullptr && node->_leaf != nullptr ? &node->_leaf->second : nullptr;
+    }
+
+    template <typename V>
+    bool RadixDictionary<V>::containsKey(const String& key) const {
+        return this->tryGet(key) != nullptr;
+    }
+
+    template <typename V>
+    size_t RadixDictionary<V>::size() const {
+        return this->_size;
+    }
+
+    template <typename V>
+    bool RadixDictionary<V>::isEmpty() const {
+        return this->_size == 0;
+    }
+
+    template <typename V>
+    std::vector<String> RadixDictionary<V>::getKeys() const {
+        std::vector<String> keys = std::vector<String>();
+        keys.reserve(this->_size);
+        for (const value_type& pair : *this) {
+            keys.push_back(pair.first);
+        }
+
+        return keys;
+    }
+
+    template <typename V>
+    std::vector<V> RadixDictionary<V>::getValues() const {
+        std::vector<V> values = std::vector<V>();
+        values.reserve(this->_size);
+        for (const value_type& pair : *this) {
+            values.push_back(pair.second);
+        }
+
+        return values;
+    }
+
+
+    // Prefix Queries
+    template <typename V>
+    RadixRange<typename RadixDictionary<V>::iterator> RadixDictionary<V>::withPrefix(const String& prefix) {
+        return RadixRange<iterator>(iterator(this->_subtree(prefix._data)), iterator());
+    }
+
+    template <typename V>
+    RadixRange<typename RadixDictionary<V>::const_iterator> RadixDictionary<V>::withPrefix(const String& prefix) const {
+        return RadixRange<const_iterator>(const_iterator(this->_subtree(prefix._data)), const_iterator());
+    }
+
+    template <typename V>
+    std::vector<String> RadixDictionary<V>::getKeysWithPrefix(const String& prefix) const {
+        std::vector<String> keys = std::vector<String>();
+        for (const value_type& pair : this->withPrefix(prefix)) {
+            keys.push_back(pair.first);
+        }
+
+        return keys;
+    }
+
+    template <typename V>
+    typename RadixDictionary<V>::value_type* RadixDictionary<V>::longestPrefixOf(const String& key) {
+        return const_cast<value_type*>(static_cast<const RadixDictionary<V>*>(this)->longestPrefixOf(key));
+    }
+
+    template <typename V>
+    const typename RadixDictionary<V>::value_type* RadixDictionary<V>::longestPrefixOf(const String& key) const {
+        const std::string& bytes = key._data;
+        const value_type* longest = nullptr;
+
+        // Every key passed on the way down is a prefix of this one, and the last is the longest
+        Node* node = this->_root;
+        size_t depth = 0;
+        while (node != nullptr) {
+            const std::string& prefix = node->_prefix;
+            if (bytes.size() - depth < prefix.size() || bytes.compare(depth, prefix.size(), prefix) != 0) break;
+
+            depth += prefix.size();
+            if (node->_leaf != nullptr) longest = node->_leaf;
+            if (depth == bytes.size()) break;
+
+            Node** child = Node::findChild(node, (unsigned char)(bytes[depth]));
+            node = child != nullptr ? *child : nullptr;
+            ++depth;
+        }
+
+        return longest;
+    }
+
+
+    // Adding Objects
+    template <typename V>
+    RadixDictionary<V>& RadixDictionary<V>::addObject(const String& key, const V& value) {
+        if (!this->_insert(key, [&value]() -> const V& { return value; }).second) {
+            throw RADIX_DICTIONARY_DUPLICATE_KEY;
+        }
+
+        return *this;
+    }
+
+    template <typename V>
+    template <typename F>
+    V& RadixDictionary<V>::getOrInsert(const String& key, F factory) {
+        return this->_insert(key, factory).first->second;
+    }
+
+    template <typename V>
+    RadixDictionary<V>& RadixDictionary<V>::insertOrAssign(const String& key, const V& value) {
+        std::pair<value_type*, bool> result = this->_insert(key, [&value]() -> const V& { return value; });
+        if (!result.second) {
+            result.first->second = value;
+        }
+
+        return *this;
+    }
+
+    template <typename V>
+    template <typename F>
+    RadixDictionary<V>& RadixDictionary<V>::upsert(const String& key, F function) {
+        function(this->_insert(key, []() { return V(); }).first->second);
+        return *this;
+    }
+
+
+    // Removing Objects
+    template <typename V>
+    RadixDictionary<V>& RadixDictionary<V>::remove(const String& key) {
+        const std::string& bytes = key._data;
+        Node** parent = nullptr;
+        Node** slot = &this->_root;
+        unsigned char byte = 0;
+        size_t depth = 0;
+
+        while (true) {
+            Node* node = *slot;
+            if (node == nullptr) return *this;
+
+            const std::string& prefix = node->_prefix;
+            if (bytes.size() - depth < prefix.size() || bytes.compare(depth, prefix.size(), prefix) != 0) return *this;
+
+            depth += prefix.size();
+            if (depth == bytes.size()) break;
+
+            Node** child = Node::findChild(node, (unsigned char)(bytes[depth]));
+            if (child == nullptr) return *this;
+
+            parent = slot;
+            byte = (unsigned char)(bytes[depth]);
+            slot = child;
+            ++depth;
+        }
+
+        Node* node = *slot;
+        if (node->_leaf == nullptr) return *this;
+
+        delete node->_leaf;
+        node->_leaf = nullptr;
+        --this->_size;
+
+        // A node with no key and no children goes, which can leave its parent with a single child to merge
+        if (node->_count == 0) {
+            Node::release(node);
+            if (parent == nullptr) {
+                *slot = nullptr;
+                return *this;
+            }
+
+            Node::removeChild(*parent, byte);
+            slot = parent;
+        }
+
+        RadixDictionary<V>::_compress(*slot);
+        return *this;
+    }
+
+    template <typename V>
+    RadixDictionary<V>& RadixDictionary<V>::removeObjects(const std::vector<String>& keys) {
+        for (const String& key : keys) {
+            this->remove(key);
+        }
+
+        return *this;
+    }
+
+    template <typename V>
+    RadixDictionary<V>& RadixDictionary<V>::removeAll() {
+        if (this->_root != nullptr) {
+            Node::destroy(this->_root);
+        }
+
+        this->_root = nullptr;
+        this->_size = 0;
+        return *this;
+    }
+
+
+    // Replace Objects
+    template <typename V>
+    RadixDictionary<V>& RadixDictionary<V>::replace(const String& key, const V& new_value) {
+        V* value = this->tryGet(key);
+        if (value == nullptr) {
+            throw RADIX_DICTIONARY_REPLACE_MISSING;
+        }
+
+        *value = new_value;
+        return *this;
+    }
+
+
+    // Getting Standard Containers
+    template <typename V>
+    std::map<String, V> RadixDictionary<V>::std_map() const {
+        return std::map<String, V>(this->begin(), this->end());
+    }
+
+
+    // String Representation
+    template <typename V>
+    std::string RadixDictionary<V>::description() const {
+        DescriptionWriter writer;
+        this->describeTo(writer);
+        return writer.take();
+    }
+
+    template <typename V>
+    void RadixDictionary<V>::describeTo(DescriptionWriter& writer) const {
+        writer.mapping(this->begin(), this->_size);
+    }
+
+
+    // Dictionary Copy
+    template <typename V>
+    RadixDictionary<V> RadixDictionary<V>::copy() const {
+        return RadixDictionary<V>(*this);
+    }
+
+
+    // Internal Functions
+    template <typename V>
+    template <typename F>
+    std::pair<typename RadixDictionary<V>::value_type*, bool> RadixDictionary<V>::_insert(const String& key, F make) {
+        // The object is made once the key is known to be missing and before the tree changes,
+        // so a factory that throws or reads this dictionary sees it as it was
+        const std::string& bytes = key._data;
+        Node** slot = &this->_root;
+        value_type* leaf = nullptr;
+        size_t depth = 0;
+
+        while (true) {
+            Node* node = *slot;
+            if (node == nullptr) {
+                leaf = new value_type(key, make());
+                node = Node::create(RADIX_NODE_4);
+                node->_prefix.assign(bytes, depth, std::string::npos);
+                node->_leaf = leaf;
+                *slot = node;
+                ++this->_size;
+                return std::make_pair(node->_leaf, true);
+            }
+
+            // The key leaves this node's prefix part way, so the prefix is split at that byte
+            size_t matched = RadixDictionary<V>::_match(node->_prefix, bytes, depth);
+            if (matched < node->_prefix.size()) {
+                leaf = new value_type(key, make());
+                Node* split = Node::create(RADIX_NODE_4);
+                split->_prefix.assign(node->_prefix, 0, matched);
+                unsigned char byte = (unsigned char)(node->_prefix[matched]);
+                node->_prefix.erase(0, matched + 1);
+                Node::addChild(split, byte, node);
+                *slot = split;
+                node = split;
+            }
+
+            depth += matched;
+            if (depth == bytes.size()) {
+                if (node->_leaf != nullptr) {
+                    return std::make_pair(node->_leaf, false);
+                }
+
+                node->_leaf = leaf != nullptr ? leaf : new value_type(key, make());
+                ++this->_size;
+                return std::make_pair(node->_leaf, true);
+            }
+
+            unsigned char byte = (unsigned char)(bytes[depth]);
+            Node** child = Node::findChild(node, byte);
+            if (child == nullptr) {
+                if (leaf == nullptr) leaf = new value_type(key, make());
+                Node* added = Node::create(RADIX_NODE_4);
+                added->_prefix.assign(bytes, depth + 1, std::string::npos);
+                added->_leaf = leaf;
+                Node::addChild(*slot, byte, added);
+                ++this->_size;
+                return std::make_pair(leaf, true);
+            }
+
+            slot = child;
+            ++depth;
+        }
+    }
+
+    template <typename V>
+    typename RadixDictionary<V>::Node* RadixDictionary<V>::_find(const std::string& key) const {
+        Node* node = this->_root;
+        size_t depth = 0;
+        while (node != nullptr) {
+            const std::string& prefix = node->_prefix;
+            if (key.size() - depth < prefix.size() || key.compare(depth, prefix.size(), prefix) != 0) return nullptr;
+
+            depth += prefix.size();
+            if (depth == key.size()) return node;
+
+            Node** child = Node::findChild(node, (unsigned char)(key[depth]));
+            node = child != nullptr ? *child : nullptr;
+            ++depth;
+        }
+
+        return nullptr;
+    }
+
+    template <typename V>
+    typename RadixDictionary<V>::Node* RadixDictionary<V>::_subtree(const std::string& prefix) const {
+        // The node where the prefix runs out holds every key that starts with it
+        Node* node = this->_root;
+        size_t depth = 0;
+        while (node != nullptr) {
+            size_t remaining = prefix.size() - depth;
+            if (remaining <= node->_prefix.size()) {
+                return node->_prefix.compare(0, remaining, prefix, depth, remaining) == 0 ? node : nullptr;
+            }
+
+            if (prefix.compare(depth, node->_prefix.size(), node->_prefix) != 0) return nullptr;
+
+            depth += node->_prefix.size();
+            Node** child = Node::findChild(node, (unsigned char)(prefix[depth]));
+            node = child != nullptr ? *child : nullptr;
+            ++depth;
+        }
+
+        return nullptr;
+    }
+
+    template <typename V>
+    size_t RadixDictionary<V>::_match(const std::string& prefix, const std::string& key, size_t depth) {
+        size_t matched = 0;
+        while (matched < prefix.size() && depth + matched < key.size() && prefix[matched] == key[depth + matched]) {
+            ++matched;
+        }
+
+        return matched;
+    }
+
+    template <typename V>
+    void RadixDictionary<V>::_compress(Node*& node) {
+        // A node with no key and one child only adds a byte to the path, so it is merged into that child
+        if (node->_leaf != nullptr || node->_count != 1) return;
+
+        size_t position = 0;
+        unsigned char byte = 0;
+        Node* child = Node::nextChild(node, position, byte);
+        child->_prefix.insert(0, 1, char(byte));
+        child->_prefix.insert(0, node->_prefix);
+
+        Node::release(node);
+        node = child;
+    }
+}
+
+#endif // MRLIB_RADIX_DICTIONARY_HPP
@@ -0,0 +1,520 @@
+//
+// RingArray.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to make an Array usable as a queue or a
+ * rolling window. RingBuffer stores its elements in a circular buffer, so
+ * adding and removing at either end never shifts the other elements.
+ * RingArray is an Array that uses a RingBuffer for storage, so add / pop,
+ * addFirst / popFirst and removeIndex(0) are all constant time.
+ *
+ * The elements of a RingBuffer are not contiguous, so stream() and
+ * slice() are not available on a RingArray.
+ */
+
+
+#ifndef MRLIB_RING_ARRAY_HPP
+#define MRLIB_RING_ARRAY_HPP
+
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <initializer_list>
+#include <type_traits>
+#include <cstddef>
+
+#include "Array.hpp"
+
+
+namespace mrlib {
+
+    template <typename Buffer, typename Value>
+    class RingBufferIterator {
+    public:
+        typedef std::random_access_iterator_tag              iterator_category;
+        typedef typename std::remove_const<Value>::type      value_type;
+        typedef std::ptrdiff_t                               difference_type;
+        typedef Value*                                       pointer;
+        typedef Value&                                       reference;
+
+        // Internal Data
+        Buffer*  _buffer;
+        size_t   _index;
+
+        // Constructors
+        RingBufferIterator() : _buffer(nullptr), _index(0) {}
+        RingBufferIterator(Buffer* buffer, size_t index) : _buffer(buffer), _index(index) {}
+
+        // Conversion to const iterator
+        operator RingBufferIterator<const Buffer, const Value>() const {
+            return RingBufferIterator<const Buffer, const Value>(this->_buffer, this->_index);
+        }
+
+        // Access
+        reference  operator*() const { return (*this->_buffer)[this->_index]; }
+        pointer    operator->() const { return &(*this->_buffer)[this->_index]; }
+        reference  operator[](difference_type n) const { return (*this->_buffer)[this->_index + n]; }
+
+        // Movement
+        RingBufferIterator&  operator++() { ++this->_index; return *this; }
+        RingBufferIterator&  operator--() { --this->_index; return *this; }
+        RingBufferIterator   operator++(int) { RingBufferIterator it = *this; ++this->_index; return it; }
+        RingBufferIterator   operator--(int) { RingBufferIterator it = *this; --this->_index; return it; }
+        RingBufferIterator&  operator+=(difference_type n) { this->_index += n; return *this; }
+        RingBufferIterator&  operator-=(difference_type n) { this->_index -= n; return *this; }
+        RingBufferIterator   operator+(difference_type n) const { return RingBufferIterator(this->_buffer, this->_index + n); }
+        RingBufferIterator   operator-(difference_type n) const { return RingBufferIterator(this->_buffer, this->_index - n); }
+        difference_type      operator-(const RingBufferIterator& it) const { return difference_type(this->_index) - difference_type(it._index); }
+
+        // Comparison
+        bool  operator==(const RingBufferIterator& it) const { return this->_index == it._index; }
+        bool  operator!=(const RingBufferIterator& it) const { return this->_index != it._index; }
+        bool  operator<(const RingBufferIterator& it) const { return this->_index < it._index; }
+        bool  operator>(const RingBufferIterator& it) const { return this->_index > it._index; }
+        bool  operator<=(const RingBufferIterator& it) const { return this->_index <= it._index; }
+        bool  operator>=(const RingBufferIterator& it) const { return this->_index >= it._index; }
+    };
+
+    template <typename Buffer, typename Value>
+    RingBufferIterator<Buffer, Value> operator+(std::ptrdiff_t n, const RingBufferIterator<Buffer, Value>& it) {
+        return it + n;
+    }
+
+
+    template <typename T, typename Allocator = std::allocator<T>>
+    class RingBuffer {
+    public:
+        typedef T                                                     value_type;
+        typedef T&                                                    reference;
+        typedef const T&                                              const_reference;
+        typedef RingBufferIterator<RingBuffer, T>                     iterator;
+        typedef RingBufferIterator<const RingBuffer, const T>         const_iterator;
+        typedef size_t                                                size_type;
+
+        // Internal Data
+        T*         _buffer;
+        size_t     _capacity;   // Zero or a power of two
+        size_t     _head;
+        size_t     _size;
+        Allocator  _allocator;
+
+        // Constructors
+        RingBuffer();
+        RingBuffer(size_t size);
+        RingBuffer(std::initializer_list<T> i_list);
+        template <typename InputIt>
+        RingBuffer(InputIt first, InputIt last);
+        RingBuffer(const RingBuffer& buffer);
+        RingBuffer(RingBuffer&& buffer);
+        ~RingBuffer();
+
+        // Operator Overloading
+        T&           operator[](size_t index);
+        const T&     operator[](size_t index) const;
+        RingBuffer&  operator=(const RingBuffer& buffer);
+        RingBuffer&  operator=(RingBuffer&& buffer);
+        bool         operator==(const RingBuffer& buffer) const;
+        bool         operator!=(const RingBuffer& buffer) const;
+
+        // Iteration
+        iterator        begin();
+        const_iterator  begin() const;
+        iterator        end();
+        const_iterator  end() const;
+
+        // Querying Buffer
+        size_t    size() const;
+        bool      empty() const;
+        size_t    capacity() const;
+        T&        front();
+        const T&  front() const;
+        T&        back();
+        const T&  back() const;
+
+        // Capacity
+        void  reserve(size_t capacity);
+        void  resize(size_t size);
+        void  shrink_to_fit();
+
+        // Modifiers
+        void      push_back(const T& object);
+        void      push_front(const T& object);
+        void      pop_back();
+        void      pop_front();
+        iterator  insert(const_iterator position, const T& object);
+        template <typename InputIt>
+        iterator  insert(const_iterator position, InputIt first, InputIt last);
+        iterator  erase(const_iterator position);
+        iterator  erase(const_iterator first, const_iterator last);
+        template <typename InputIt>
+        void      assign(InputIt first, InputIt last);
+        void      clear();
+
+    private:
+        T*    _slot(size_t index) const;
+        void  _reallocate(size_t capacity);
+    };
+
+    // Array with constant time add and remove at both ends
+    template <typename T, typename Allocator = std::allocator<T>>
+    using RingArray = Array<T, RingBuffer<T, Allocator>>;
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename T, typename Allocator>
+    RingBuffer<T, Allocator>::RingBuffer() {
+        this->_buffer = nullptr;
+        this->_capacity = 0;
+        this->_head = 0;
+        this->_size = 0;
+    }
+
+    template <typename T, typename Allocator>
+    RingBuffer<T, Allocator>::RingBuffer(size_t size) : RingBuffer() {
+        this->resize(size);
+    }
+
+    template <typename T, typename Allocator>
+    RingBuffer<T, Allocator>::RingBuffer(std::initializer_list<T> i_list) : RingBuffer() {
+        this->assign(i_list.begin(), i_list.end());
+    }
+
+    template <typename T, typename Allocator>
+    template <typename InputIt>
+    RingBuffer<T, Allocator>::RingBuffer(InputIt first, InputIt last) : RingBuffer() {
+        this->assign(first, last);
+    }
+
+    template <typename T, typename Allocator>
+    RingBuffer<T, Allocator>::RingBuffer(const RingBuffer& buffer) : RingBuffer() {
+        this->_allocator = buffer._allocator;
+        this->assign(buffer.begin(), buffer.end());
+    }
+
+    template <typename T, typename Allocator>
+    RingBuffer<T, Allocator>::RingBuffer(RingBuffer&& buffer) : RingBuffer() {
+        *this = std::move(buffer);
+    }
+
+    template <typename T, typename Allocator>
+    RingBuffer<T, Allocator>::~RingBuffer() {
+        this->clear();
+
+        if (this->_buffer != nullptr) {
+            std::allocator_traits<Allocator>::deallocate(this->_allocator, this->_buffer, this->_capacity);
+        }
+    }
+
+
+    // Operator Overloading
+    template <typename T, typename Allocator>
+    T& RingBuffer<T, Allocator>::operator[](size_t index) {
+        return *this->_slot(index);
+    }
+
+    template <typename T, typename Allocator>
+    const T& RingBuffer<T, Allocator>::operator[](size_t index) const {
+        return *this->_slot(index);
+    }
+
+    template <typename T, typename Allocator>
+    RingBuffer<T, Allocator>& RingBuffer<T, Allocator>::operator=(const RingBuffer& buffer) {
+        // Check self assignment
+        if (this == &buffer) return *this;
+
+        this->assign(buffer.begin(), buffer.end());
+        return *this;
+    }
+
+    template <typename T, typename Allocator>
+    RingBuffer<T, Allocator>& RingBuffer<T, Allocator>::operator=(RingBuffer&& buffer) {
+        // Check self assignment
+        if (this == &buffer) return *this;
+
+        this->clear();
+        if (this->_buffer != nullptr) {
+            std::allocator_traits<Allocator>::deallocate(this->_allocator, this->_buffer, this->_capacity);
+        }
+
+        this->_buffer = buffer._buffer;
+        this->_capacity = buffer._capacity;
+        this->_head = buffer._head;
+        this->_size = buffer._size;
+        this->_allocator = buffer._allocator;
+
+        buffer._buffer = nullptr;
+        buffer._capacity = 0;
+        buffer._head = 0;
+        buffer._size = 0;
+        return *this;
+    }
+
+    template <typename T, typename Allocator>
+    bool RingBuffer<T, Allocator>::operator==(const RingBuffer& buffer) const {
+        return this->_size == buffer._size && std::equal(this->begin(), this->end(), buffer.begin());
+    }
+
+    template <typename T, typename Allocator>
+    bool RingBuffer<T, Allocator>::operator!=(const RingBuffer& buffer) const {
+        return !(*this == buffer);
+    }
+
+
+    // Iteration
+    template <typename T, typename Allocator>
+    typename RingBuffer<T, Allocator>::iterator RingBuffer<T, Allocator>::begin() {
+        return iterator(this, 0);
+    }
+
+    template <typename T, typename Allocator>
+    typename RingBuffer<T, Allocator>::const_iterator RingBuffer<T, Allocator>::begin() const {
+        return const_iterator(this, 0);
+    }
+
+    template <typename T, typename Allocator>
+    typename RingBuffer<T, Allocator>::iterator RingBuffer<T, Allocator>::end() {
+        return iterator(this, this->_size);
+    }
+
+    template <typename T, typename Allocator>
+    typename RingBuffer<T, Allocator>::const_iterator RingBuffer<T, Allocator>::end() const {
+        return const_iterator(this, this->_size);
+    }
+
+
+    // Querying Buffer
+    template <typename T, typename Allocator>
+    size_t RingBuffer<T, Allocator>::size() const {
+        return this->_size;
+    }
+
+    template <typename T, typename Allocator>
+    bool RingBuffer<T, Allocator>::empty() const {
+        return this->_size == 0;
+    }
+
+    template <typename T, typename Allocator>
+    size_t RingBuffer<T, Allocator>::capacity() const {
+        return this->_capacity;
+    }
+
+    template <typename T, typename Allocator>
+    T& RingBuffer<T, Allocator>::front() {
+        return *this->_slot(0);
+    }
+
+    template <typename T, typename Allocator>
+    const T& RingBuffer<T, Allocator>::front() const {
+        return *this->_slot(0);
+    }
+
+    template <typename T, typename Allocator>
+    T& RingBuffer<T, Allocator>::back() {
+        return *this->_slot(this->_size - 1);
+    }
+
+    template <typename T, typename Allocator>
+    const T& RingBuffer<T, Allocator>::back() const {
+        return *this->_slot(this->_size - 1);
+    }
+
+
+    // Capacity
+    template <typename T, typename Allocator>
+    void RingBuffer<T, Allocator>::reserve(size_t capacity) {
+        if (capacity <= this->_capacity) return;
+
+        size_t rounded = 8;
+        while (rounded < capacity) {
+            rounded *= 2;
+        }
+
+        this->_reallocate(rounded);
+    }
+
+    template <typename T, typename Allocator>
+    void RingBuffer<T, Allocator>::resize(size_t size) {
+        while (this->_size > size) {
+            this->pop_back();
+        }
+
+        this->reserve(size);
+        while (this->_size < size) {
+            ::new (static_cast<void*>(this->_slot(this->_size))) T();
+            ++this->_size;
+        }
+    }
+
+    template <typename T, typename Allocator>
+    void RingBuffer<T, Allocator>::shrink_to_fit() {
+        size_t rounded = this->_size == 0 ? 0 : 8;
+        while (rounded < this->_size) {
+            rounded *= 2;
+        }
+
+        if (rounded < this->_capacity) {
+            this->_reallocate(rounded);
+        }
+    }
+
+
+    // Modifiers
+    template <typename T, typename Allocator>
+    void RingBuffer<T, Allocator>::push_back(const T& object) {
+        if (this->_size == this->_capacity) {
+            // Copy first since object may live in the buffer being reallocated
+            T copy(object);
+            this->reserve(this->_capacity + 1);
+            ::new (static_cast<void*>(this->_slot(this->_size))) T(std::move(copy));
+        }
+        else {
+            ::new (static_cast<void*>(this->_slot(this->_size))) T(object);
+        }
+
+        ++this->_size;
+    }
+
+    template <typename T, typename Allocator>
+    void RingBuffer<T, Allocator>::push_front(const T& object) {
+        if (this->_size == this->_capacity) {
+            T copy(object);
+            this->reserve(this->_capacity + 1);
+            this->_head = (this->_head - 1) & (this->_capacity - 1);
+            ::new (static_cast<void*>(this->_buffer + this->_head)) T(std::move(copy));
+        }
+        else {
+            size_t head = (this->_head - 1) & (this->_capacity - 1);
+            ::new (static_cast<void*>(this->_buffer + head)) T(object);
+            this->_head = head;
+        }
+
+        ++this->_size;
+    }
+
+    template <typename T, typename Allocator>
+    void RingBuffer<T, Allocator>::pop_back() {
+        this->_slot(this->_size - 1)->~T();
+        --this->_size;
+    }
+
+    template <typename T, typename Allocator>
+    void RingBuffer<T, Allocator>::pop_front() {
+        this->_buffer[this->_head].~T();
+        this->_head = (this->_head + 1) & (this->_capacity - 1);
+        --this->_size;
+    }
+
+    template <typename T, typename Allocator>
+    typename RingBuffer<T, Allocator>::iterator RingBuffer<T, Allocator>::insert(const_iterator position, const T& object) {
+        size_t index = position._index;
+
+        // Only shift the elements on the shorter side of the insert
+        if (index < this->_size / 2) {
+            this->push_front(object);
+            std::rotate(this->begin(), this->begin() + 1, this->begin() + index + 1);
+        }
+        else {
+            this->push_back(object);
+            std::rotate(this->begin() + index, this->end() - 1, this->end());
+        }
+
+        return this->begin() + index;
+    }
+
+    template <typename T, typename Allocator>
+    template <typename InputIt>
+    typename RingBuffer<T, Allocator>::iterator RingBuffer<T, Allocator>::insert(const_iterator position, InputIt first, InputIt last) {
+        size_t index = position._index;
+        size_t old_size = this->_size;
+
+        for (; first != last; ++first) {
+            this->push_back(*first);
+        }
+
+        std::rotate(this->begin() + index, this->begin() + old_size, this->end());
+        return this->begin() + index;
+    }
+
+    template <typename T, typename Allocator>
+    typename RingBuffer<T, Allocator>::iterator RingBuffer<T, Allocator>::erase(const_iterator position) {
+        return this->erase(position, position + 1);
+    }
+
+    template <typename T, typename Allocator>
+    typename RingBuffer<T, Allocator>::iterator RingBuffer<T, Allocator>::erase(const_iterator first, const_iterator last) {
+        size_t from = first._index;
+        size_t to = last._index;
+        size_t count = to - from;
+
+        // Close the gap from whichever side has fewer elements
+        if (from < this->_size - to) {
+            std::move_backward(this->begin(), this->begin() + from, this->begin() + to);
+            for (size_t i = 0; i < count; ++i) {
+                this->pop_front();
+            }
+        }
+        else {
+            std::move(this->begin() + to, this->end(), this->begin() + from);
+            for (size_t i = 0; i < count; ++i) {
+                this->pop_back();
+            }
+        }
+
+        return this->begin() + from;
+    }
+
+    template <typename T, typename Allocator>
+    template <typename InputIt>
+    void RingBuffer<T, Allocator>::assign(InputIt first, InputIt last) {
+        this->clear();
+        for (; first != last; ++first) {
+            this->push_back(*first);
+        }
+    }
+
+    template <typename T, typename Allocator>
+    void RingBuffer<T, Allocator>::clear() {
+        while (this->_size > 0) {
+            this->pop_back();
+        }
+
+        this->_head = 0;
+    }
+
+
+    // Internal Functions
+    template <typename T, typename Allocator>
+    T* RingBuffer<T, Allocator>::_slot(size_t index) const {
+        return this->_buffer + ((this->_head + index) & (this->_capacity - 1));
+    }
+
+    template <typename T, typename Allocator>
+    void RingBuffer<T, Allocator>::_reallocate(size_t capacity) {
+        T* buffer = capacity > 0 ? std::allocator_traits<Allocator>::allocate(this->_allocator, capacity) : nullptr;
+
+        // Unwrap the elements to the start of the new buffer
+        for (size_t i = 0; i < this->_size; ++i) {
+            T* slot = this->_slot(i);
+            ::new (static_cast<void*>(buffer + i)) T(std::move(*slot));
+            slot->~T();
+        }
+
+        if (this->_buffer != nullptr) {
+            std::allocator_traits<Allocator>::deallocate(this->_allocator, this->_buffer, this->_capacity);
+        }
+
+        this->_buffer = buffer;
+        this->_capacity = capacity;
+        this->_head = 0;
+    }
+}
+
+#endif // MRLIB_RING_ARRAY_HPP
@@ -0,0 +1,493 @@
+//
+// SmallArray.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to avoid heap allocations for arrays that
+ * usually hold only a few elements. SmallBuffer keeps up to N elements
+ * inline and only moves them to the heap once that is exceeded. SmallArray
+ * is an Array that uses a SmallBuffer for storage, so it has exactly the
+ * same interface as Array.
+ */
+
+
+#ifndef MRLIB_SMALL_ARRAY_HPP
+#define MRLIB_SMALL_ARRAY_HPP
+
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <initializer_list>
+#include <stdexcept>
+
+#include "Array.hpp"
+
+
+namespace mrlib {
+
+    template <typename T, size_t N, typename Allocator = std::allocator<T>>
+    class SmallBuffer {
+        static_assert(N > 0, "SmallBuffer: inline capacity must be greater than zero");
+
+    public:
+        typedef T          value_type;
+        typedef T&         reference;
+        typedef const T&   const_reference;
+        typedef T*         iterator;
+        typedef const T*   const_iterator;
+        typedef size_t     size_type;
+
+        // Internal Data
+        T*         _begin;
+        size_t     _size;
+        size_t     _capacity;
+        Allocator  _allocator;
+        typename std::aligned_storage<sizeof(T) * N, std::alignment_of<T>::value>::type _inline;
+
+        // Constructors
+        SmallBuffer();
+        SmallBuffer(size_t size);
+        SmallBuffer(std::initializer_list<T> i_list);
+        template <typename InputIt>
+        SmallBuffer(InputIt first, InputIt last);
+        SmallBuffer(const SmallBuffer& buffer);
+        SmallBuffer(SmallBuffer&& buffer);
+        ~SmallBuffer();
+
+        // Operator Overloading
+        T&            operator[](size_t index);
+        const T&      operator[](size_t index) const;
+        SmallBuffer&  operator=(const SmallBuffer& buffer);
+        SmallBuffer&  operator=(SmallBuffer&& buffer);
+        bool          operator==(const SmallBuffer& buffer) const;
+        bool          operator!=(const SmallBuffer& buffer) const;
+
+        // Iteration
+        T*        begin();
+        const T*  begin() const;
+        T*        end();
+        const T*  end() const;
+        T*        data();
+        const T*  data() const;
+
+        // Querying Buffer
+        size_t    size() const;
+        bool      empty() const;
+        size_t    capacity() const;
+        bool      isInline() const;
+        T&        front();
+        const T&  front() const;
+        T&        back();
+        const T&  back() const;
+
+        // Capacity
+        void  reserve(size_t capacity);
+        void  resize(size_t size);
+        void  shrink_to_fit();
+
+        // Modifiers
+        void  push_back(const T& object);
+        void  push_back(T&& object);
+        void  pop_back();
+        T*    insert(const T* position, const T& object);
+        template <typename InputIt>
+        T*    insert(const T* position, InputIt first, InputIt last);
+        T*    erase(const T* position);
+        T*    erase(const T* first, const T* last);
+        template <typename InputIt>
+        void  assign(InputIt first, InputIt last);
+        void  clear();
+
+    private:
+        T*    _inlineData();
+        bool  _isInline() const;
+        void  _reallocate(size_t capacity);
+        void  _release();
+        void  _moveFrom(SmallBuffer& buffer);
+    };
+
+    // Array that keeps up to N elements without allocating
+    template <typename T, size_t N = 8, typename Allocator = std::allocator<T>>
+    using SmallArray = Array<T, SmallBuffer<T, N, Allocator>>;
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename T, size_t N, typename Allocator>
+    SmallBuffer<T, N, Allocator>::SmallBuffer() {
+        this->_begin = this->_inlineData();
+        this->_size = 0;
+        this->_capacity = N;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    SmallBuffer<T, N, Allocator>::SmallBuffer(size_t size) : SmallBuffer() {
+        this->resize(size);
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    SmallBuffer<T, N, Allocator>::SmallBuffer(std::initializer_list<T> i_list) : SmallBuffer() {
+        this->assign(i_list.begin(), i_list.end());
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    template <typename InputIt>
+    SmallBuffer<T, N, Allocator>::SmallBuffer(InputIt first, InputIt last) : SmallBuffer() {
+        this->assign(first, last);
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    SmallBuffer<T, N, Allocator>::SmallBuffer(const SmallBuffer& buffer) : SmallBuffer() {
+        this->_allocator = buffer._allocator;
+        this->assign(buffer.begin(), buffer.end());
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    SmallBuffer<T, N, Allocator>::SmallBuffer(SmallBuffer&& buffer) : SmallBuffer() {
+        this->_moveFrom(buffer);
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    SmallBuffer<T, N, Allocator>::~SmallBuffer() {
+        this->_release();
+    }
+
+
+    // Operator Overloading
+    template <typename T, size_t N, typename Allocator>
+    T& SmallBuffer<T, N, Allocator>::operator[](size_t index) {
+        return this->_begin[index];
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    const T& SmallBuffer<T, N, Allocator>::operator[](size_t index) const {
+        return this->_begin[index];
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    SmallBuffer<T, N, Allocator>& SmallBuffer<T, N, Allocator>::operator=(const SmallBuffer& buffer) {
+        // Check self assignment
+        if (this == &buffer) return *this;
+
+        this->assign(buffer.begin(), buffer.end());
+        return *this;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    SmallBuffer<T, N, Allocator>& SmallBuffer<T, N, Allocator>::operator=(SmallBuffer&& buffer) {
+        // Check self assignment
+        if (this == &buffer) return *this;
+
+        this->_release();
+        this->_begin = this->_inlineData();
+        this->_size = 0;
+        this->_capacity = N;
+        this->_moveFrom(buffer);
+        return *this;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    bool SmallBuffer<T, N, Allocator>::operator==(const SmallBuffer& buffer) const {
+        return this->_size == buffer._size && std::equal(this->begin(), this->end(), buffer.begin());
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    bool SmallBuffer<T, N, Allocator>::operator!=(const SmallBuffer& buffer) const {
+        return !(*this == buffer);
+    }
+
+
+    // Iteration
+    template <typename T, size_t N, typename Allocator>
+    T* SmallBuffer<T, N, Allocator>::begin() {
+        return this->_begin;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    const T* SmallBuffer<T, N, Allocator>::begin() const {
+        return this->_begin;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    T* SmallBuffer<T, N, Allocator>::end() {
+        return this->_begin + this->_size;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    const T* SmallBuffer<T, N, Allocator>::end() const {
+        return this->_begin + this->_size;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    T* SmallBuffer<T, N, Allocator>::data() {
+        return this->_begin;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    const T* SmallBuffer<T, N, Allocator>::data() const {
+        return this->_begin;
+    }
+
+
+    // Querying Buffer
+    template <typename T, size_t N, typename Allocator>
+    size_t SmallBuffer<T, N, Allocator>::size() const {
+        return this->_size;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    bool SmallBuffer<T, N, Allocator>::empty() const {
+        return this->_size == 0;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    size_t SmallBuffer<T, N, Allocator>::capacity() const {
+        return this->_capacity;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    bool SmallBuffer<T, N, Allocator>::isInline() const {
+        return this->_isInline();
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    T& SmallBuffer<T, N, Allocator>::front() {
+        return this->_begin[0];
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    const T& SmallBuffer<T, N, Allocator>::front() const {
+        return this->_begin[0];
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    T& SmallBuffer<T, N, Allocator>::back() {
+        return this->_begin[this->_size - 1];
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    const T& SmallBuffer<T, N, Allocator>::back() const {
+        return this->_begin[this->_size - 1];
+    }
+
+
+    // Capacity
+    template <typename T, size_t N, typename Allocator>
+    void SmallBuffer<T, N, Allocator>::reserve(size_t capacity) {
+        if (capacity > this->_capacity) {
+            this->_reallocate(capacity);
+        }
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    void SmallBuffer<T, N, Allocator>::resize(size_t size) {
+        if (size < this->_size) {
+            this->erase(this->_begin + size, this->end());
+            return;
+        }
+
+        this->reserve(size);
+        for (size_t i = this->_size; i < size; ++i) {
+            ::new (static_cast<void*>(this->_begin + i)) T();
+            ++this->_size;
+        }
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    void SmallBuffer<T, N, Allocator>::shrink_to_fit() {
+        if (this->_isInline() || this->_size == this->_capacity) return;
+
+        // Elements that fit go back inline
+        this->_reallocate(this->_size);
+    }
+
+
+    // Modifiers
+    template <typename T, size_t N, typename Allocator>
+    void SmallBuffer<T, N, Allocator>::push_back(const T& object) {
+        if (this->_size == this->_capacity) {
+            // Copy first since object may live in the buffer being reallocated
+            T copy(object);
+            this->_reallocate(this->_capacity * 2);
+            ::new (static_cast<void*>(this->_begin + this->_size)) T(std::move(copy));
+        }
+        else {
+            ::new (static_cast<void*>(this->_begin + this->_size)) T(object);
+        }
+
+        ++this->_size;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    void SmallBuffer<T, N, Allocator>::push_back(T&& object) {
+        if (this->_size == this->_capacity) {
+            T moved(std::move(object));
+            this->_reallocate(this->_capacity * 2);
+            ::new (static_cast<void*>(this->_begin + this->_size)) T(std::move(moved));
+        }
+        else {
+            ::new (static_cast<void*>(this->_begin + this->_size)) T(std::move(object));
+        }
+
+        ++this->_size;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    void SmallBuffer<T, N, Allocator>::pop_back() {
+        --this->_size;
+        this->_begin[this->_size].~T();
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    T* SmallBuffer<T, N, Allocator>::insert(const T* position, const T& object) {
+        size_t index = position - this->_begin;
+        T copy(object);
+
+        this->push_back(std::move(copy));
+        std::rotate(this->_begin + index, this->end() - 1, this->end());
+        return this->_begin + index;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    template <typename InputIt>
+    T* SmallBuffer<T, N, Allocator>::insert(const T* position, InputIt first, InputIt last) {
+        size_t index = position - this->_begin;
+        size_t old_size = this->_size;
+
+        // Append then rotate into place, which also handles single pass iterators. If an
+        // element or the allocator throws, the appended elements are removed again
+        try {
+            for (; first != last; ++first) {
+                this->push_back(*first);
+            }
+        }
+        catch (...) {
+            while (this->_size > old_size) {
+                this->pop_back();
+            }
+            throw;
+        }
+
+        std::rotate(this->_begin + index, this->_begin + old_size, this->end());
+        return this->_begin + index;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    T* SmallBuffer<T, N, Allocator>::erase(const T* position) {
+        return this->erase(position, position + 1);
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    T* SmallBuffer<T, N, Allocator>::erase(const T* first, const T* last) {
+        T* from = this->_begin + (first - this->_begin);
+        T* to = this->_begin + (last - this->_begin);
+        if (from == to) return from;
+
+        T* new_end = std::move(to, this->end(), from);
+        for (T* it = new_end; it != this->end(); ++it) {
+            it->~T();
+        }
+
+        this->_size = new_end - this->_begin;
+        return from;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    template <typename InputIt>
+    void SmallBuffer<T, N, Allocator>::assign(InputIt first, InputIt last) {
+        this->clear();
+        for (; first != last; ++first) {
+            this->push_back(*first);
+        }
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    void SmallBuffer<T, N, Allocator>::clear() {
+        for (size_t i = 0; i < this->_size; ++i) {
+            this->_begin[i].~T();
+        }
+
+        this->_size = 0;
+    }
+
+
+    // Internal Functions
+    template <typename T, size_t N, typename Allocator>
+    T* SmallBuffer<T, N, Allocator>::_inlineData() {
+        return reinterpret_cast<T*>(&this->_inline);
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    bool SmallBuffer<T, N, Allocator>::_isInline() const {
+        return this->_begin == reinterpret_cast<const T*>(&this->_inline);
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    void SmallBuffer<T, N, Allocator>::_reallocate(size_t capacity) {
+        T* storage;
+        if (capacity <= N) {
+            capacity = N;
+            storage = this->_inlineData();
+        }
+        else {
+            storage = std::allocator_traits<Allocator>::allocate(this->_allocator, capacity);
+        }
+
+        if (storage == this->_begin) return;
+
+        for (size_t i = 0; i < this->_size; ++i) {
+            ::new (static_cast<void*>(storage + i)) T(std::move(this->_begin[i]));
+            this->_begin[i].~T();
+        }
+
+        if (!this->_isInline()) {
+            std::allocator_traits<Allocator>::deallocate(this->_allocator, this->_begin, this->_capacity);
+        }
+
+        this->_begin = storage;
+        this->_capacity = capacity;
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    void SmallBuffer<T, N, Allocator>::_release() {
+        this->clear();
+
+        if (!this->_isInline()) {
+            std::allocator_traits<Allocator>::deallocate(this->_allocator, this->_begin, this->_capacity);
+        }
+    }
+
+    template <typename T, size_t N, typename Allocator>
+    void SmallBuffer<T, N, Allocator>::_moveFrom(SmallBuffer& buffer) {
+        // Expects this buffer to be empty and inline
+        this->_allocator = buffer._allocator;
+
+        if (buffer._isInline()) {
+            for (size_t i = 0; i < buffer._size; ++i) {
+                ::new (static_cast<void*>(this->_begin + i)) T(std::move(buffer._begin[i]));
+            }
+
+            this->_size = buffer._size;
+            buffer.clear();
+        }
+        else {
+            // Heap storage changes owner without touching the elements
+            this->_begin = buffer._begin;
+            this->_size = buffer._size;
+            this->_capacity = buffer._capacity;
+
+            buffer._begin = buffer._inlineData();
+            buffer._size = 0;
+            buffer._capacity = N;
+        }
+    }
+}
+
+#endif // MRLIB_SMALL_ARRAY_HPP
@@ -0,0 +1,426 @@
+//
+// SoAArray.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to store records as a structure of arrays.
+ * Each field is kept in its own contiguous Array column, so scanning a
+ * single field only touches that field's memory and the scan loops can be
+ * vectorized by the compiler. Records can be added as tuples or as
+ * separate field values, and converted to and from an Array of structs
+ * given the member pointers for each field.
+ *
+ * Every column always has the same length. The columns can be read as
+ * Arrays, but are only written through pointers to their elements, so
+ * records are only added and removed through the SoAArray.
+ */
+
+
+#ifndef MRLIB_SOA_ARRAY_HPP
+#define MRLIB_SOA_ARRAY_HPP
+
+#include <tuple>
+#include <string>
+#include <stdexcept>
+
+#include "Array.hpp"
+#include "DescriptionWriter.hpp"
+
+// Index out of bounds exception
+#define SOA_ARRAY_OUT_BOUNDS std::invalid_argument("SoAArray: Out of bounds exception")
+
+
+namespace mrlib {
+
+    // Compile time index list used to expand over the columns
+    template <size_t... Is>
+    struct SoAIndices {};
+
+    template <size_t N, size_t... Is>
+    struct SoAMakeIndices : SoAMakeIndices<N - 1, N - 1, Is...> {};
+
+    template <size_t... Is>
+    struct SoAMakeIndices<0, Is...> {
+        typedef SoAIndices<Is...> type;
+    };
+
+
+    template <typename... Fields>
+    class SoAArray {
+    public:
+        typedef std::tuple<Fields...> Record;
+
+        template <size_t I>
+        struct Column {
+            typedef typename std::tuple_element<I, Record>::type type;
+        };
+
+        // Internal Data
+        std::tuple<Array<Fields>...> _columns;
+
+        // Constructors
+        SoAArray();
+
+        // Conversion From Array
+        template <typename R>
+        static SoAArray<Fields...>  fromArray(const Array<R>& records, Fields R::*... members);
+
+        // Operator Overloading
+        Record  operator[](size_t index) const;
+        bool    operator==(const SoAArray<Fields...>& array) const;
+        bool    operator!=(const SoAArray<Fields...>& array) const;
+
+        // Querying Array
+        Record  objectAtIndex(size_t index) const;
+        size_t  size() const;
+        bool    isEmpty() const;
+
+        // Adding Objects
+        SoAArray<Fields...>&  add(const Record& record);
+        SoAArray<Fields...>&  add(const Fields&... fields);
+        SoAArray<Fields...>&  reserve(size_t capacity);
+
+        // Removing Objects
+        SoAArray<Fields...>&  removeIndex(size_t index);
+        SoAArray<Fields...>&  removeAll();
+
+        // Column Access
+        template <size_t I>
+        const Array<typename Column<I>::type>&        column() const;
+        template <size_t I>
+        typename Column<I>::type*                     columnData();
+        template <size_t I>
+        const typename Column<I>::type*               columnData() const;
+        template <size_t I>
+        ArraySlice<typename Column<I>::type>          columnSlice() const;
+
+        // Column Scans
+        template <size_t I>
+        typename Column<I>::type  sum() const;
+        template <size_t I, typename F>
+        size_t                    count(F predicate) const;
+        template <size_t I, typename F>
+        Array<size_t>             indicesWhere(F predicate) const;
+
+        // Conversion To Array
+        template <typename R>
+        Array<R>  toArray(Fields R::*... members) const;
+
+        // String Representation
+        std::string  description() const;
+        void         describeTo(DescriptionWriter& writer) const;
+
+    private:
+        template <size_t... Is>
+        void    _add(const Record& record, SoAIndices<Is...>);
+        template <size_t... Is>
+        Record  _record(size_t index, SoAIndices<Is...>) const;
+        template <size_t... Is>
+        void    _removeIndex(size_t index, SoAIndices<Is...>);
+        template <size_t... Is>
+        void    _reserve(size_t capacity, SoAIndices<Is...>);
+        template <typename R, size_t... Is>
+        void    _assign(R& record, size_t index, const std::tuple<Fields R::*...>& members, SoAIndices<Is...>) const;
+        template <size_t... Is>
+        void    _describe(DescriptionWriter& writer, size_t index, SoAIndices<Is...>) const;
+        template <typename C>
+        static void  _truncate(C& column, size_t size);
+    };
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename... Fields>
+    SoAArray<Fields...>::SoAArray() {
+        this->_columns = std::tuple<Array<Fields>...>();
+    }
+
+
+    // Conversion From Array
+    template <typename... Fields>
+    template <typename R>
+    SoAArray<Fields...> SoAArray<Fields...>::fromArray(const Array<R>& records, Fields R::*... members) {
+        SoAArray<Fields...> array = SoAArray<Fields...>();
+        array.reserve(records.size());
+
+        for (const R& record : records._data) {
+            array.add(record.*members...);
+        }
+
+        return array;
+    }
+
+
+    // Operator Overloading
+    template <typename... Fields>
+    typename SoAArray<Fields...>::Record SoAArray<Fields...>::operator[](size_t index) const {
+        return this->objectAtIndex(index);
+    }
+
+    template <typename... Fields>
+    bool SoAArray<Fields...>::operator==(const SoAArray<Fields...>& array) const {
+        return this->_columns == array._columns;
+    }
+
+    template <typename... Fields>
+    bool SoAArray<Fields...>::operator!=(const SoAArray<Fields...>& array) const {
+        return this->_columns != array._columns;
+    }
+
+
+    // Querying Array
+    template <typename... Fields>
+    typename SoAArray<Fields...>::Record SoAArray<Fields...>::objectAtIndex(size_t index) const {
+        if (index < this->size()) {
+            return this->_record(index, typename SoAMakeIndices<sizeof...(Fields)>::type());
+        }
+        else {
+            throw SOA_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    template <typename... Fields>
+    size_t SoAArray<Fields...>::size() const {
+        return std::get<0>(this->_columns).size();
+    }
+
+    template <typename... Fields>
+    bool SoAArray<Fields...>::isEmpty() const {
+        return std::get<0>(this->_columns).isEmpty();
+    }
+
+
+    // Adding Objects
+    template <typename... Fields>
+    SoAArray<Fields...>& SoAArray<Fields...>::add(const Record& record) {
+        this->_add(record, typename SoAMakeIndices<sizeof...(Fields)>::type());
+        return *this;
+    }
+
+    template <typename... Fields>
+    SoAArray<Fields...>& SoAArray<Fields...>::add(const Fields&... fields) {
+        this->_add(Record(fields...), typename SoAMakeIndices<sizeof...(Fields)>::type());
+        return *this;
+    }
+
+    template <typename... Fields>
+    SoAArray<Fields...>& SoAArray<Fields...>::reserve(size_t capacity) {
+        this->_reserve(capacity, typename SoAMakeIndices<sizeof...(Fields)>::type());
+        return *this;
+    }
+
+
+    // Removing Objects
+    template <typename... Fields>
+    SoAArray<Fields...>& SoAArray<Fields...>::removeIndex(size_t index) {
+        if (index < this->size()) {
+            this->_removeIndex(index, typename SoAMakeIndices<sizeof...(Fields)>::type());
+            return *this;
+        }
+        else {
+            throw SOA_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    template <typename... Fields>
+    SoAArray<Fields...>& SoAArray<Fields...>::removeAll() {
+        this->_columns = std::tuple<Array<Fields>...>();
+        return *this;
+    }
+
+
+    // Column Access
+    template <typename... Fields>
+    template <size_t I>
+    const Array<typename SoAArray<Fields...>::template Column<I>::type>& SoAArray<Fields...>::column() const {
+        return std::get<I>(this->_columns);
+    }
+
+    template <typename... Fields>
+    template <size_t I>
+    typename SoAArray<Fields...>::template Column<I>::type* SoAArray<Fields...>::columnData() {
+        return std::get<I>(this->_columns)._data.data();
+    }
+
+    template <typename... Fields>
+    template <size_t I>
+    const typename SoAArray<Fields...>::template Column<I>::type* SoAArray<Fields...>::columnData() const {
+        return std::get<I>(this->_columns)._data.data();
+    }
+
+    template <typename... Fields>
+    template <size_t I>
+    ArraySlice<typename SoAArray<Fields...>::template Column<I>::type> SoAArray<Fields...>::columnSlice() const {
+        return ArraySlice<typename Column<I>::type>(std::get<I>(this->_columns));
+    }
+
+
+    // Column Scans
+    template <typename... Fields>
+    template <size_t I>
+    typename SoAArray<Fields...>::template Column<I>::type SoAArray<Fields...>::sum() const {
+        typedef typename Column<I>::type T;
+        const T* data = std::get<I>(this->_columns)._data.data();
+        size_t size = this->size();
+
+        // Independent accumulators let the loop vectorize without reassociating
+        T lanes[4] = {T(), T(), T(), T()};
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4) {
+            lanes[0] += data[i];
+            lanes[1] += data[i + 1];
+            lanes[2] += data[i + 2];
+            lanes[3] += data[i + 3];
+        }
+
+        for (; i < size; ++i) {
+            lanes[0] += data[i];
+        }
+
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+
+    template <typename... Fields>
+    template <size_t I, typename F>
+    size_t SoAArray<Fields...>::count(F predicate) const {
+        typedef typename Column<I>::type T;
+        const T* data = std::get<I>(this->_columns)._data.data();
+        size_t size = this->size();
+
+        // Counting without a branch lets simple predicates vectorize
+        size_t count = 0;
+        for (size_t i = 0; i < size; ++i) {
+            count += predicate(data[i]) ? 1 : 0;
+        }
+
+        return count;
+    }
+
+    template <typename... Fields>
+    template <size_t I, typename F>
+    Array<size_t> SoAArray<Fields...>::indicesWhere(F predicate) const {
+        typedef typename Column<I>::type T;
+        const T* data = std::get<I>(this->_columns)._data.data();
+        size_t size = this->size();
+
+        Array<size_t> indices = Array<size_t>();
+        for (size_t i = 0; i < size; ++i) {
+            if (predicate(data[i])) {
+                indices._data.push_back(i);
+            }
+        }
+
+        return indices;
+    }
+
+
+    // Conversion To Array
+    template <typename... Fields>
+    template <typename R>
+    Array<R> SoAArray<Fields...>::toArray(Fields R::*... members) const {
+        Array<R> records = Array<R>(this->size());
+        std::tuple<Fields R::*...> pointers(members...);
+
+        for (size_t i = 0; i < this->size(); ++i) {
+            this->_assign(records._data[i], i, pointers, typename SoAMakeIndices<sizeof...(Fields)>::type());
+        }
+
+        return records;
+    }
+
+
+    // String Representation
+    template <typename... Fields>
+    std::string SoAArray<Fields...>::description() const {
+        DescriptionWriter writer;
+        this->describeTo(writer);
+        return writer.take();
+    }
+
+    template <typename... Fields>
+    void SoAArray<Fields...>::describeTo(DescriptionWriter& writer) const {
+        writer.write('[');
+
+        for (size_t i = 0; i < this->size(); ++i) {
+            if (i != 0) {
+                writer.write(", ", 2);
+            }
+
+            writer.write('(');
+            this->_describe(writer, i, typename SoAMakeIndices<sizeof...(Fields)>::type());
+            writer.write(')');
+        }
+
+        writer.write(']');
+    }
+
+
+    // Internal Functions
+    template <typename... Fields>
+    template <size_t... Is>
+    void SoAArray<Fields...>::_add(const Record& record, SoAIndices<Is...>) {
+        size_t size = this->size();
+
+        // If a field throws, the columns it was already added to are cut back to the old length
+        try {
+            int expand[] = {(std::get<Is>(this->_columns)._data.push_back(std::get<Is>(record)), 0)...};
+            (void)expand;
+        }
+        catch (...) {
+            int expand[] = {(_truncate(std::get<Is>(this->_columns), size), 0)...};
+            (void)expand;
+            throw;
+        }
+    }
+
+    template <typename... Fields>
+    template <size_t... Is>
+    typename SoAArray<Fields...>::Record SoAArray<Fields...>::_record(size_t index, SoAIndices<Is...>) const {
+        return Record(std::get<Is>(this->_columns)._data[index]...);
+    }
+
+    template <typename... Fields>
+    template <size_t... Is>
+    void SoAArray<Fields...>::_removeIndex(size_t index, SoAIndices<Is...>) {
+        int expand[] = {(std::get<Is>(this->_columns).removeIndex(index), 0)...};
+        (void)expand;
+    }
+
+    template <typename... Fields>
+    template <size_t... Is>
+    void SoAArray<Fields...>::_reserve(size_t capacity, SoAIndices<Is...>) {
+        int expand[] = {(std::get<Is>(this->_columns)._data.reserve(capacity), 0)...};
+        (void)expand;
+    }
+
+    template <typename... Fields>
+    template <typename R, size_t... Is>
+    void SoAArray<Fields...>::_assign(R& record, size_t index, const std::tuple<Fields R::*...>& members, SoAIndices<Is...>) const {
+        int expand[] = {(record.*std::get<Is>(members) = std::get<Is>(this->_columns)._data[index], 0)...};
+        (void)expand;
+    }
+
+    template <typename... Fields>
+    template <size_t... Is>
+    void SoAArray<Fields...>::_describe(DescriptionWriter& writer, size_t index, SoAIndices<Is...>) const {
+        // Braced initializers are evaluated left to right, keeping the fields in order
+        int expand[] = {(writer.write(Is == 0 ? "" : ", ").value(std::get<Is>(this->_columns)._data[index]), 0)...};
+        (void)expand;
+    }
+
+    template <typename... Fields>
+    template <typename C>
+    void SoAArray<Fields...>::_truncate(C& column, size_t size) {
+        while (column._data.size() > size) {
+            column._data.pop_back();
+        }
+    }
+}
+
+#endif // MRLIB_SOA_ARRAY_HPP
@@ -0,0 +1,447 @@
+//
+// SortedArray.hpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+/*
+ * The purpose of this class is to keep an Array in sorted order at all
+ * times. Because the order is known, finding objects is a binary search,
+ * adding a batch of objects is a single merge, and set union, intersection
+ * and difference with another SortedArray are done in linear time.
+ *
+ * Objects are compared with Compare, and two objects are considered equal
+ * when neither orders before the other.
+ */
+
+
+#ifndef MRLIB_SORTED_ARRAY_HPP
+#define MRLIB_SORTED_ARRAY_HPP
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "Array.hpp"
+
+// Index Constants
+#ifndef NO_INDEX
+#define NO_INDEX -1ull
+#endif
+
+// Index out of bounds exception
+#define SORTED_ARRAY_OUT_BOUNDS std::invalid_argument("SortedArray: Out of bounds exception")
+#define SORTED_ARRAY_INV_FROM_TO std::invalid_argument("SortedArray: from_index must be less than to_index")
+
+namespace mrlib {
+
+    template <typename T, typename Compare = std::less<T>>
+    class SortedArray {
+    public:
+        // Internal Data
+        Array<T>  _array;
+        Compare   _compare;
+
+        // Constructors
+        SortedArray(const Compare& compare = Compare());
+        SortedArray(std::initializer_list<T> i_list, const Compare& compare = Compare());
+        SortedArray(const Array<T>& array, const Compare& compare = Compare());
+
+        // Operator Overloading
+        const T&  operator[](const size_t index) const;
+        bool      operator==(const SortedArray<T, Compare>& array) const;
+        bool      operator!=(const SortedArray<T, Compare>& array) const;
+
+        // Querying Array
+        T       objectAtIndex(size_t index) const;
+        T       firstObject() const;
+        T       lastObject() const;
+        bool    contains(const T& object) const;
+        bool    containsAll(const SortedArray<T, Compare>& objects) const;
+        size_t  size() const;
+        bool    isEmpty() const;
+
+        // Adding Objects
+        SortedArray<T, Compare>&  add(const T& object);
+        SortedArray<T, Compare>&  addAll(const Array<T>& objects);
+        SortedArray<T, Compare>&  addAll(const SortedArray<T, Compare>& objects);
+
+        // Removing Objects
+        T                         pop();
+        T                         popFirst();
+        SortedArray<T, Compare>&  remove(const T& object);
+        SortedArray<T, Compare>&  removeIndex(size_t index);
+        SortedArray<T, Compare>&  removeRange(size_t from_index, size_t to_index);
+        SortedArray<T, Compare>&  removeAll(const T& object);
+        SortedArray<T, Compare>&  removeAll();
+
+        // Finding Objects
+        size_t                     indexOf(const T& object) const;
+        size_t                     indexOfLast(const T& object) const;
+        size_t                     lowerBound(const T& object) const;
+        size_t                     upperBound(const T& object) const;
+        std::pair<size_t, size_t>  equalRange(const T& object) const;
+        size_t                     count(const T& object) const;
+
+        // Set Operations
+        SortedArray<T, Compare>  unionWith(const SortedArray<T, Compare>& array) const;
+        SortedArray<T, Compare>  intersectionWith(const SortedArray<T, Compare>& array) const;
+        SortedArray<T, Compare>  differenceWith(const SortedArray<T, Compare>& array) const;
+
+        // Dividing Array
+        ArraySlice<T>  slice(size_t from_index, size_t to_index) const;
+
+        // Getting Containers
+        const Array<T>&  array() const;
+        std::vector<T>   std_vector() const;
+
+        // String Representation
+        std::string  description() const;
+
+    private:
+        bool  _equivalent(const T& first, const T& second) const;
+    };
+
+
+    /////////////////////////////
+    // TEMPLATE IMPLEMENTATION //
+    /////////////////////////////
+
+    // Constructors
+    template <typename T, typename Compare>
+    SortedArray<T, Compare>::SortedArray(const Compare& compare) : _compare(compare) {
+        this->_array = Array<T>();
+    }
+
+    template <typename T, typename Compare>
+    SortedArray<T, Compare>::SortedArray(std::initializer_list<T> i_list, const Compare& compare) : _compare(compare) {
+        this->_array = Array<T>(i_list);
+        std::stable_sort(this->_array._data.begin(), this->_array._data.end(), this->_compare);
+    }
+
+    template <typename T, typename Compare>
+    SortedArray<T, Compare>::SortedArray(const Array<T>& array, const Compare& compare) : _compare(compare) {
+        this->_array = array;
+        std::stable_sort(this->_array._data.begin(), this->_array._data.end(), this->_compare);
+    }
+
+
+    // Operator Overloading
+    template <typename T, typename Compare>
+    const T& SortedArray<T, Compare>::operator[](const size_t index) const {
+        if (index < this->_array._data.size()) {
+            return this->_array._data[index];
+        }
+        else {
+            throw SORTED_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T, typename Compare>
+    bool SortedArray<T, Compare>::operator==(const SortedArray<T, Compare>& array) const {
+        return this->_array == array._array;
+    }
+
+    template <typename T, typename Compare>
+    bool SortedArray<T, Compare>::operator!=(const SortedArray<T, Compare>& array) const {
+        return this->_array != array._array;
+    }
+
+
+    // Querying Array
+    template <typename T, typename Compare>
+    T SortedArray<T, Compare>::objectAtIndex(size_t index) const {
+        return (*this)[index];
+    }
+
+    template <typename T, typename Compare>
+    T SortedArray<T, Compare>::firstObject() const {
+        if (this->_array._data.size() > 0) {
+            return this->_array._data.front();
+        }
+        else {
+            throw SORTED_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T, typename Compare>
+    T SortedArray<T, Compare>::lastObject() const {
+        if (this->_array._data.size() > 0) {
+            return this->_array._data.back();
+        }
+        else {
+            throw SORTED_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T, typename Compare>
+    bool SortedArray<T, Compare>::contains(const T& object) const {
+        return this->indexOf(object) != NO_INDEX;
+    }
+
+    template <typename T, typename Compare>
+    bool SortedArray<T, Compare>::containsAll(const SortedArray<T, Compare>& objects) const {
+        const std::vector<T>& data = this->_array._data;
+        const std::vector<T>& other = objects._array._data;
+        return std::includes(data.begin(), data.end(), other.begin(), other.end(), this->_compare);
+    }
+
+    template <typename T, typename Compare>
+    size_t SortedArray<T, Compare>::size() const {
+        return this->_array._data.size();
+    }
+
+    template <typename T, typename Compare>
+    bool SortedArray<T, Compare>::isEmpty() const {
+        return this->_array._data.empty();
+    }
+
+
+    // Adding Objects
+    template <typename T, typename Compare>
+    SortedArray<T, Compare>& SortedArray<T, Compare>::add(const T& object) {
+        std::vector<T>& data = this->_array._data;
+        data.insert(data.begin() + this->upperBound(object), object);
+        return *this;
+    }
+
+    template <typename T, typename Compare>
+    SortedArray<T, Compare>& SortedArray<T, Compare>::addAll(const Array<T>& objects) {
+        std::vector<T>& data = this->_array._data;
+        size_t middle = data.size();
+
+        // Sort the new run at the back then merge it with the existing run
+        if (&objects == &this->_array) {
+            std::vector<T> copy = data;
+            data.insert(data.end(), copy.begin(), copy.end());
+        }
+        else {
+            data.insert(data.end(), objects._data.begin(), objects._data.end());
+        }
+
+        std::stable_sort(data.begin() + middle, data.end(), this->_compare);
+        std::inplace_merge(data.begin(), data.begin() + middle, data.end(), this->_compare);
+
+        return *this;
+    }
+
+    template <typename T, typename Compare>
+    SortedArray<T, Compare>& SortedArray<T, Compare>::addAll(const SortedArray<T, Compare>& objects) {
+        std::vector<T>& data = this->_array._data;
+        size_t middle = data.size();
+
+        // A vector can not insert a range of itself, so a run added to itself is copied first
+        if (this == &objects) {
+            std::vector<T> copy = data;
+            data.insert(data.end(), copy.begin(), copy.end());
+        }
+        else {
+            data.insert(data.end(), objects._array._data.begin(), objects._array._data.end());
+        }
+
+        std::inplace_merge(data.begin(), data.begin() + middle, data.end(), this->_compare);
+
+        return *this;
+    }
+
+
+    // Removing Objects
+    template <typename T, typename Compare>
+    T SortedArray<T, Compare>::pop() {
+        if (this->_array._data.size() > 0) {
+            return this->_array.pop();
+        }
+        else {
+            throw SORTED_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T, typename Compare>
+    T SortedArray<T, Compare>::popFirst() {
+        if (this->_array._data.size() > 0) {
+            return this->_array.popFirst();
+        }
+        else {
+            throw SORTED_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T, typename Compare>
+    SortedArray<T, Compare>& SortedArray<T, Compare>::remove(const T& object) {
+        size_t index = this->indexOf(object);
+
+        if (index != NO_INDEX) {
+            this->_array._data.erase(this->_array._data.begin() + index);
+        }
+
+        return *this;
+    }
+
+    template <typename T, typename Compare>
+    SortedArray<T, Compare>& SortedArray<T, Compare>::removeIndex(size_t index) {
+        if (index < this->_array._data.size()) {
+            this->_array._data.erase(this->_array._data.begin() + index);
+            return *this;
+        }
+        else {
+            throw SORTED_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T, typename Compare>
+    SortedArray<T, Compare>& SortedArray<T, Compare>::removeRange(size_t from_index, size_t to_index) {
+        if (from_index > to_index) {
+            throw SORTED_ARRAY_INV_FROM_TO;
+        }
+
+        if (from_index < this->_array._data.size() && to_index < this->_array._data.size()) {
+            this->_array._data.erase(this->_array._data.begin() + from_index, this->_array._data.begin() + to_index);
+            return *this;
+        }
+        else {
+            throw SORTED_ARRAY_OUT_BOUNDS;
+        }
+    }
+
+    template <typename T, typename Compare>
+    SortedArray<T, Compare>& SortedArray<T, Compare>::removeAll(const T& object) {
+        std::pair<size_t, size_t> range = this->equalRange(object);
+        this->_array._data.erase(this->_array._data.begin() + range.first, this->_array._data.begin() + range.second);
+        return *this;
+    }
+
+    template <typename T, typename Compare>
+    SortedArray<T, Compare>& SortedArray<T, Compare>::removeAll() {
+        this->_array._data.clear();
+        return *this;
+    }
+
+
+    // Finding Objects
+    template <typename T, typename Compare>
+    size_t SortedArray<T, Compare>::indexOf(const T& object) const {
+        size_t index = this->lowerBound(object);
+
+        if (index < this->_array._data.size() && this->_equivalent(this->_array._data[index], object)) {
+            return index;
+        }
+
+        return NO_INDEX;
+    }
+
+    template <typename T, typename Compare>
+    size_t SortedArray<T, Compare>::indexOfLast(const T& object) const {
+        size_t index = this->upperBound(object);
+
+        if (index > 0 && this->_equivalent(this->_array._data[index - 1], object)) {
+            return index - 1;
+        }
+
+        return NO_INDEX;
+    }
+
+    template <typename T, typename Compare>
+    size_t SortedArray<T, Compare>::lowerBound(const T& object) const {
+        const std::vector<T>& data = this->_array._data;
+        return std::lower_bound(data.begin(), data.end(), object, this->_compare) - data.begin();
+    }
+
+    template <typename T, typename Compare>
+    size_t SortedArray<T, Compare>::upperBound(const T& object) const {
+        const std::vector<T>& data = this->_array._data;
+        return std::upper_bound(data.begin(), data.end(), object, this->_compare) - data.begin();
+    }
+
+    template <typename T, typename Compare>
+    std::pair<size_t, size_t> SortedArray<T, Compare>::equalRange(const T& object) const {
+        const std::vector<T>& data = this->_array._data;
+        auto range = std::equal_range(data.begin(), data.end(), object, this->_compare);
+        return std::make_pair(size_t(range.first - data.begin()), size_t(range.second - data.begin()));
+    }
+
+    template <typename T, typename Compare>
+    size_t SortedArray<T, Compare>::count(const T& object) const {
+        std::pair<size_t, size_t> range = this->equalRange(object);
+        return range.second - range.first;
+    }
+
+
+    // Set Operations
+    template <typename T, typename Compare>
+    SortedArray<T, Compare> SortedArray<T, Compare>::unionWith(const SortedArray<T, Compare>& array) const {
+        const std::vector<T>& first = this->_array._data;
+        const std::vector<T>& second = array._array._data;
+
+        SortedArray<T, Compare> result = SortedArray<T, Compare>(this->_compare);
+        result._array._data.reserve(first.size() + second.size());
+        std::set_union(first.begin(), first.end(), second.begin(), second.end(),
+                       std::back_inserter(result._array._data), this->_compare);
+
+        return result;
+    }
+
+    template <typename T, typename Compare>
+    SortedArray<T, Compare> SortedArray<T, Compare>::intersectionWith(const SortedArray<T, Compare>& array) const {
+        const std::vector<T>& first = this->_array._data;
+        const std::vector<T>& second = array._array._data;
+
+        SortedArray<T, Compare> result = SortedArray<T, Compare>(this->_compare);
+        result._array._data.reserve(std::min(first.size(), second.size()));
+        std::set_intersection(first.begin(), first.end(), second.begin(), second.end(),
+                              std::back_inserter(result._array._data), this->_compare);
+
+        return result;
+    }
+
+    template <typename T, typename Compare>
+    SortedArray<T, Compare> SortedArray<T, Compare>::differenceWith(const SortedArray<T, Compare>& array) const {
+        const std::vector<T>& first = this->_array._data;
+        const std::vector<T>& second = array._array._data;
+
+        SortedArray<T, Compare> result = SortedArray<T, Compare>(this->_compare);
+        result._array._data.reserve(first.size());
+        std::set_difference(first.begin(), first.end(), second.begin(), second.end(),
+                            std::back_inserter(result._array._data), this->_compare);
+
+        return result;
+    }
+
+
+    // Dividing Array
+    template <typename T, typename Compare>
+    ArraySlice<T> SortedArray<T, Compare>::slice(size_t from_index, size_t to_index) const {
+        return this->_array.slice(from_index, to_index);
+    }
+
+
+    // Getting Containers
+    template <typename T, typename Compare>
+    const Array<T>& SortedArray<T, Compare>::array() const {
+        return this->_array;
+    }
+
+    template <typename T, typename Compare>
+    std::vector<T> SortedArray<T, Compare>::std_vector() const {
+        return this->_array._data;
+    }
+
+
+    // String Representation
+    template <typename T, typename Compare>
+    std::string SortedArray<T, Compare>::description() const {
+        return this->_array.description();
+    }
+
+
+    // Internal Functions
+    template <typename T, typename Compare>
+    bool SortedArray<T, Compare>::_equivalent(const T& first, const T& second) const {
+        return !this->_compare(first, second) && !this->_compare(second, first);
+    }
+}
+
+#endif // MRLIB_SORTED_ARRAY_HPP
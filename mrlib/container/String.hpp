@@ -71,7 +71,10 @@ namespace mrlib {
         String&       operator+=(const String& string);
         bool          operator==(const String& string) const;
         bool          operator!=(const String& string) const;
-        // TODO: < and > overload <= >=
+        bool          operator<(const String& string) const;
+        bool          operator>(const String& string) const;
+        bool          operator<=(const String& string) const;
+        bool          operator>=(const String& string) const;
 
         // User Defined Conversions
         //operator std::string() const;
@@ -179,6 +182,9 @@ namespace mrlib {
         // TODO: matches regex / index of regex pattern
     };
 
+    // Stream Output
+    std::ostream&  operator<<(std::ostream& stream, const String& string);
+
 
     /////////////////////////////
     // TEMPLATE IMPLEMENTATION //
@@ -303,6 +309,26 @@ namespace mrlib {
         return this->_data != string._data;
     }
 
+    inline
+    bool String::operator<(const String& string) const {
+        return this->_data < string._data;
+    }
+
+    inline
+    bool String::operator>(const String& string) const {
+        return this->_data > string._data;
+    }
+
+    inline
+    bool String::operator<=(const String& string) const {
+        return this->_data <= string._data;
+    }
+
+    inline
+    bool String::operator>=(const String& string) const {
+        return this->_data >= string._data;
+    }
+
 
     // Creating and Initializing Strings
     inline
@@ -884,6 +910,13 @@ int String::compareOverRange(const String& string, size_t from_index, size_t to_
 
         return oss.str();
     }
+
+
+    // Stream Output
+    inline
+    std::ostream& operator<<(std::ostream& stream, const String& string) {
+        return stream << string._data;
+    }
 }
 
 
@@ -16,6 +16,7 @@
 
 #include <random>
 #include <cfloat>
+#include <climits>
 
 namespace mrlib {
 
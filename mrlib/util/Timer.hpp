@@ -11,6 +11,7 @@
 
 #include <chrono>
 #include <thread>
+#include <functional>
 
 
 namespace mrlib {
@@ -0,0 +1,159 @@
+//
+// ArrayFile_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "ArrayFile.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+static const std::string TestPath = "/tmp/mrlib_array_file_test.bin";
+
+struct Point {
+    int     x;
+    double  y;
+};
+
+
+///////////////////
+// Serialization //
+///////////////////
+
+TEST(ArrayFile, serialize_raw) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    std::string bytes = ArrayFile::serialize(array);
+    Array<int> result = ArrayFile::deserialize<int>(bytes);
+
+    // Assertion
+    EXPECT_EQ(sizeof(ArrayFileHeader) + 3 * sizeof(int), bytes.size());
+    EXPECT_EQ(array, result);
+}
+
+TEST(ArrayFile, serialize_empty) {
+    // Setup
+    Array<double> array = Array<double>();
+    Array<double> result = ArrayFile::deserialize<double>(ArrayFile::serialize(array));
+
+    // Assertion
+    EXPECT_TRUE(result.isEmpty());
+}
+
+TEST(ArrayFile, serialize_string) {
+    // Setup
+    Array<std::string> array = {"one", "", "three"};
+    Array<std::string> result = ArrayFile::deserialize<std::string>(ArrayFile::serialize(array));
+
+    // Assertion
+    EXPECT_EQ(array, result);
+}
+
+TEST(ArrayFile, serialize_mrlib_string) {
+    // Setup
+    Array<String> array = {String("hello"), String("world")};
+    Array<String> result = ArrayFile::deserialize<String>(ArrayFile::serialize(array));
+
+    // Assertion
+    ASSERT_EQ(2, result.size());
+    EXPECT_EQ("hello", result[0]._data);
+    EXPECT_EQ("world", result[1]._data);
+}
+
+TEST(ArrayFile, invalid_data) {
+    // Setup
+    std::string bytes = ArrayFile::serialize(Array<int>({1, 2, 3}));
+    std::string truncated = bytes.substr(0, bytes.size() - 1);
+    std::string swapped = bytes;
+    std::swap(swapped[4], swapped[7]);
+
+    // Assertion
+    EXPECT_ANY_THROW(ArrayFile::deserialize<int>("bad"));
+    EXPECT_ANY_THROW(ArrayFile::deserialize<int>(truncated));
+    EXPECT_ANY_THROW(ArrayFile::deserialize<int>(swapped));
+    EXPECT_ANY_THROW(ArrayFile::deserialize<long long>(bytes));
+    EXPECT_ANY_THROW(ArrayFile::deserialize<std::string>(bytes));
+}
+
+
+///////////
+// Files //
+///////////
+
+TEST(ArrayFile, write_read) {
+    // Setup
+    Array<Point> array = Array<Point>();
+    for (int i = 0; i < 1000; ++i) {
+        array.add({i, i * 0.5});
+    }
+
+    ArrayFile::write(TestPath, array);
+    Array<Point> result = ArrayFile::read<Point>(TestPath);
+    ::unlink(TestPath.c_str());
+
+    // Assertion
+    ASSERT_EQ(1000, result.size());
+    EXPECT_EQ(999, result[999].x);
+    EXPECT_EQ(499.5, result[999].y);
+}
+
+TEST(ArrayFile, write_read_string) {
+    // Setup
+    Array<std::string> array = {"a", "bb", "ccc"};
+    ArrayFile::write(TestPath, array);
+    Array<std::string> result = ArrayFile::read<std::string>(TestPath);
+    ::unlink(TestPath.c_str());
+
+    // Assertion
+    EXPECT_EQ(array, result);
+}
+
+TEST(ArrayFile, map) {
+    // Setup
+    Array<long> array = {10, 20, 30, 40};
+    ArrayFile::write(TestPath, array);
+    MappedArray<long> mapped = ArrayFile::map<long>(TestPath);
+    ::unlink(TestPath.c_str());
+
+    // Assertion
+    EXPECT_EQ(4, mapped.size());
+    EXPECT_EQ(30, mapped[2]);
+    EXPECT_ANY_THROW(mapped[4]);
+    EXPECT_EQ("[20, 30]", mapped.slice().slice(1, 2).description());
+    EXPECT_EQ(array, mapped.copy());
+}
+
+TEST(ArrayFile, map_move) {
+    // Setup
+    ArrayFile::write(TestPath, Array<int>({1, 2}));
+    MappedArray<int> mapped1 = ArrayFile::map<int>(TestPath);
+    MappedArray<int> mapped2 = std::move(mapped1);
+    ::unlink(TestPath.c_str());
+
+    // Assertion
+    EXPECT_EQ(2, mapped2[1]);
+    EXPECT_EQ(nullptr, mapped1._mapping.data());
+}
+
+TEST(ArrayFile, writer_not_committed) {
+    // Setup
+    ArrayFile::write(TestPath, Array<int>({1, 2}));
+    {
+        ArrayFileWriter writer(TestPath);
+        writer.write("partial", 7);
+    }
+    Array<int> result = ArrayFile::read<int>(TestPath);
+    ::unlink(TestPath.c_str());
+
+    // Assertion, the file at the path is left as it was
+    EXPECT_EQ(Array<int>({1, 2}), result);
+}
+
+TEST(ArrayFile, missing_file) {
+    // Assertion
+    EXPECT_ANY_THROW(ArrayFile::read<int>("/tmp/mrlib_array_file_missing.bin"));
+    EXPECT_ANY_THROW(ArrayFile::map<int>("/tmp/mrlib_array_file_missing.bin"));
+}
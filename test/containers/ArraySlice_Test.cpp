@@ -0,0 +1,255 @@
+//
+// ArraySlice_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "Array.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+//////////////////
+// CONSTRUCTORS //
+//////////////////
+
+TEST(ArraySlice, default_constructor) {
+    // Setup
+    ArraySlice<int> slice = ArraySlice<int>();
+
+    // Assertion
+    EXPECT_EQ(0, slice.size());
+    EXPECT_TRUE(slice.isEmpty());
+}
+
+TEST(ArraySlice, array_constructor) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    ArraySlice<int> slice = ArraySlice<int>(array);
+
+    // Assertion
+    EXPECT_EQ(3, slice.size());
+    EXPECT_EQ(array._data.data(), slice._begin);
+}
+
+
+////////////////////
+// Slicing Arrays //
+////////////////////
+
+TEST(ArraySlice, array_slice_no_copy) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4, 5};
+    ArraySlice<int> slice = array.slice(1, 3);
+    std::vector<int> expect = {2, 3, 4};
+
+    // Assertion
+    EXPECT_EQ(&array._data[1], slice._begin);
+    EXPECT_EQ(expect, slice.std_vector());
+}
+
+TEST(ArraySlice, array_slice_from_index) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4, 5};
+    ArraySlice<int> slice = array.sliceFromIndex(2);
+    std::vector<int> expect = {3, 4, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, slice.std_vector());
+}
+
+TEST(ArraySlice, array_slice_to_index) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4, 5};
+    ArraySlice<int> slice = array.sliceToIndex(3);
+    std::vector<int> expect = {1, 2, 3};
+
+    // Assertion
+    EXPECT_EQ(expect, slice.std_vector());
+}
+
+TEST(ArraySlice, array_slice_bounds_check) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+
+    // Assertion
+    EXPECT_ANY_THROW(array.slice(2, 5));
+    EXPECT_ANY_THROW(array.slice(2, 1));
+    EXPECT_ANY_THROW(array.sliceFromIndex(3));
+    EXPECT_ANY_THROW(array.sliceToIndex(3));
+}
+
+TEST(ArraySlice, nested_slice) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4, 5, 6};
+    ArraySlice<int> slice = array.slice(1, 4).slice(1, 2);
+    std::vector<int> expect = {3, 4};
+
+    // Assertion
+    EXPECT_EQ(expect, slice.std_vector());
+    EXPECT_ANY_THROW(array.slice(1, 4).slice(0, 4));
+}
+
+
+////////////////////
+// Querying Slice //
+////////////////////
+
+TEST(ArraySlice, operator_access) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4};
+    ArraySlice<int> slice = array.slice(1, 2);
+
+    // Assertion
+    EXPECT_EQ(2, slice[0]);
+    EXPECT_EQ(3, slice.objectAtIndex(1));
+    EXPECT_ANY_THROW(slice[2]);
+}
+
+TEST(ArraySlice, first_last_object) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4};
+    ArraySlice<int> slice = array.slice(1, 2);
+
+    // Assertion
+    EXPECT_EQ(2, slice.firstObject());
+    EXPECT_EQ(3, slice.lastObject());
+    EXPECT_ANY_THROW(ArraySlice<int>().firstObject());
+    EXPECT_ANY_THROW(ArraySlice<int>().lastObject());
+}
+
+TEST(ArraySlice, contains) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4};
+    ArraySlice<int> slice = array.slice(1, 2);
+
+    // Assertion
+    EXPECT_TRUE(slice.contains(2));
+    EXPECT_FALSE(slice.contains(1));
+    EXPECT_FALSE(ArraySlice<int>().contains(1));
+    EXPECT_TRUE(slice.containsAll(array.slice(2, 2)));
+    EXPECT_FALSE(slice.containsAll(array));
+}
+
+TEST(ArraySlice, iteration) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4};
+    int sum = 0;
+    for (int n : array.sliceFromIndex(2)) {
+        sum += n;
+    }
+
+    // Assertion
+    EXPECT_EQ(7, sum);
+}
+
+
+/////////////////////
+// Finding Objects //
+/////////////////////
+
+TEST(ArraySlice, index_of) {
+    // Setup
+    Array<int> array = {1, 2, 3, 2, 1};
+    ArraySlice<int> slice = array.sliceFromIndex(1);
+
+    // Assertion
+    EXPECT_EQ(0, slice.indexOf(2));
+    EXPECT_EQ(2, slice.indexOf(2, 1));
+    EXPECT_EQ(NO_INDEX, slice.indexOf(5));
+    EXPECT_ANY_THROW(slice.indexOf(2, 4));
+}
+
+TEST(ArraySlice, index_of_last) {
+    // Setup
+    Array<int> array = {1, 2, 3, 2, 1};
+    ArraySlice<int> slice = array.sliceToIndex(4);
+
+    // Assertion
+    EXPECT_EQ(3, slice.indexOfLast(2));
+    EXPECT_EQ(1, slice.indexOfLast(2, 2));
+    EXPECT_EQ(NO_INDEX, slice.indexOfLast(5));
+    EXPECT_EQ(NO_INDEX, ArraySlice<int>().indexOfLast(5));
+}
+
+TEST(ArraySlice, index_of_object_in_range) {
+    // Setup
+    Array<int> array = {1, 2, 3, 1, 4, 5, 6, 1};
+    ArraySlice<int> slice = array.sliceFromIndex(1);
+
+    // Assertion
+    EXPECT_EQ(2, slice.indexOfObjectInRange(1, 1, 5));
+    EXPECT_EQ(NO_INDEX, slice.indexOfObjectInRange(6, 0, 3));
+    EXPECT_ANY_THROW(slice.indexOfObjectInRange(1, 3, 2));
+}
+
+
+////////////////////
+// Slice Streams  //
+////////////////////
+
+TEST(ArraySlice, stream) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4, 5};
+    int sum = array.slice(1, 3).stream().reduce(0, [](int a, int b) { return a + b; });
+
+    // Assertion
+    EXPECT_EQ(9, sum);
+}
+
+
+///////////////////////////
+// Comparing and Copying //
+///////////////////////////
+
+TEST(ArraySlice, is_equal_to) {
+    // Setup
+    Array<int> array = {1, 2, 1, 2};
+
+    // Assertion
+    EXPECT_TRUE(array.slice(0, 1) == array.slice(2, 3));
+    EXPECT_TRUE(array.slice(0, 1) != array.slice(1, 2));
+    EXPECT_FALSE(array.slice(0, 1).isEqualTo(array.slice(0, 2)));
+}
+
+TEST(ArraySlice, copy) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    Array<int> copy = array.sliceFromIndex(1).copy();
+    copy[0] = 5;
+    std::vector<int> expect1 = {5, 3};
+    std::vector<int> expect2 = {1, 2, 3};
+
+    // Assertion
+    EXPECT_EQ(expect1, copy._data);
+    EXPECT_EQ(expect2, array._data);
+}
+
+
+///////////////////////////
+// String Representation //
+///////////////////////////
+
+TEST(ArraySlice, description) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4};
+
+    // Assertion
+    EXPECT_EQ("[2, 3]", array.slice(1, 2).description());
+    EXPECT_EQ("[]", ArraySlice<int>().description());
+}
+
+TEST(ArraySlice, inspect) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4};
+    std::string desc = array.slice(1, 2).inspect();
+    std::string expect1 = "Address: ";
+    std::string expect2 = " Size: 2 [2, 3]";
+
+    // Assertion
+    // Checking seperatley since address is unknowable
+    EXPECT_EQ(expect1, desc.substr(0, 9));
+    EXPECT_EQ(expect2, desc.substr(desc.size() - expect2.size(), desc.size()));
+}
@@ -0,0 +1,210 @@
+//
+// ArrayStream_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "Array.hpp"
+#include "gtest.h"
+
+#include <atomic>
+#include <stdexcept>
+
+using namespace mrlib;
+
+
+// Large enough to be split across several chunks
+static Array<long> RangeArray(long size) {
+    Array<long> array = Array<long>();
+    for (long i = 0; i < size; ++i) {
+        array.add(i);
+    }
+
+    return array;
+}
+
+
+////////////////////
+// Execution Mode //
+////////////////////
+
+TEST(ArrayStream, sequential_default) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+
+    // Assertion
+    EXPECT_FALSE(array.stream().isParallel());
+    EXPECT_FALSE(array.parallelStream(4).sequential().isParallel());
+}
+
+TEST(ArrayStream, parallel) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+
+    // Assertion
+    EXPECT_TRUE(array.parallelStream(4).isParallel());
+    EXPECT_TRUE(array.stream().parallel(2).isParallel());
+}
+
+
+////////////////////
+// Chained Stream //
+////////////////////
+
+TEST(ArrayStream, filter_map_reduce) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4, 5, 6};
+    int sum = array.filter([](int n) { return n % 2 == 0; })
+                   .map([](int n) { return n * 10; })
+                   .reduce(0, [](int a, int b) { return a + b; });
+
+    // Assertion
+    EXPECT_EQ(120, sum);
+}
+
+TEST(ArrayStream, filter_map_single_pass) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4};
+    std::vector<std::string> calls = std::vector<std::string>();
+    Array<int> result = array.filter([&](int n) { calls.push_back("f" + std::to_string(n)); return n != 2; })
+                             .map([&](int n) { calls.push_back("m" + std::to_string(n)); return n; });
+    std::vector<std::string> expect = {"f1", "m1", "f2", "f3", "m3", "f4", "m4"};
+
+    // Assertion
+    EXPECT_EQ(expect, calls);
+    EXPECT_EQ(3, result.size());
+}
+
+TEST(ArrayStream, map_map) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    Array<std::string> result = array.map([](int n) { return n + 1; })
+                                     .map([](int n) { return std::to_string(n); });
+    std::vector<std::string> expect = {"2", "3", "4"};
+
+    // Assertion
+    EXPECT_EQ(expect, result._data);
+}
+
+TEST(ArrayStream, count) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4, 5};
+    size_t count = array.filter([](int n) { return n > 2; }).count();
+
+    // Assertion
+    EXPECT_EQ(3, count);
+}
+
+TEST(ArrayStream, reduce_filtered_empty) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+
+    // Assertion
+    EXPECT_THROW(array.filter([](int n) { return n > 3; }).reduce([](int a, int b) { return a + b; }), std::invalid_argument);
+}
+
+
+/////////////////////
+// Parallel Stream //
+/////////////////////
+
+TEST(ArrayStream, parallel_to_array_ordered) {
+    // Setup
+    Array<long> array = RangeArray(100000);
+    Array<long> result = array.parallelStream(4).filter([](long n) { return n % 3 == 0; }).map([](long n) { return n * 2; });
+
+    // Assertion
+    ASSERT_EQ(33334, result.size());
+    for (size_t i = 0; i < result.size(); ++i) {
+        ASSERT_EQ(long(i) * 6, result[i]);
+    }
+}
+
+TEST(ArrayStream, parallel_reduce) {
+    // Setup
+    Array<long> array = RangeArray(100000);
+    long sum = array.parallelStream(4).reduce(0L, [](long a, long b) { return a + b; });
+    long max = array.parallelStream(4).reduce([](long a, long b) { return a > b ? a : b; });
+
+    // Assertion
+    EXPECT_EQ(4999950000L, sum);
+    EXPECT_EQ(99999, max);
+}
+
+TEST(ArrayStream, parallel_reduce_combiner) {
+    // Setup
+    Array<long> array = RangeArray(100000);
+    size_t odd = array.parallelStream(4).reduce(size_t(0),
+                                                [](size_t count, long n) { return count + (n % 2); },
+                                                [](size_t a, size_t b) { return a + b; });
+
+    // Assertion
+    EXPECT_EQ(50000, odd);
+}
+
+TEST(ArrayStream, reduce_to_other_type) {
+    // Setup
+    Array<std::string> words = {"a", "bb", "ccc"};
+    auto length = [](size_t total, const std::string& word) { return total + word.size(); };
+    size_t sequential = words.stream().reduce(size_t(0), length);
+    size_t parallel = words.parallelStream(4).reduce(size_t(0), length);
+
+    // Assertion
+    EXPECT_EQ(6, sequential);
+    EXPECT_EQ(6, parallel);
+}
+
+TEST(ArrayStream, parallel_for_each) {
+    // Setup
+    Array<long> array = RangeArray(100000);
+    std::atomic<long> sum(0);
+    array.parallelStream(4).forEach([&](long n) { sum += n; });
+
+    // Assertion
+    EXPECT_EQ(4999950000L, sum.load());
+}
+
+TEST(ArrayStream, parallel_any_all) {
+    // Setup
+    Array<long> array = RangeArray(100000);
+
+    // Assertion
+    EXPECT_TRUE(array.parallelStream(4).anyOf([](long n) { return n == 99999; }));
+    EXPECT_FALSE(array.parallelStream(4).anyOf([](long n) { return n < 0; }));
+    EXPECT_TRUE(array.parallelStream(4).allOf([](long n) { return n >= 0; }));
+    EXPECT_FALSE(array.parallelStream(4).allOf([](long n) { return n != 50000; }));
+}
+
+TEST(ArrayStream, parallel_partition) {
+    // Setup
+    Array<long> array = RangeArray(100000);
+    std::pair<Array<long>, Array<long>> parts = array.parallelStream(4).partition([](long n) { return n < 25000; });
+
+    // Assertion
+    ASSERT_EQ(25000, parts.first.size());
+    ASSERT_EQ(75000, parts.second.size());
+    EXPECT_EQ(0, parts.first.firstObject());
+    EXPECT_EQ(24999, parts.first.lastObject());
+    EXPECT_EQ(25000, parts.second.firstObject());
+    EXPECT_EQ(99999, parts.second.lastObject());
+}
+
+TEST(ArrayStream, parallel_exception) {
+    // Setup
+    Array<long> array = RangeArray(100000);
+
+    // Assertion
+    EXPECT_THROW(array.parallelStream(4).forEach([](long n) { if (n == 70000) throw std::runtime_error("fail"); }),
+                 std::runtime_error);
+}
+
+TEST(ArrayStream, parallel_empty) {
+    // Setup
+    Array<long> array = Array<long>();
+    Array<long> result = array.parallelStream(4).map([](long n) { return n; });
+
+    // Assertion
+    EXPECT_TRUE(result.isEmpty());
+    EXPECT_EQ(0, array.parallelStream(4).count());
+}
@@ -411,6 +411,32 @@ TEST(Array, is_empty_false) {
 }
 
 
+//////////////
+// Capacity //
+//////////////
+
+TEST(Array, reserve) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    array.reserve(100);
+
+    // Assertion
+    EXPECT_LE(100, array.capacity());
+    EXPECT_EQ(3, array.size());
+}
+
+TEST(Array, shrink_to_fit) {
+    // Setup
+    Array<int> array = Array<int>();
+    array.reserve(100).add(1).add(2).shrinkToFit();
+    std::vector<int> expect = {1, 2};
+
+    // Assertion
+    EXPECT_EQ(2, array.capacity());
+    EXPECT_EQ(expect, array._data);
+}
+
+
 ////////////////////
 // Adding Objects //
 ////////////////////
@@ -438,6 +464,49 @@ TEST(Array, add_all) {
     EXPECT_EQ(expect, array._data);
 }
 
+TEST(Array, add_all_self) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    array.addAll(array);
+    std::vector<int> expect = {1, 2, 3, 1, 2, 3};
+
+    // Assertion
+    EXPECT_EQ(expect, array._data);
+}
+
+TEST(Array, add_all_range) {
+    // Setup
+    Array<int> array = {1, 2};
+    std::vector<int> to_add = {3, 4, 5};
+    array.addAll(to_add.begin(), to_add.end());
+    std::vector<int> expect = {1, 2, 3, 4, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, array._data);
+}
+
+// AddFirst
+
+TEST(Array, add_first) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    array.addFirst(0);
+    std::vector<int> expect = {0, 1, 2, 3};
+
+    // Assertion
+    EXPECT_EQ(expect, array._data);
+}
+
+TEST(Array, add_first_empty) {
+    // Setup
+    Array<int> array = Array<int>();
+    array.addFirst(1);
+    std::vector<int> expect = {1};
+
+    // Assertion
+    EXPECT_EQ(expect, array._data);
+}
+
 // Insert
 
 TEST(Array, insert) {
@@ -458,6 +527,39 @@ TEST(Array, insert_bounds_check) {
     EXPECT_ANY_THROW(array.insert(4, 5));
 }
 
+// InsertAll
+
+TEST(Array, insert_all) {
+    // Setup
+    Array<int> array = {1, 5};
+    Array<int> to_insert = {2, 3, 4};
+    array.insertAll(to_insert, 1);
+    std::vector<int> expect = {1, 2, 3, 4, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, array._data);
+}
+
+TEST(Array, insert_all_range) {
+    // Setup
+    Array<int> array = {1, 2};
+    std::vector<int> to_insert = {7, 8};
+    array.insertAll(to_insert.begin(), to_insert.end(), 0);
+    array.insertAll(array, 1);
+    std::vector<int> expect = {7, 7, 8, 1, 2, 8, 1, 2};
+
+    // Assertion
+    EXPECT_EQ(expect, array._data);
+}
+
+TEST(Array, insert_all_bounds_check) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+
+    // Assertion
+    EXPECT_ANY_THROW(array.insertAll(Array<int>({4}), 3));
+}
+
 
 /////////////////////
 // Removing Object //
@@ -484,6 +586,27 @@ TEST(Array, pop_bounds_check) {
     EXPECT_ANY_THROW(array.pop());
 }
 
+// PopFirst
+
+TEST(Array, pop_first) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    int n = array.popFirst();
+    std::vector<int> expect = {2, 3};
+
+    // Assertion
+    EXPECT_EQ(n, 1);
+    EXPECT_EQ(expect, array._data);
+}
+
+TEST(Array, pop_first_bounds_check) {
+     // Setup
+    Array<int> array = Array<int>();
+
+    // Assertion
+    EXPECT_ANY_THROW(array.popFirst());
+}
+
 // Remove
 
 TEST(Array, remove_valid) {
@@ -640,6 +763,51 @@ TEST(Array, retain_all_none) {
     EXPECT_EQ(expect, array._data);
 }
 
+// RemoveIf
+
+TEST(Array, remove_if) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4, 5, 6};
+    array.removeIf([](int n) { return n % 2 == 0; });
+    std::vector<int> expect = {1, 3, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, array._data);
+}
+
+// RemoveIndices
+
+TEST(Array, remove_indices) {
+    // Setup
+    Array<int> array = {0, 1, 2, 3, 4, 5, 6};
+    array.removeIndices({0, 2, 2, 3, 6});
+    std::vector<int> expect = {1, 4, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, array._data);
+}
+
+TEST(Array, remove_indices_invalid) {
+    // Setup
+    Array<int> array = {0, 1, 2, 3};
+    std::vector<int> expect = {0, 1, 2, 3};
+
+    // Assertion
+    EXPECT_ANY_THROW(array.removeIndices({1, 4}));
+    EXPECT_ANY_THROW(array.removeIndices({2, 1}));
+    EXPECT_EQ(expect, array._data);
+}
+
+TEST(Array, remove_indices_string) {
+    // Setup
+    Array<std::string> array = {"a", "b", "c", "d"};
+    array.removeIndices({1, 2});
+    std::vector<std::string> expect = {"a", "d"};
+
+    // Assertion
+    EXPECT_EQ(expect, array._data);
+}
+
 
 /////////////////////
 // Replace Objects //
@@ -1031,6 +1199,145 @@ TEST(Array, reverse) {
 }
 
 
+///////////////////////////
+// Functional Operations //
+///////////////////////////
+
+// Map
+
+TEST(Array, map) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    Array<int> mapped = array.map([](int n) { return n * 2; });
+    std::vector<int> expect1 = {2, 4, 6};
+    std::vector<int> expect2 = {1, 2, 3};
+
+    // Assertion
+    EXPECT_EQ(expect1, mapped._data);
+    EXPECT_EQ(expect2, array._data);
+}
+
+TEST(Array, map_type_change) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    Array<std::string> mapped = array.map([](int n) { return std::string(n, 'a'); });
+    std::vector<std::string> expect = {"a", "aa", "aaa"};
+
+    // Assertion
+    EXPECT_EQ(expect, mapped._data);
+}
+
+// Filter
+
+TEST(Array, filter) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4, 5};
+    Array<int> filtered = array.filter([](int n) { return n % 2 == 1; });
+    std::vector<int> expect = {1, 3, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, filtered._data);
+}
+
+TEST(Array, filter_none) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    Array<int> filtered = array.filter([](int n) { return n > 3; });
+    std::vector<int> expect = std::vector<int>();
+
+    // Assertion
+    EXPECT_EQ(expect, filtered._data);
+}
+
+// Reduce
+
+TEST(Array, reduce_identity) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4};
+    int sum = array.reduce(0, [](int a, int b) { return a + b; });
+
+    // Assertion
+    EXPECT_EQ(10, sum);
+}
+
+TEST(Array, reduce_identity_empty) {
+    // Setup
+    Array<int> array = Array<int>();
+    int sum = array.reduce(5, [](int a, int b) { return a + b; });
+
+    // Assertion
+    EXPECT_EQ(5, sum);
+}
+
+TEST(Array, reduce_no_identity) {
+    // Setup
+    Array<int> array = {3, 9, 2};
+    int max = array.reduce([](int a, int b) { return a > b ? a : b; });
+
+    // Assertion
+    EXPECT_EQ(9, max);
+}
+
+TEST(Array, reduce_no_identity_empty) {
+    // Setup
+    Array<int> array = Array<int>();
+
+    // Assertion
+    EXPECT_ANY_THROW(array.reduce([](int a, int b) { return a + b; }));
+}
+
+// ForEach
+
+TEST(Array, for_each) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+    std::vector<int> visited = std::vector<int>();
+    array.forEach([&](int n) { visited.push_back(n); });
+    std::vector<int> expect = {1, 2, 3};
+
+    // Assertion
+    EXPECT_EQ(expect, visited);
+}
+
+// AnyOf
+
+TEST(Array, any_of) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+
+    // Assertion
+    EXPECT_TRUE(array.anyOf([](int n) { return n == 2; }));
+    EXPECT_FALSE(array.anyOf([](int n) { return n == 4; }));
+    EXPECT_FALSE(Array<int>().anyOf([](int) { return true; }));
+}
+
+// AllOf
+
+TEST(Array, all_of) {
+    // Setup
+    Array<int> array = {1, 2, 3};
+
+    // Assertion
+    EXPECT_TRUE(array.allOf([](int n) { return n > 0; }));
+    EXPECT_FALSE(array.allOf([](int n) { return n > 1; }));
+    EXPECT_TRUE(Array<int>().allOf([](int) { return false; }));
+}
+
+// Partition
+
+TEST(Array, partition) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4, 5};
+    std::pair<Array<int>, Array<int>> parts = array.partition([](int n) { return n % 2 == 0; });
+    std::vector<int> expect1 = {2, 4};
+    std::vector<int> expect2 = {1, 3, 5};
+
+    // Assertion
+    EXPECT_EQ(expect1, parts.first._data);
+    EXPECT_EQ(expect2, parts.second._data);
+}
+
+
 //////////////////////
 // Comparing Arrays //
 //////////////////////
@@ -1146,6 +1453,29 @@ TEST(Array, description_empty) {
     EXPECT_EQ(expect, desc);
 }
 
+TEST(Array, description_truncated) {
+    // Setup
+    Array<int> array = {1, 2, 3, 4, 5, 6};
+    std::string desc = array.description(2, 1);
+    std::string expect = "[1, 2, ..., 6]";
+
+    // Assertion
+    EXPECT_EQ(expect, desc);
+    EXPECT_EQ("[1, 2, 3, 4, 5, 6]", array.description(3, 3));
+}
+
+TEST(Array, describe_to) {
+    // Setup
+    Array<double> array = {0.5, 1.25};
+    DescriptionWriter writer;
+    array.describeTo(writer);
+    writer.write(' ');
+    array.describeTo(writer);
+
+    // Assertion
+    EXPECT_EQ("[0.5, 1.25] [0.5, 1.25]", writer.str());
+}
+
 // Inspect
 
 TEST(Array, inspect) {
@@ -0,0 +1,269 @@
+//
+// BitArray_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "BitArray.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+//////////////////
+// CONSTRUCTORS //
+//////////////////
+
+TEST(BitArray, default_constructor) {
+    // Setup
+    BitArray array = BitArray();
+
+    // Assertion
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_EQ(0, array.count());
+    EXPECT_EQ("[]", array.description());
+}
+
+TEST(BitArray, size_constructor) {
+    // Setup
+    BitArray array1 = BitArray(70);
+    BitArray array2 = BitArray(70, true);
+
+    // Assertion
+    EXPECT_EQ(70, array1.size());
+    EXPECT_TRUE(array1.none());
+    EXPECT_EQ(70, array2.count());
+    EXPECT_TRUE(array2.all());
+    EXPECT_EQ(uint64_t(0x3f), array2._words[1]);
+}
+
+TEST(BitArray, initializer_list) {
+    // Setup
+    BitArray array = {true, false, true, true};
+
+    // Assertion
+    EXPECT_EQ("[1, 0, 1, 1]", array.description());
+    EXPECT_EQ(3, array.count());
+}
+
+TEST(BitArray, array_conversion) {
+    // Setup
+    Array<bool> source = {false, true, true};
+    BitArray array = BitArray(source);
+
+    // Assertion
+    EXPECT_EQ(source, array.toArray());
+    EXPECT_EQ(source._data, array.std_vector());
+}
+
+
+////////////////////
+// Modifying Bits //
+////////////////////
+
+TEST(BitArray, set_reset_flip) {
+    // Setup
+    BitArray array = BitArray(130);
+    array.set(0).set(64).set(129).flip(1).flip(0).reset(64);
+
+    // Assertion
+    EXPECT_FALSE(array[0]);
+    EXPECT_TRUE(array[1]);
+    EXPECT_FALSE(array[64]);
+    EXPECT_TRUE(array.objectAtIndex(129));
+    EXPECT_EQ(2, array.count());
+    EXPECT_ANY_THROW(array[130]);
+    EXPECT_ANY_THROW(array.set(130));
+}
+
+TEST(BitArray, set_all_flip_all) {
+    // Setup
+    BitArray array = BitArray(67);
+    array.setAll();
+    size_t all = array.count();
+    array.flipAll();
+
+    // Assertion
+    EXPECT_EQ(67, all);
+    EXPECT_TRUE(array.none());
+    EXPECT_EQ(67, (~array).count());
+}
+
+TEST(BitArray, add_pop_resize) {
+    // Setup
+    BitArray array = BitArray();
+    for (int i = 0; i < 100; ++i) {
+        array.add(i % 3 == 0);
+    }
+
+    bool last = array.pop();
+    array.resize(10).resize(200, true);
+
+    // Assertion
+    EXPECT_TRUE(last);
+    EXPECT_EQ(200, array.size());
+    EXPECT_EQ(4 + 190, array.count());
+    EXPECT_TRUE(array.removeAll().isEmpty());
+    EXPECT_ANY_THROW(array.pop());
+}
+
+
+///////////////////////
+// Bitwise Operators //
+///////////////////////
+
+TEST(BitArray, operators) {
+    // Setup
+    BitArray array1 = {true, true, false, false};
+    BitArray array2 = {true, false, true, false};
+
+    // Assertion
+    EXPECT_EQ(BitArray({true, false, false, false}), array1 & array2);
+    EXPECT_EQ(BitArray({true, true, true, false}), array1 | array2);
+    EXPECT_EQ(BitArray({false, true, true, false}), array1 ^ array2);
+    EXPECT_EQ(BitArray({false, false, true, true}), ~array1);
+    EXPECT_TRUE(array1 != array2);
+    EXPECT_ANY_THROW(array1 & BitArray(5));
+}
+
+
+//////////////////
+// Finding Bits //
+//////////////////
+
+TEST(BitArray, find) {
+    // Setup
+    BitArray array = BitArray(200);
+    array.set(3).set(64).set(65).set(190);
+
+    // Assertion
+    EXPECT_EQ(3, array.findFirst());
+    EXPECT_EQ(64, array.findNext(3));
+    EXPECT_EQ(65, array.findNext(64));
+    EXPECT_EQ(190, array.findNext(65));
+    EXPECT_EQ(NO_INDEX, array.findNext(190));
+    EXPECT_EQ(190, array.findLast());
+    EXPECT_EQ(NO_INDEX, BitArray(10).findFirst());
+    EXPECT_EQ(NO_INDEX, BitArray(10).findLast());
+}
+
+TEST(BitArray, rank_select) {
+    // Setup
+    BitArray array = BitArray(200);
+    array.set(3).set(64).set(65).set(190);
+
+    // Assertion
+    EXPECT_EQ(0, array.rank(3));
+    EXPECT_EQ(1, array.rank(4));
+    EXPECT_EQ(2, array.rank(65));
+    EXPECT_EQ(4, array.rank(200));
+    EXPECT_ANY_THROW(array.rank(201));
+    EXPECT_EQ(3, array.select(0));
+    EXPECT_EQ(65, array.select(2));
+    EXPECT_EQ(190, array.select(3));
+    EXPECT_EQ(NO_INDEX, array.select(4));
+}
+
+TEST(BitArray, rank_index) {
+    // Setup
+    BitArray array = BitArray(5000);
+    for (size_t i = 0; i < 5000; i += (i % 7) + 1) {
+        array.set(i);
+    }
+    BitArray indexed = array;
+    indexed.buildRankIndex();
+
+    // Assertion
+    EXPECT_FALSE(array.hasRankIndex());
+    EXPECT_TRUE(indexed.hasRankIndex());
+    for (size_t i = 0; i <= 5000; ++i) {
+        ASSERT_EQ(array.rank(i), indexed.rank(i));
+    }
+    for (size_t n = 0; n <= array.count(); ++n) {
+        ASSERT_EQ(array.select(n), indexed.select(n));
+    }
+    EXPECT_EQ(NO_INDEX, BitArray(100).buildRankIndex().select(0));
+    EXPECT_EQ(0, BitArray().buildRankIndex().rank(0));
+}
+
+TEST(BitArray, rank_index_kept_on_change) {
+    // Setup
+    BitArray array = BitArray(1000);
+    array.set(10).set(900).buildRankIndex();
+    array.set(500).set(500).flip(10).reset(11);
+
+    // Assertion
+    EXPECT_TRUE(array.hasRankIndex());
+    EXPECT_EQ(0, array.rank(11));
+    EXPECT_EQ(2, array.rank(901));
+    EXPECT_EQ(900, array.select(1));
+    array.add(true);
+    EXPECT_TRUE(array.hasRankIndex());
+    EXPECT_EQ(1000, array.select(2));
+    EXPECT_TRUE(array.pop());
+    EXPECT_EQ(NO_INDEX, array.select(2));
+}
+
+TEST(BitArray, rank_index_matches_scan) {
+    // Setup, every kind of change on an indexed array checked against the same changes without one
+    BitArray indexed = BitArray();
+    BitArray plain = BitArray();
+    indexed.buildRankIndex();
+    uint64_t state = 12345;
+    auto next = [&state]() {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return size_t(state >> 33);
+    };
+
+    // Assertion
+    for (size_t step = 0; step < 3000; ++step) {
+        size_t operation = next() % 10;
+        if (operation < 3 || plain.size() == 0) {
+            bool value = next() % 2 == 0;
+            indexed.add(value);
+            plain.add(value);
+        }
+        else if (operation < 6) {
+            size_t index = next() % plain.size();
+            indexed.set(index);
+            plain.set(index);
+        }
+        else if (operation < 8) {
+            size_t index = next() % plain.size();
+            indexed.flip(index);
+            plain.flip(index);
+        }
+        else if (operation < 9) {
+            ASSERT_EQ(plain.pop(), indexed.pop());
+        }
+        else if (step % 500 == 0) {
+            size_t size = next() % 2000;
+            indexed.resize(size, true);
+            plain.resize(size, true);
+        }
+
+        ASSERT_TRUE(indexed.hasRankIndex());
+        size_t index = plain.size() == 0 ? 0 : next() % (plain.size() + 1);
+        ASSERT_EQ(plain.rank(index), indexed.rank(index));
+        size_t nth = next() % (plain.count() + 1);
+        ASSERT_EQ(plain.select(nth), indexed.select(nth));
+    }
+
+    indexed.flipAll();
+    plain.flipAll();
+    EXPECT_EQ(plain.rank(plain.size()), indexed.rank(indexed.size()));
+    EXPECT_EQ(plain.select(plain.count() / 2), indexed.select(indexed.count() / 2));
+}
+
+TEST(BitArray, for_each_set_bit) {
+    // Setup
+    BitArray array = BitArray(150);
+    array.set(1).set(63).set(64).set(149);
+    std::vector<size_t> indices;
+    array.forEachSetBit([&indices](size_t index) { indices.push_back(index); });
+    std::vector<size_t> expect = {1, 63, 64, 149};
+
+    // Assertion
+    EXPECT_EQ(expect, indices);
+}
@@ -0,0 +1,253 @@
+//
+// CacheDictionary_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "CacheDictionary.hpp"
+#include "gtest.h"
+
+#include <string>
+
+using namespace mrlib;
+
+// A clock that only moves when a test advances it
+struct CacheTestClock {
+    typedef std::chrono::milliseconds            duration;
+    typedef duration::rep                        rep;
+    typedef duration::period                     period;
+    typedef std::chrono::time_point<CacheTestClock>  time_point;
+    static const bool is_steady = true;
+
+    static duration current;
+    static time_point now() { return time_point(current); }
+};
+
+CacheTestClock::duration CacheTestClock::current = CacheTestClock::duration::zero();
+
+typedef CacheDictionary<int, int, std::hash<int>, std::equal_to<int>, CacheTestClock> TimedCache;
+
+
+//////////////////
+// Constructors //
+//////////////////
+
+TEST(CacheDictionary, constructor) {
+    // Setup
+    CacheDictionary<int, int> cache(10);
+
+    // Assertion
+    EXPECT_TRUE(cache.isEmpty());
+    EXPECT_EQ(10, cache.capacity());
+    EXPECT_EQ(0, cache.cost());
+    EXPECT_EQ(nullptr, cache.tryGet(1));
+    EXPECT_EQ("{}", cache.description());
+}
+
+
+/////////////
+// Lookups //
+/////////////
+
+TEST(CacheDictionary, lookups) {
+    // Setup
+    CacheDictionary<std::string, int> cache(10);
+    cache.insertOrAssign("a", 1).insertOrAssign("b", 2).insertOrAssign("a", 3);
+
+    // Assertion
+    EXPECT_EQ(2, cache.size());
+    EXPECT_EQ(3, cache.objectForKey("a"));
+    ASSERT_NE(nullptr, cache.tryGet("b"));
+    EXPECT_EQ(2, *cache.tryGet("b"));
+    EXPECT_TRUE(cache.containsKey("a"));
+    EXPECT_FALSE(cache.containsKey("c"));
+    EXPECT_ANY_THROW(cache.objectForKey("c"));
+    EXPECT_EQ(4, cache.getOrInsert("c", []() { return 4; }));
+    EXPECT_EQ(4, cache.getOrInsert("c", []() { return 5; }));
+    EXPECT_TRUE(cache.remove("a"));
+    EXPECT_FALSE(cache.remove("a"));
+    EXPECT_EQ(2, cache.size());
+    cache.removeAll();
+    EXPECT_TRUE(cache.isEmpty());
+    EXPECT_EQ(0, cache.cost());
+}
+
+
+//////////////
+// Policies //
+//////////////
+
+TEST(CacheDictionary, lru_eviction) {
+    // Setup
+    CacheDictionary<int, int> cache(3);
+    cache.insertOrAssign(1, 1).insertOrAssign(2, 2).insertOrAssign(3, 3);
+    cache.tryGet(1);
+    cache.insertOrAssign(4, 4);
+
+    // Assertion
+    EXPECT_EQ(3, cache.size());
+    EXPECT_FALSE(cache.containsKey(2));
+    EXPECT_EQ("{4 => 4, 1 => 1, 3 => 3}", cache.description());
+    EXPECT_EQ(1, cache.statistics().evictions);
+}
+
+TEST(CacheDictionary, segmented_lru_survives_scan) {
+    // Setup
+    CacheDictionary<int, int> cache(10, CachePolicy::SEGMENTED_LRU);
+    for (int i = 0; i < 5; ++i) {
+        cache.insertOrAssign(i, i);
+        cache.tryGet(i);
+    }
+
+    // Keys used once can only evict other keys used once
+    for (int i = 100; i < 200; ++i) {
+        cache.insertOrAssign(i, i);
+    }
+
+    // Assertion
+    EXPECT_EQ(10, cache.size());
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(cache.containsKey(i));
+    }
+    EXPECT_TRUE(cache.containsKey(199));
+    EXPECT_FALSE(cache.containsKey(100));
+}
+
+TEST(CacheDictionary, segmented_lru_demotes) {
+    // Setup
+    CacheDictionary<int, int> cache(10, CachePolicy::SEGMENTED_LRU);
+    for (int i = 0; i < 10; ++i) {
+        cache.insertOrAssign(i, i);
+        cache.tryGet(i);
+    }
+
+    // Assertion
+    EXPECT_EQ(8, cache._protected.size());
+    EXPECT_EQ(8, cache._protected_cost);
+    EXPECT_EQ(2, cache._probation.size());
+    EXPECT_EQ(1, cache._probation.front().key);
+    cache.insertOrAssign(10, 10);
+    EXPECT_FALSE(cache.containsKey(0));
+    EXPECT_TRUE(cache.containsKey(1));
+}
+
+TEST(CacheDictionary, tiny_lfu_admission) {
+    // Setup
+    CacheDictionary<int, int> cache(4, CachePolicy::TINY_LFU);
+    for (int round = 0; round < 5; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            cache.getOrInsert(i, [i]() { return i; });
+        }
+    }
+    cache.resetStatistics();
+
+    // A key seen once is not worth more than any cached key
+    cache.insertOrAssign(100, 100);
+
+    // Assertion
+    EXPECT_FALSE(cache.containsKey(100));
+    EXPECT_EQ(1, cache.statistics().rejections);
+    EXPECT_EQ(0, cache.statistics().evictions);
+
+    // Until it is asked for often enough
+    for (int i = 0; i < 10; ++i) {
+        cache.getOrInsert(100, []() { return 100; });
+    }
+    EXPECT_TRUE(cache.containsKey(100));
+    EXPECT_EQ(4, cache.size());
+}
+
+
+TEST(CacheDictionary, tiny_lfu_counts_miss_once) {
+    // Setup
+    CacheDictionary<int, int> cache(2, CachePolicy::TINY_LFU);
+    cache.getOrInsert(1, []() { return 1; });
+    cache.getOrInsert(2, []() { return 2; });
+
+    // Missed once, like the cached keys, so it is not worth more than them
+    cache.getOrInsert(3, []() { return 3; });
+
+    // Assertion
+    EXPECT_EQ(1, cache._sketch.estimate(std::hash<int>()(3)));
+    EXPECT_FALSE(cache.containsKey(3));
+    EXPECT_EQ(1, cache.statistics().rejections);
+}
+
+
+//////////
+// Cost //
+//////////
+
+TEST(CacheDictionary, cost_capacity) {
+    // Setup
+    CacheDictionary<int, std::string> cache(10);
+    cache.setCostFunction([](const int&, const std::string& value) { return value.size(); });
+    cache.insertOrAssign(1, "aaaa").insertOrAssign(2, "bbbb").insertOrAssign(3, "cc");
+
+    // Assertion
+    EXPECT_EQ(10, cache.cost());
+    cache.insertOrAssign(4, "d");
+    EXPECT_EQ(7, cache.cost());
+    EXPECT_FALSE(cache.containsKey(1));
+    cache.insertOrAssign(2, "bbbbbbbbb");
+    EXPECT_EQ(10, cache.cost());
+    EXPECT_FALSE(cache.containsKey(3));
+    EXPECT_EQ(2, cache.size());
+    cache.insertOrAssign(5, "eeeeeeeeeee");
+    EXPECT_FALSE(cache.containsKey(5));
+    EXPECT_EQ(1, cache.statistics().rejections);
+}
+
+
+////////////
+// Expiry //
+////////////
+
+TEST(CacheDictionary, time_to_live) {
+    // Setup
+    CacheTestClock::current = CacheTestClock::duration::zero();
+    TimedCache cache(10);
+    cache.setTimeToLive(std::chrono::milliseconds(100));
+    cache.insertOrAssign(1, 1);
+    cache.insertOrAssign(2, 2, std::chrono::milliseconds(500));
+    cache.insertOrAssign(3, 3, TimedCache::duration::zero());
+
+    // Assertion
+    CacheTestClock::current = std::chrono::milliseconds(99);
+    EXPECT_TRUE(cache.containsKey(1));
+    CacheTestClock::current = std::chrono::milliseconds(100);
+    EXPECT_FALSE(cache.containsKey(1));
+    EXPECT_EQ(nullptr, cache.tryGet(1));
+    EXPECT_EQ(1, cache.statistics().expirations);
+    EXPECT_EQ(2, cache.size());
+
+    CacheTestClock::current = std::chrono::hours(1);
+    EXPECT_EQ(1, cache.removeExpired());
+    EXPECT_TRUE(cache.containsKey(3));
+    EXPECT_EQ(1, cache.size());
+}
+
+
+////////////////
+// Statistics //
+////////////////
+
+TEST(CacheDictionary, statistics) {
+    // Setup
+    CacheDictionary<int, int> cache(2);
+    cache.insertOrAssign(1, 1).insertOrAssign(2, 2).insertOrAssign(3, 3);
+    cache.tryGet(1);
+    cache.tryGet(2);
+    cache.tryGet(3);
+    cache.tryGet(3);
+
+    // Assertion
+    EXPECT_EQ(3, cache.statistics().hits);
+    EXPECT_EQ(1, cache.statistics().misses);
+    EXPECT_EQ(1, cache.statistics().evictions);
+    EXPECT_DOUBLE_EQ(0.75, cache.statistics().hitRate());
+    cache.resetStatistics();
+    EXPECT_EQ(0, cache.statistics().hits);
+    EXPECT_DOUBLE_EQ(0.0, cache.statistics().hitRate());
+}
@@ -0,0 +1,170 @@
+//
+// ChunkedArray_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "ChunkedArray.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+//////////////////
+// CONSTRUCTORS //
+//////////////////
+
+TEST(ChunkedArray, default_constructor) {
+    // Setup
+    ChunkedArray<int> array = ChunkedArray<int>();
+
+    // Assertion
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_EQ(0, array.capacity());
+}
+
+TEST(ChunkedArray, initializer_list) {
+    // Setup
+    ChunkedArray<int, 4> array = {1, 2, 3, 4, 5};
+    std::vector<int> expect = {1, 2, 3, 4, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_EQ(2, array._data._chunks.size());
+}
+
+TEST(ChunkedArray, size_constructor) {
+    // Setup
+    ChunkedArray<int, 4> array = ChunkedArray<int, 4>(6);
+    std::vector<int> expect = {0, 0, 0, 0, 0, 0};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_EQ(8, array.capacity());
+}
+
+
+////////////
+// Growth //
+////////////
+
+TEST(ChunkedArray, stable_addresses) {
+    // Setup
+    ChunkedArray<int, 4> array = ChunkedArray<int, 4>();
+    array.add(0);
+    const int* first = &array[0];
+
+    for (int i = 1; i < 1000; ++i) {
+        array.add(i);
+    }
+
+    const int* middle = &array[500];
+    for (int i = 1000; i < 2000; ++i) {
+        array.add(i);
+    }
+
+    // Assertion
+    EXPECT_EQ(first, &array[0]);
+    EXPECT_EQ(middle, &array[500]);
+    EXPECT_EQ(0, *first);
+    EXPECT_EQ(500, *middle);
+    EXPECT_EQ(1999, array.lastObject());
+}
+
+TEST(ChunkedArray, chunk_boundaries) {
+    // Setup
+    ChunkedArray<int, 4> array = ChunkedArray<int, 4>();
+    for (int i = 0; i < 9; ++i) {
+        array.add(i);
+    }
+
+    // Assertion
+    EXPECT_EQ(12, array.capacity());
+    EXPECT_EQ(3, array[3]);
+    EXPECT_EQ(4, array[4]);
+    EXPECT_EQ(8, array[8]);
+    EXPECT_EQ(&array[4], array._data._chunks[1]);
+    EXPECT_ANY_THROW(array[9]);
+}
+
+TEST(ChunkedArray, reserve_shrink_to_fit) {
+    // Setup
+    ChunkedArray<int, 4> array = {1, 2, 3};
+    array.reserve(10);
+    size_t reserved = array.capacity();
+    array.shrinkToFit();
+
+    // Assertion
+    EXPECT_EQ(12, reserved);
+    EXPECT_EQ(4, array.capacity());
+    EXPECT_EQ("[1, 2, 3]", array.description());
+}
+
+
+///////////////
+// Array API //
+///////////////
+
+TEST(ChunkedArray, insert_remove_middle) {
+    // Setup
+    ChunkedArray<int, 4> array = {1, 2, 4, 5, 7};
+    array.insert(3, 2).insert(6, 5).insert(0, 0);
+    std::vector<int> expect1 = {0, 1, 2, 3, 4, 5, 6, 7};
+    std::vector<int> expect2 = {0, 3, 4, 5, 7};
+
+    // Assertion
+    EXPECT_EQ(expect1, array.std_vector());
+    array.removeRange(1, 3).removeIndex(4);
+    EXPECT_EQ(expect2, array.std_vector());
+}
+
+TEST(ChunkedArray, algorithms) {
+    // Setup
+    ChunkedArray<int, 4> array = {5, 1, 4, 1, 3, 2};
+    array.removeAll(1).sort().reverse().replace(4, 6);
+    std::vector<int> expect1 = {2, 3, 5, 6};
+    std::vector<int> expect2 = {5, 6, 3, 2};
+
+    // Assertion
+    EXPECT_EQ(expect2, array.std_vector());
+    EXPECT_EQ("[5, 6, 3, 2]", array.description());
+    EXPECT_EQ(expect1, array.copy().sort().std_vector());
+    EXPECT_EQ(2, array.indexOf(3));
+    EXPECT_TRUE(array.contains(6));
+}
+
+TEST(ChunkedArray, copy_move) {
+    // Setup
+    ChunkedArray<std::string, 2> array1 = {"a", "b", "c"};
+    ChunkedArray<std::string, 2> array2 = array1;
+    ChunkedArray<std::string, 2> array3 = std::move(array1);
+    array2.pop();
+
+    // Assertion
+    EXPECT_EQ(2, array2.size());
+    EXPECT_EQ(3, array3.size());
+    EXPECT_EQ("a", array3.firstObject());
+    EXPECT_EQ("c", array3.lastObject());
+    EXPECT_TRUE(array1.isEmpty());
+}
+
+TEST(ChunkedArray, equality) {
+    // Setup
+    ChunkedArray<int, 2> array1 = {1, 2, 3};
+    ChunkedArray<int, 2> array2 = {0, 2, 3};
+    array2[0] = 1;
+
+    // Assertion
+    EXPECT_TRUE(array1 == array2);
+    EXPECT_TRUE(array1.isEqualTo(array2));
+}
+
+TEST(ChunkedArray, self_add) {
+    // Setup
+    ChunkedArray<std::string, 2> array = {"a", "b"};
+    array.add(array[0]).add(array[3 - 1]);
+
+    // Assertion
+    EXPECT_EQ("[a, b, a, a]", array.description());
+}
@@ -0,0 +1,188 @@
+//
+// ConcurrentArray_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "ConcurrentArray.hpp"
+#include "gtest.h"
+
+#include <thread>
+#include <stdexcept>
+#include <vector>
+#include <algorithm>
+
+using namespace mrlib;
+
+
+// Throws when copied with a negative value
+struct ConcurrentThrowing {
+    int value;
+    ConcurrentThrowing(int value) : value(value) {}
+    ConcurrentThrowing(const ConcurrentThrowing& other) : value(other.value) {
+        if (other.value < 0) throw std::runtime_error("copy");
+    }
+};
+
+
+//////////////////
+// CONSTRUCTORS //
+//////////////////
+
+TEST(ConcurrentArray, default_constructor) {
+    // Setup
+    ConcurrentArray<int> array;
+
+    // Assertion
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_EQ(0, array.size());
+    EXPECT_EQ("[]", array.description());
+}
+
+TEST(ConcurrentArray, reserve) {
+    // Setup
+    ConcurrentArray<int> array(100);
+
+    // Assertion
+    EXPECT_NE(nullptr, array._segments[0].load());
+    EXPECT_NE(nullptr, array._segments[1].load());
+    EXPECT_NE(nullptr, array._segments[2].load());
+    EXPECT_EQ(nullptr, array._segments[3].load());
+    EXPECT_TRUE(array.isEmpty());
+}
+
+
+////////////////////
+// Adding Objects //
+////////////////////
+
+TEST(ConcurrentArray, add) {
+    // Setup
+    ConcurrentArray<int> array;
+    size_t first = array.add(1);
+    size_t second = array.add(2);
+
+    // Assertion
+    EXPECT_EQ(0, first);
+    EXPECT_EQ(1, second);
+    EXPECT_EQ(2, array.size());
+    EXPECT_EQ(1, array[0]);
+    EXPECT_EQ(2, array.objectAtIndex(1));
+    EXPECT_TRUE(array.isPublished(1));
+    EXPECT_FALSE(array.isPublished(2));
+    EXPECT_ANY_THROW(array[2]);
+}
+
+TEST(ConcurrentArray, segments_do_not_move) {
+    // Setup
+    ConcurrentArray<int> array;
+    array.add(0);
+    const int* first = &array[0];
+
+    for (int i = 1; i < 10000; ++i) {
+        array.add(i);
+    }
+
+    // Assertion
+    EXPECT_EQ(first, &array[0]);
+    EXPECT_EQ(9999, array[9999]);
+    EXPECT_EQ(31, array[31]);
+    EXPECT_EQ(32, array[32]);
+}
+
+TEST(ConcurrentArray, non_trivial_type) {
+    // Setup
+    ConcurrentArray<std::string> array;
+    std::string moved = "moved";
+    array.add("copied");
+    array.add(std::move(moved));
+
+    // Assertion
+    EXPECT_EQ("[copied, moved]", array.description());
+}
+
+TEST(ConcurrentArray, throwing_add_is_abandoned) {
+    // Setup
+    ConcurrentArray<ConcurrentThrowing> array;
+    array.add(ConcurrentThrowing(1));
+    EXPECT_THROW(array.add(ConcurrentThrowing(-1)), std::runtime_error);
+    size_t index = array.add(ConcurrentThrowing(3));
+    int sum = 0;
+    array.forEach([&sum](const ConcurrentThrowing& object) { sum += object.value; });
+
+    // Assertion
+    EXPECT_EQ(2, index);
+    EXPECT_EQ(2, array.size());
+    EXPECT_EQ(1, array.abandonedCount());
+    EXPECT_TRUE(array.isAbandoned(1));
+    EXPECT_FALSE(array.isPublished(1));
+    EXPECT_FALSE(array.isAbandoned(2));
+    EXPECT_THROW(array[1], std::invalid_argument);
+    EXPECT_EQ(3, array[2].value);
+    EXPECT_EQ(4, sum);
+    EXPECT_EQ(2, array.snapshot().size());
+}
+
+
+//////////////////////
+// Multiple Threads //
+//////////////////////
+
+TEST(ConcurrentArray, concurrent_add) {
+    // Setup
+    const int thread_count = 8;
+    const int per_thread = 20000;
+    ConcurrentArray<int> array;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < thread_count; ++t) {
+        threads.push_back(std::thread([&array, t, per_thread]() {
+            for (int i = 0; i < per_thread; ++i) {
+                array.add(t * per_thread + i);
+            }
+        }));
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int> values = array.snapshot().std_vector();
+    std::sort(values.begin(), values.end());
+
+    // Assertion
+    ASSERT_EQ(thread_count * per_thread, values.size());
+    for (int i = 0; i < thread_count * per_thread; ++i) {
+        ASSERT_EQ(i, values[i]);
+    }
+}
+
+TEST(ConcurrentArray, concurrent_read) {
+    // Setup
+    ConcurrentArray<long> array;
+    std::atomic<bool> done(false);
+    std::atomic<bool> valid(true);
+
+    std::thread reader([&array, &done, &valid]() {
+        while (!done.load()) {
+            size_t size = array.size();
+            for (size_t i = 0; i < size; ++i) {
+                if (array.isPublished(i) && array[i] != long(i) * 3) {
+                    valid.store(false);
+                }
+            }
+        }
+    });
+
+    for (long i = 0; i < 50000; ++i) {
+        array.add(i * 3);
+    }
+
+    done.store(true);
+    reader.join();
+
+    // Assertion
+    EXPECT_TRUE(valid.load());
+    EXPECT_EQ(50000, array.snapshot().size());
+}
@@ -0,0 +1,241 @@
+//
+// ConcurrentDictionary_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "ConcurrentDictionary.hpp"
+#include "gtest.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+
+using namespace mrlib;
+
+
+//////////////////
+// Constructors //
+//////////////////
+
+TEST(ConcurrentDictionary, default_constructor) {
+    // Setup
+    ConcurrentDictionary<int, int> dictionary;
+
+    // Assertion
+    EXPECT_TRUE(dictionary.isEmpty());
+    EXPECT_EQ(CONCURRENT_DICTIONARY_SHARDS, dictionary._shard_count);
+    EXPECT_EQ("{}", dictionary.description());
+}
+
+TEST(ConcurrentDictionary, shard_count) {
+    // Setup
+    ConcurrentDictionary<int, int> dictionary1(5);
+    ConcurrentDictionary<int, int> dictionary2(1);
+
+    // Assertion
+    EXPECT_EQ(8, dictionary1._shard_count);
+    EXPECT_EQ(1, dictionary2._shard_count);
+}
+
+
+////////////////////
+// Key Operations //
+////////////////////
+
+TEST(ConcurrentDictionary, add_and_query) {
+    // Setup
+    ConcurrentDictionary<std::string, int> dictionary;
+    dictionary.addObject("a", 1).insertOrAssign("b", 2).insertOrAssign("a", 3);
+    int value = 0;
+
+    // Assertion
+    EXPECT_EQ(2, dictionary.size());
+    EXPECT_EQ(3, dictionary.objectForKey("a"));
+    EXPECT_TRUE(dictionary.tryGet("b", value));
+    EXPECT_EQ(2, value);
+    EXPECT_FALSE(dictionary.tryGet("c", value));
+    EXPECT_TRUE(dictionary.containsKey("a"));
+    EXPECT_ANY_THROW(dictionary.objectForKey("c"));
+    EXPECT_ANY_THROW(dictionary.addObject("a", 4));
+}
+
+TEST(ConcurrentDictionary, get_or_insert) {
+    // Setup
+    ConcurrentDictionary<int, int> dictionary;
+    int calls = 0;
+    int first = dictionary.getOrInsert(1, [&calls]() { ++calls; return 10; });
+    int second = dictionary.getOrInsert(1, [&calls]() { ++calls; return 20; });
+
+    // Assertion
+    EXPECT_EQ(10, first);
+    EXPECT_EQ(10, second);
+    EXPECT_EQ(1, calls);
+}
+
+TEST(ConcurrentDictionary, upsert) {
+    // Setup
+    ConcurrentDictionary<int, int> dictionary;
+    dictionary.upsert(1, [](int& value) { value += 5; }).upsert(1, [](int& value) { value *= 2; });
+
+    // Assertion
+    EXPECT_EQ(10, dictionary.objectForKey(1));
+}
+
+TEST(ConcurrentDictionary, compute) {
+    // Setup
+    ConcurrentDictionary<int, int> dictionary;
+    auto decrement = [](int& value, bool exists) {
+        value = exists ? value - 1 : 2;
+        return value > 0;
+    };
+
+    bool kept1 = dictionary.compute(1, decrement);
+    bool kept2 = dictionary.compute(1, decrement);
+    bool kept3 = dictionary.compute(1, decrement);
+
+    // Assertion
+    EXPECT_TRUE(kept1);
+    EXPECT_TRUE(kept2);
+    EXPECT_FALSE(kept3);
+    EXPECT_FALSE(dictionary.containsKey(1));
+}
+
+TEST(ConcurrentDictionary, throwing_function_adds_nothing) {
+    // Setup
+    ConcurrentDictionary<int, int> dictionary;
+    dictionary.insertOrAssign(1, 5);
+    auto throwing_upsert = [](int& value) { value += 1; throw std::runtime_error("upsert"); };
+    auto throwing_compute = [](int& value, bool) -> bool { value += 1; throw std::runtime_error("compute"); };
+
+    // Assertion
+    EXPECT_THROW(dictionary.upsert(2, throwing_upsert), std::runtime_error);
+    EXPECT_THROW(dictionary.compute(3, throwing_compute), std::runtime_error);
+    EXPECT_THROW(dictionary.compute(1, throwing_compute), std::runtime_error);
+    EXPECT_FALSE(dictionary.containsKey(2));
+    EXPECT_FALSE(dictionary.containsKey(3));
+    EXPECT_TRUE(dictionary.containsKey(1));
+    EXPECT_EQ(1, dictionary.size());
+}
+
+TEST(ConcurrentDictionary, remove) {
+    // Setup
+    ConcurrentDictionary<int, int> dictionary;
+    for (int i = 0; i < 100; ++i) {
+        dictionary.insertOrAssign(i, i);
+    }
+
+    bool removed = dictionary.remove(5);
+    bool missing = dictionary.remove(5);
+
+    // Assertion
+    EXPECT_TRUE(removed);
+    EXPECT_FALSE(missing);
+    EXPECT_EQ(99, dictionary.size());
+    dictionary.removeAll();
+    EXPECT_TRUE(dictionary.isEmpty());
+}
+
+
+////////////////
+// Containers //
+////////////////
+
+TEST(ConcurrentDictionary, snapshot_and_for_each) {
+    // Setup
+    ConcurrentDictionary<int, int> dictionary;
+    for (int i = 0; i < 100; ++i) {
+        dictionary.insertOrAssign(i, i * 2);
+    }
+
+    HashDictionary<int, int> snapshot = dictionary.snapshot();
+    int sum = 0;
+    dictionary.forEach([&sum](int, int value) { sum += value; });
+
+    // Assertion
+    EXPECT_EQ(100, snapshot.size());
+    EXPECT_EQ(198, snapshot[99]);
+    EXPECT_EQ(9900, sum);
+}
+
+
+/////////////////
+// Concurrency //
+/////////////////
+
+TEST(ConcurrentDictionary, concurrent_upsert) {
+    // Setup
+    ConcurrentDictionary<int, int> dictionary;
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 8; ++t) {
+        threads.push_back(std::thread([&dictionary]() {
+            for (int i = 0; i < 10000; ++i) {
+                dictionary.upsert(i % 100, [](int& value) { ++value; });
+            }
+        }));
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Assertion
+    EXPECT_EQ(100, dictionary.size());
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(800, dictionary.objectForKey(i));
+    }
+}
+
+TEST(ConcurrentDictionary, concurrent_get_or_insert) {
+    // Setup
+    ConcurrentDictionary<int, int> dictionary;
+    std::atomic<int> calls(0);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 8; ++t) {
+        threads.push_back(std::thread([&dictionary, &calls, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                dictionary.getOrInsert(i, [&calls, t]() { ++calls; return t; });
+            }
+        }));
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // Assertion
+    EXPECT_EQ(1000, calls.load());
+    EXPECT_EQ(1000, dictionary.size());
+}
+
+TEST(ConcurrentDictionary, consistent_snapshot) {
+    // Setup
+    ConcurrentDictionary<int, int> dictionary;
+    dictionary.insertOrAssign(0, 0).insertOrAssign(1, 0);
+    std::atomic<bool> done(false);
+
+    // Between the two upserts the sum is one, a snapshot taken shard by shard could also see minus one
+    std::thread writer([&dictionary, &done]() {
+        for (int i = 0; i < 2000; ++i) {
+            dictionary.upsert(0, [](int& value) { ++value; });
+            dictionary.upsert(1, [](int& value) { --value; });
+        }
+        done = true;
+    });
+
+    bool consistent = true;
+    while (!done) {
+        HashDictionary<int, int> snapshot = dictionary.snapshot();
+        int sum = snapshot[0] + snapshot[1];
+        consistent = consistent && (sum == 0 || sum == 1);
+    }
+    writer.join();
+
+    // Assertion
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(2000, dictionary.objectForKey(0));
+}
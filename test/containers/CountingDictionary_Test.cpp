@@ -0,0 +1,165 @@
+//
+// CountingDictionary_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "CountingDictionary.hpp"
+#include "gtest.h"
+
+#include <thread>
+
+using namespace mrlib;
+
+
+///////////////////
+// Counting Keys //
+///////////////////
+
+TEST(CountingDictionary, increment) {
+    // Setup
+    CountingDictionary<std::string> counter = CountingDictionary<std::string>();
+    counter.increment("a");
+    counter.increment("a", 4);
+    size_t count = counter.increment("b", 2);
+    counter.increment("c", 0);
+
+    // Assertion
+    EXPECT_EQ(2, count);
+    EXPECT_EQ(5, counter.countForKey("a"));
+    EXPECT_EQ(2, counter.countForKey("b"));
+    EXPECT_EQ(0, counter.countForKey("c"));
+    EXPECT_FALSE(counter.containsKey("c"));
+    EXPECT_EQ(2, counter.size());
+    EXPECT_EQ(7, counter.total());
+}
+
+TEST(CountingDictionary, decrement) {
+    // Setup
+    CountingDictionary<std::string> counter = {"a", "a", "a", "b"};
+
+    // Assertion
+    EXPECT_EQ(2, counter.decrement("a"));
+    EXPECT_EQ(0, counter.decrement("b", 5));
+    EXPECT_EQ(0, counter.decrement("missing"));
+    EXPECT_FALSE(counter.containsKey("b"));
+    EXPECT_EQ(2, counter.total());
+
+    counter.remove("a");
+    EXPECT_TRUE(counter.isEmpty());
+    EXPECT_EQ(0, counter.total());
+}
+
+TEST(CountingDictionary, increment_all) {
+    // Setup
+    std::vector<int> values = {1, 2, 2, 3, 3, 3};
+    CountingDictionary<int> counter = CountingDictionary<int>();
+    counter.incrementAll(values.begin(), values.end());
+
+    // Assertion
+    EXPECT_EQ(3, counter.size());
+    EXPECT_EQ(6, counter.total());
+    EXPECT_EQ(3, counter.countForKey(3));
+    EXPECT_EQ("{3 => 3}", CountingDictionary<int>({3, 3, 3}).description());
+}
+
+
+//////////////
+// Top Keys //
+//////////////
+
+TEST(CountingDictionary, most_common) {
+    // Setup
+    CountingDictionary<int> counter = CountingDictionary<int>();
+    for (int i = 0; i < 1000; ++i) {
+        counter.increment(i, size_t(i % 100));
+    }
+
+    std::vector<std::pair<int, size_t>> top = counter.mostCommon(3);
+
+    // Assertion
+    ASSERT_EQ(3, top.size());
+    EXPECT_EQ(99, top[0].second);
+    EXPECT_EQ(99, top[1].second);
+    EXPECT_EQ(99, top[2].second);
+    EXPECT_EQ(99, top[0].first % 100);
+    EXPECT_TRUE(counter.mostCommon(0).empty());
+    EXPECT_EQ(990, counter.mostCommon(2000).size());
+}
+
+TEST(CountingDictionary, heavy_hitters) {
+    // Setup
+    CountingDictionary<std::string> counter = CountingDictionary<std::string>();
+    counter.increment("common", 50);
+    counter.increment("frequent", 30);
+    counter.increment("rare", 5);
+    for (int i = 0; i < 15; ++i) {
+        counter.increment("key" + std::to_string(i));
+    }
+
+    std::vector<std::pair<std::string, size_t>> hitters = counter.heavyHitters(0.2);
+
+    // Assertion
+    ASSERT_EQ(2, hitters.size());
+    EXPECT_EQ("common", hitters[0].first);
+    EXPECT_EQ(50, hitters[0].second);
+    EXPECT_EQ("frequent", hitters[1].first);
+    EXPECT_TRUE(counter.heavyHitters(0.5).empty());
+}
+
+
+///////////
+// Merge //
+///////////
+
+TEST(CountingDictionary, merge) {
+    // Setup
+    CountingDictionary<std::string> counter1 = {"a", "b", "b"};
+    CountingDictionary<std::string> counter2 = {"b", "c"};
+    counter1 += counter2;
+
+    CountingDictionary<std::string> counter3 = {"x", "x"};
+    counter3.merge(counter3);
+
+    // Assertion
+    EXPECT_EQ(3, counter1.size());
+    EXPECT_EQ(5, counter1.total());
+    EXPECT_EQ(3, counter1.countForKey("b"));
+    EXPECT_EQ(1, counter1.countForKey("c"));
+    EXPECT_EQ(4, counter3.countForKey("x"));
+    EXPECT_EQ(4, counter3.total());
+}
+
+TEST(CountingDictionary, merge_per_thread) {
+    // Setup
+    std::vector<CountingDictionary<int>> counters = std::vector<CountingDictionary<int>>(4);
+    std::vector<std::thread> threads = std::vector<std::thread>();
+    for (size_t t = 0; t < counters.size(); ++t) {
+        threads.push_back(std::thread([&counters, t]() {
+            for (int i = 0; i < 50000; ++i) {
+                counters[t].increment((i * 7 + int(t)) % 20000);
+            }
+        }));
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    CountingDictionary<int> total = CountingDictionary<int>();
+    for (const CountingDictionary<int>& counter : counters) {
+        total.merge(counter);
+    }
+
+    size_t sum = 0;
+    for (const auto& pair : total) {
+        sum += pair.second;
+    }
+
+    // Assertion
+    EXPECT_EQ(200000, total.total());
+    EXPECT_EQ(200000, sum);
+    EXPECT_EQ(20000, total.size());
+    EXPECT_EQ(total, total.copy());
+}
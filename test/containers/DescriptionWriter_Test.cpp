@@ -0,0 +1,259 @@
+//
+// DescriptionWriter_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "DescriptionWriter.hpp"
+#include "Array.hpp"
+#include "gtest.h"
+
+#include <chrono>
+#include <climits>
+#include <clocale>
+#include <csignal>
+#include <map>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <pthread.h>
+
+using namespace mrlib;
+
+
+// Installed without SA_RESTART, so a blocked write returns EINTR
+static void DescriptionInterrupt(int) {
+}
+
+
+////////////
+// Values //
+////////////
+
+TEST(DescriptionWriter, integers) {
+    // Setup
+    DescriptionWriter writer;
+    writer.value(0).write(' ').value(-42).write(' ').value(123456789u).write(' ');
+    writer.value(LLONG_MIN).write(' ').value(ULLONG_MAX);
+
+    // Assertion
+    EXPECT_EQ("0 -42 123456789 -9223372036854775808 18446744073709551615", writer.str());
+}
+
+TEST(DescriptionWriter, characters_and_bools) {
+    // Setup
+    DescriptionWriter writer;
+    writer.value('a').value(true).value(false);
+
+    // Assertion
+    EXPECT_EQ("a10", writer.str());
+}
+
+TEST(DescriptionWriter, floating_point) {
+    // Setup
+    std::vector<double> values = {0.0, 1.5, -2.25, 1.0 / 3.0, 1e20, 123456789.0};
+    DescriptionWriter writer;
+    std::ostringstream oss;
+
+    for (double value : values) {
+        writer.value(value).write(' ');
+        oss << value << ' ';
+    }
+
+    // Assertion
+    EXPECT_EQ(oss.str(), writer.str());
+}
+
+TEST(DescriptionWriter, floating_point_any_locale) {
+    // Setup
+    const char* locales[] = {"de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8", "C"};
+    std::string previous = std::setlocale(LC_NUMERIC, nullptr);
+    for (const char* locale : locales) {
+        if (std::setlocale(LC_NUMERIC, locale) != nullptr) break;
+    }
+
+    DescriptionWriter writer;
+    writer.value(1.5).write(' ').value(-2.25e-10).write(' ').value(1e300 * 1e300);
+    std::setlocale(LC_NUMERIC, previous.c_str());
+
+    // Assertion
+    EXPECT_EQ("1.5 -2.25e-10 inf", writer.str());
+}
+
+TEST(DescriptionWriter, strings_and_fallback) {
+    // Setup
+    DescriptionWriter writer;
+    writer.value(std::string("abc")).value("def").value(std::pair<int, int>(1, 2).first);
+
+    // Assertion
+    EXPECT_EQ("abcdef1", writer.str());
+}
+
+TEST(DescriptionWriter, address) {
+    // Setup
+    int object = 0;
+    DescriptionWriter writer;
+    writer.address(&object);
+    std::ostringstream oss;
+    oss << static_cast<const void*>(&object);
+
+    // Assertion
+    EXPECT_EQ(oss.str(), writer.str());
+}
+
+
+////////////////
+// Containers //
+////////////////
+
+TEST(DescriptionWriter, sequence) {
+    // Setup
+    std::vector<int> values = {1, 2, 3};
+    DescriptionWriter writer;
+    writer.sequence(values.begin(), values.size()).sequence(values.begin(), 0);
+
+    // Assertion
+    EXPECT_EQ("[1, 2, 3][]", writer.str());
+}
+
+TEST(DescriptionWriter, sequence_truncated) {
+    // Setup
+    std::vector<int> values = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    DescriptionWriter writer1;
+    DescriptionWriter writer2;
+    DescriptionWriter writer3;
+    DescriptionWriter writer4;
+    writer1.truncate(2, 2).sequence(values.begin(), values.size());
+    writer2.truncate(0, 1).sequence(values.begin(), values.size());
+    writer3.truncate(1, 0).sequence(values.begin(), values.size());
+    writer4.truncate(5, 5).sequence(values.begin(), values.size());
+
+    // Assertion
+    EXPECT_EQ("[0, 1, ..., 8, 9]", writer1.str());
+    EXPECT_EQ("[..., 9]", writer2.str());
+    EXPECT_EQ("[0, ...]", writer3.str());
+    EXPECT_EQ("[0, 1, 2, 3, 4, 5, 6, 7, 8, 9]", writer4.str());
+}
+
+TEST(DescriptionWriter, mapping_truncated) {
+    // Setup
+    std::map<int, char> values = {{1, 'a'}, {2, 'b'}, {3, 'c'}, {4, 'd'}};
+    DescriptionWriter writer1;
+    DescriptionWriter writer2;
+    writer1.mapping(values.begin(), values.size());
+    writer2.truncate(1, 1).mapping(values.begin(), values.size());
+
+    // Assertion
+    EXPECT_EQ("{1 => a, 2 => b, 3 => c, 4 => d}", writer1.str());
+    EXPECT_EQ("{1 => a, ..., 4 => d}", writer2.str());
+}
+
+
+////////////
+// Output //
+////////////
+
+TEST(DescriptionWriter, reuse_buffer) {
+    // Setup
+    DescriptionWriter writer;
+    writer.value(12345);
+    size_t capacity = writer._buffer.capacity();
+    writer.clear().value(1);
+
+    // Assertion
+    EXPECT_EQ("1", writer.str());
+    EXPECT_EQ(capacity, writer._buffer.capacity());
+}
+
+TEST(DescriptionWriter, describe_reuses_buffer) {
+    // Setup
+    Array<int> array1 = {1, 2, 3};
+    Array<int> array2 = {4, 5};
+    DescriptionWriter writer;
+    writer.describe(array1);
+    const char* data = writer._buffer.data();
+    std::string description = writer.describe(array2);
+
+    // Assertion
+    EXPECT_EQ("[1, 2, 3]", writer.describe(array1));
+    EXPECT_EQ("[4, 5]", description);
+    EXPECT_EQ(data, writer._buffer.data());
+    EXPECT_EQ(array1.description(), writer.describe(array1));
+}
+
+TEST(DescriptionWriter, file_descriptor) {
+    // Setup
+    int fds[2];
+    ASSERT_EQ(0, ::pipe(fds));
+    std::vector<int> values = std::vector<int>(100, 7);
+
+    {
+        DescriptionWriter writer(fds[1], 16);
+        writer.sequence(values.begin(), values.size());
+        EXPECT_LE(writer.size(), 16);
+    }
+
+    ::close(fds[1]);
+    std::string output;
+    char buffer[256];
+    ssize_t length;
+    while ((length = ::read(fds[0], buffer, sizeof(buffer))) > 0) {
+        output.append(buffer, length);
+    }
+
+    ::close(fds[0]);
+
+    // Assertion
+    EXPECT_EQ(2 + 100 + 99 * 2, output.size());
+    EXPECT_EQ("[7, 7", output.substr(0, 5));
+    EXPECT_EQ("7, 7]", output.substr(output.size() - 5));
+}
+
+TEST(DescriptionWriter, file_descriptor_interrupted) {
+    // Setup, fill the pipe so the flush blocks until the signal interrupts it
+    int fds[2];
+    ASSERT_EQ(0, ::pipe(fds));
+    ::fcntl(fds[1], F_SETFL, O_NONBLOCK);
+    char byte = 'x';
+    while (::write(fds[1], &byte, 1) == 1) {
+    }
+    ::fcntl(fds[1], F_SETFL, 0);
+
+    struct sigaction action = {};
+    struct sigaction previous = {};
+    action.sa_handler = DescriptionInterrupt;
+    ::sigaction(SIGUSR1, &action, &previous);
+
+    pthread_t writing = ::pthread_self();
+    std::string output;
+    std::thread reader([&fds, &output, writing]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ::pthread_kill(writing, SIGUSR1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        char buffer[4096];
+        ssize_t length;
+        while ((length = ::read(fds[0], buffer, sizeof(buffer))) > 0) {
+            output.append(buffer, length);
+        }
+    });
+
+    bool thrown = false;
+    try {
+        DescriptionWriter writer(fds[1]);
+        writer.write("interrupted").flush();
+    }
+    catch (...) {
+        thrown = true;
+    }
+
+    ::close(fds[1]);
+    reader.join();
+    ::close(fds[0]);
+    ::sigaction(SIGUSR1, &previous, nullptr);
+
+    // Assertion
+    EXPECT_FALSE(thrown);
+    EXPECT_EQ("interrupted", output.substr(output.size() - 11));
+}
@@ -0,0 +1,210 @@
+//
+// DictionaryFile_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "DictionaryFile.hpp"
+#include "HashDictionary.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+static const std::string DictionaryFilePath = "/tmp/mrlib_dictionary_file_test.bin";
+
+
+///////////
+// Files //
+///////////
+
+TEST(DictionaryFile, write_map_string) {
+    // Setup
+    Dictionary<String, String> dictionary = {{String("one"), String("1")}, {String("two"), String("2")}, {String("empty"), String("")}};
+    DictionaryFile::write(DictionaryFilePath, dictionary);
+    MappedDictionary<String, String> mapped = DictionaryFile::map<String, String>(DictionaryFilePath);
+    ::unlink(DictionaryFilePath.c_str());
+
+    String value;
+    ArraySlice<char> bytes;
+
+    // Assertion
+    EXPECT_EQ(3, mapped.size());
+    EXPECT_TRUE(mapped.tryGet(String("two"), value));
+    EXPECT_EQ("2", value._data);
+    EXPECT_EQ("1", mapped.objectForKey(String("one"))._data);
+    EXPECT_TRUE(mapped.tryGetBytes(String("empty"), bytes));
+    EXPECT_TRUE(bytes.isEmpty());
+    EXPECT_FALSE(mapped.containsKey(String("three")));
+    EXPECT_FALSE(mapped.tryGetBytes(String("three"), bytes));
+    EXPECT_ANY_THROW(mapped.objectForKey(String("three")));
+}
+
+TEST(DictionaryFile, bytes_point_into_file) {
+    // Setup
+    Dictionary<std::string, std::string> dictionary = {{"key", "value"}};
+    DictionaryFile::write(DictionaryFilePath, dictionary);
+    MappedDictionary<std::string, std::string> mapped = DictionaryFile::map<std::string, std::string>(DictionaryFilePath);
+    ::unlink(DictionaryFilePath.c_str());
+
+    ArraySlice<char> bytes;
+    mapped.tryGetBytes("key", bytes);
+
+    // Assertion
+    EXPECT_EQ("value", std::string(bytes.begin(), bytes.end()));
+    EXPECT_GE(bytes.begin(), mapped._mapping.data());
+    EXPECT_LE(bytes.end(), mapped._mapping.data() + mapped._mapping.size());
+}
+
+TEST(DictionaryFile, entries_sorted) {
+    // Setup
+    HashDictionary<std::string, int> dictionary = HashDictionary<std::string, int>();
+    dictionary["pear"] = 3;
+    dictionary["apple"] = 1;
+    dictionary["banana"] = 2;
+
+    DictionaryFile::write(DictionaryFilePath, dictionary);
+    MappedDictionary<std::string, int> mapped = DictionaryFile::map<std::string, int>(DictionaryFilePath);
+    ::unlink(DictionaryFilePath.c_str());
+
+    // Assertion
+    EXPECT_EQ(std::vector<std::string>({"apple", "banana", "pear"}), mapped.getKeys());
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), mapped.getValues());
+}
+
+TEST(DictionaryFile, write_read_many) {
+    // Setup
+    Dictionary<int, double> dictionary = Dictionary<int, double>();
+    for (int i = 0; i < 10000; ++i) {
+        dictionary[i * 7] = i * 0.5;
+    }
+
+    DictionaryFile::write(DictionaryFilePath, dictionary);
+    MappedDictionary<int, double> mapped = DictionaryFile::map<int, double>(DictionaryFilePath);
+    Dictionary<int, double> result = DictionaryFile::read<int, double>(DictionaryFilePath);
+    ::unlink(DictionaryFilePath.c_str());
+
+    size_t found = 0;
+    for (int i = 0; i < 70000; ++i) {
+        found += mapped.containsKey(i) ? 1 : 0;
+    }
+
+    // Assertion
+    EXPECT_EQ(10000, mapped.size());
+    EXPECT_EQ(10000, found);
+    EXPECT_EQ(4999.5, mapped.objectForKey(69993));
+    EXPECT_EQ(dictionary, result);
+    EXPECT_EQ(dictionary, mapped.copy());
+}
+
+TEST(DictionaryFile, write_matches_serialize) {
+    // Setup, more entries than the write buffer holds, and some larger than it
+    Dictionary<std::string, std::string> dictionary = Dictionary<std::string, std::string>();
+    for (int i = 0; i < 5000; ++i) {
+        dictionary["key" + std::to_string(i)] = i % 3 == 0 ? "" : std::to_string(i);
+    }
+
+    dictionary["large1"] = std::string(DICTIONARY_FILE_WRITE_BUFFER, 'a');
+    dictionary["large2"] = std::string(3 * DICTIONARY_FILE_WRITE_BUFFER, 'b');
+
+    DictionaryFile::write(DictionaryFilePath, dictionary);
+    ArrayFileMapping mapping = ArrayFileMapping(DictionaryFilePath);
+    ::unlink(DictionaryFilePath.c_str());
+
+    // Assertion
+    EXPECT_EQ(DictionaryFile::serialize(dictionary), std::string(mapping.data(), mapping.size()));
+}
+
+TEST(DictionaryFile, write_over_mapped_file) {
+    // Setup
+    DictionaryFile::write(DictionaryFilePath, Dictionary<int, int>({{1, 10}, {2, 20}}));
+    MappedDictionary<int, int> before = DictionaryFile::map<int, int>(DictionaryFilePath);
+    DictionaryFile::write(DictionaryFilePath, Dictionary<int, int>({{3, 30}}));
+    MappedDictionary<int, int> after = DictionaryFile::map<int, int>(DictionaryFilePath);
+    ::unlink(DictionaryFilePath.c_str());
+
+    // Assertion, the old mapping still sees the file it mapped
+    EXPECT_EQ(2, before.size());
+    EXPECT_EQ(20, before.objectForKey(2));
+    EXPECT_EQ(1, after.size());
+    EXPECT_EQ(30, after.objectForKey(3));
+}
+
+TEST(DictionaryFile, keys_in_dictionary_order) {
+    // Setup
+    Dictionary<int, int> dictionary = {{256, 1}, {-1, 2}, {1, 3}};
+    DictionaryFile::write(DictionaryFilePath, dictionary);
+    MappedDictionary<int, int> mapped = DictionaryFile::map<int, int>(DictionaryFilePath);
+
+    // Assertion
+    EXPECT_EQ(std::vector<int>({-1, 1, 256}), mapped.getKeys());
+    EXPECT_EQ(std::vector<int>({2, 3, 1}), mapped.getValues());
+    EXPECT_EQ(dictionary, mapped.copy());
+    ::unlink(DictionaryFilePath.c_str());
+}
+
+TEST(DictionaryFile, write_empty) {
+    // Setup
+    DictionaryFile::write(DictionaryFilePath, Dictionary<std::string, int>());
+    MappedDictionary<std::string, int> mapped = DictionaryFile::map<std::string, int>(DictionaryFilePath);
+    ::unlink(DictionaryFilePath.c_str());
+
+    // Assertion
+    EXPECT_TRUE(mapped.isEmpty());
+    EXPECT_FALSE(mapped.containsKey("key"));
+    EXPECT_TRUE(mapped.copy().isEmpty());
+}
+
+TEST(DictionaryFile, map_move) {
+    // Setup
+    DictionaryFile::write(DictionaryFilePath, Dictionary<int, int>({{1, 10}, {2, 20}}));
+    MappedDictionary<int, int> mapped1 = DictionaryFile::map<int, int>(DictionaryFilePath);
+    MappedDictionary<int, int> mapped2 = std::move(mapped1);
+    ::unlink(DictionaryFilePath.c_str());
+
+    // Assertion
+    EXPECT_EQ(20, mapped2.objectForKey(2));
+    EXPECT_EQ(nullptr, mapped1._mapping.data());
+}
+
+TEST(DictionaryFile, invalid_file) {
+    // Setup
+    std::string bytes = DictionaryFile::serialize(Dictionary<int, int>({{1, 10}}));
+    int fd = ::open(DictionaryFilePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ::write(fd, bytes.data(), sizeof(DictionaryFileHeader) - 1);
+    ::close(fd);
+
+    // Assertion
+    EXPECT_ANY_THROW((DictionaryFile::map<int, int>(DictionaryFilePath)));
+    ::unlink(DictionaryFilePath.c_str());
+
+    ArrayFile::write(DictionaryFilePath, Array<int>({1, 2, 3}));
+    EXPECT_ANY_THROW((DictionaryFile::map<int, int>(DictionaryFilePath)));
+    ::unlink(DictionaryFilePath.c_str());
+
+    DictionaryFile::write(DictionaryFilePath, Dictionary<int, int>({{1, 10}}));
+    EXPECT_ANY_THROW((DictionaryFile::map<int, long long>(DictionaryFilePath).objectForKey(1)));
+    EXPECT_ANY_THROW((DictionaryFile::map<int, int>("/tmp/mrlib_dictionary_file_missing.bin")));
+    ::unlink(DictionaryFilePath.c_str());
+}
+
+TEST(DictionaryFile, full_index) {
+    // Setup
+    std::string bytes = DictionaryFile::serialize(Dictionary<int, int>({{1, 10}}));
+    DictionaryFileHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    for (size_t i = 0; i < header.slot_count; ++i) {
+        DictionaryFileSlot slot = {0, 1};
+        std::memcpy(&bytes[sizeof(header) + i * sizeof(slot)], &slot, sizeof(slot));
+    }
+
+    int fd = ::open(DictionaryFilePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ::write(fd, bytes.data(), bytes.size());
+    ::close(fd);
+    MappedDictionary<int, int> mapped = DictionaryFile::map<int, int>(DictionaryFilePath);
+
+    // Assertion
+    EXPECT_FALSE(mapped.containsKey(2));
+    ::unlink(DictionaryFilePath.c_str());
+}
@@ -10,6 +10,35 @@
 
 using namespace mrlib;
 
+// Allocator that counts how often the tree allocates a node
+static size_t NodeAllocations = 0;
+
+template <typename T>
+struct NodeCountingAllocator {
+    typedef T value_type;
+
+    NodeCountingAllocator() {}
+    template <typename U>
+    NodeCountingAllocator(const NodeCountingAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        ++NodeAllocations;
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t) {
+        ::operator delete(pointer);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const NodeCountingAllocator<T>&, const NodeCountingAllocator<U>&) { return true; }
+
+template <typename T, typename U>
+bool operator!=(const NodeCountingAllocator<T>&, const NodeCountingAllocator<U>&) { return false; }
+
+typedef Dictionary<int, int, std::map<int, int, std::less<int>, NodeCountingAllocator<std::pair<const int, int>>>> CountedDictionary;
+
 
 //////////////////
 // Constructors //
@@ -84,6 +113,20 @@ TEST(Dictionary, dictionary_constructr) {
     EXPECT_EQ(int(), dictionary2.getDefaultValue());
 }
 
+TEST(Dictionary, move_constructor) {
+    // Setup
+    Dictionary<std::string, int> dictionary1 = Dictionary<std::string, int>(5);
+    dictionary1["a"] += 1;
+    Dictionary<std::string, int> dictionary2 = Dictionary<std::string, int>(std::move(dictionary1));
+    std::map<std::string, int> expect = {{"a", 6}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary2._data);
+    EXPECT_TRUE(dictionary2.hasDefaultValue());
+    EXPECT_EQ(5, dictionary2["b"]);
+    EXPECT_TRUE(dictionary1.isEmpty());
+}
+
 
 //////////////////////////
 // Operator Overloading //
@@ -211,6 +254,38 @@ TEST(Dictionary, operator_self_assignment) {
     EXPECT_EQ(expect, dictionary._data);
 }
 
+TEST(Dictionary, operator_move_assign) {
+    // Setup
+    Dictionary<std::string, int> dictionary1 = {{"a", 1}, {"b", 2}};
+    Dictionary<std::string, int> dictionary2 = {{"c", 3}};
+    dictionary2 = std::move(dictionary1);
+    std::map<std::string, int> expect = {{"a", 1}, {"b", 2}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary2._data);
+    EXPECT_TRUE(dictionary1.isEmpty());
+}
+
+TEST(Dictionary, operator_assign_default_value) {
+    // Setup
+    Dictionary<char, int> dictionary1 = Dictionary<char, int>(5);
+    Dictionary<char, int> dictionary2 = Dictionary<char, int>(5);
+    Dictionary<char, int> copied = Dictionary<char, int>();
+    Dictionary<char, int> moved = Dictionary<char, int>();
+    copied = dictionary1;
+    moved = std::move(dictionary2);
+    Dictionary<char, int> cleared = Dictionary<char, int>(7);
+    cleared = Dictionary<char, int>();
+
+    // Assertion
+    EXPECT_TRUE(copied.hasDefaultValue());
+    EXPECT_EQ(5, copied['a']);
+    EXPECT_TRUE(moved.hasDefaultValue());
+    EXPECT_EQ(5, moved['a']);
+    EXPECT_FALSE(cleared.hasDefaultValue());
+    EXPECT_EQ(0, cleared['a']);
+}
+
 // Operator+
 
 TEST(Dictionary, operator_plus_dictionary) {
@@ -257,6 +332,32 @@ TEST(Dictionary, operator_plus_equal_dictionary) {
     EXPECT_EQ(expect2, dictionary2._data);
 }
 
+TEST(Dictionary, operator_plus_equal_move) {
+    // Setup
+    Dictionary<std::string, std::string> dictionary1 = {{"a", "1"}, {"b", "2"}};
+    Dictionary<std::string, std::string> dictionary2 = {{"b", "3"}, {"c", "4"}};
+    Dictionary<std::string, std::string> dictionary3 = Dictionary<std::string, std::string>();
+    dictionary1 += std::move(dictionary2);
+    dictionary3 += std::move(dictionary1);
+    std::map<std::string, std::string> expect = {{"a", "1"}, {"b", "3"}, {"c", "4"}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary3._data);
+    EXPECT_TRUE(dictionary1.isEmpty());
+}
+
+TEST(Dictionary, operator_plus_move) {
+    // Setup
+    Dictionary<char, int> dictionary1 = {{'a', 1}, {'b', 2}};
+    Dictionary<char, int> dictionary2 = {{'b', 3}};
+    Dictionary<char, int> dictionary3 = dictionary1 + std::move(dictionary2);
+    std::map<char, int> expect = {{'a', 1}, {'b', 3}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary3._data);
+    EXPECT_EQ(2, dictionary1['b']);
+}
+
 // Operator==
 
 TEST(Dictionary, operator_equality) {
@@ -299,6 +400,31 @@ TEST(Dictionary, operator_inequality_self) {
 }
 
 
+///////////////
+// Iteration //
+///////////////
+
+TEST(Dictionary, iterate_by_reference) {
+    // Setup
+    Dictionary<char, int> dictionary = {{'a', 1}, {'b', 2}};
+    for (auto& entry : dictionary) {
+        entry.second *= 10;
+    }
+
+    std::string keys;
+    const Dictionary<char, int>& reference = dictionary;
+    for (const auto& entry : reference) {
+        keys += entry.first;
+    }
+
+    std::map<char, int> expect = {{'a', 10}, {'b', 20}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary._data);
+    EXPECT_EQ("ab", keys);
+}
+
+
 /////////////////////////
 // Querying Dictionary //
 /////////////////////////
@@ -322,6 +448,38 @@ TEST(Dictionary, object_for_key_invalid) {
     EXPECT_ANY_THROW(dictionary.objectForKey('c'));
 }
 
+TEST(Dictionary, object_for_key_converted) {
+    // Setup
+    Dictionary<std::string, int> dictionary = {{"a", 1}, {"b", 2}};
+
+    // Assertion
+    EXPECT_EQ(2, dictionary.objectForKey("b"));
+    EXPECT_TRUE(dictionary.containsKey("a"));
+    EXPECT_EQ(nullptr, dictionary.tryGet("c"));
+}
+
+// TryGet
+
+TEST(Dictionary, try_get_valid) {
+    // Setup
+    Dictionary<char, int> dictionary = {{'a', 1}, {'b', 2}};
+    *dictionary.tryGet('b') = 3;
+    const Dictionary<char, int>& reference = dictionary;
+
+    // Assertion
+    ASSERT_NE(nullptr, reference.tryGet('b'));
+    EXPECT_EQ(3, *reference.tryGet('b'));
+}
+
+TEST(Dictionary, try_get_invalid) {
+    // Setup
+    Dictionary<char, int> dictionary = Dictionary<char, int>(10);
+
+    // Assertion
+    EXPECT_EQ(nullptr, dictionary.tryGet('a'));
+    EXPECT_TRUE(dictionary.isEmpty());
+}
+
 // ContainsKey
 
 TEST(Dictionary, contains_key_true) {
@@ -481,6 +639,93 @@ TEST(Dictionary, add_object_invalid) {
     EXPECT_ANY_THROW(dictionary.addObject('b', 3));
 }
 
+// GetOrInsert
+
+TEST(Dictionary, get_or_insert_new) {
+    // Setup
+    Dictionary<char, int> dictionary = {{'a', 1}};
+    int& value = dictionary.getOrInsert('b', []() { return 2; });
+    value += 1;
+    std::map<char, int> expect = {{'a', 1}, {'b', 3}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary._data);
+}
+
+TEST(Dictionary, get_or_insert_existing) {
+    // Setup
+    Dictionary<char, int> dictionary = {{'a', 1}};
+    int calls = 0;
+    int value = dictionary.getOrInsert('a', [&calls]() { ++calls; return 2; });
+
+    // Assertion
+    EXPECT_EQ(1, value);
+    EXPECT_EQ(0, calls);
+}
+
+// InsertOrAssign
+
+TEST(Dictionary, insert_or_assign) {
+    // Setup
+    Dictionary<char, int> dictionary = {{'a', 1}};
+    dictionary.insertOrAssign('a', 5).insertOrAssign('b', 2);
+    std::map<char, int> expect = {{'a', 5}, {'b', 2}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary._data);
+}
+
+// Upsert
+
+TEST(Dictionary, upsert) {
+    // Setup
+    Dictionary<std::string, int> dictionary = Dictionary<std::string, int>();
+    for (std::string word : {"a", "b", "a", "c", "a"}) {
+        dictionary.upsert(word, [](int& count) { ++count; });
+    }
+    std::map<std::string, int> expect = {{"a", 3}, {"b", 1}, {"c", 1}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary._data);
+}
+
+TEST(Dictionary, upsert_with_default) {
+    // Setup
+    Dictionary<char, int> dictionary = Dictionary<char, int>(10);
+    dictionary.upsert('a', [](int& value) { value *= 2; }).upsert('a', [](int& value) { value += 1; });
+
+    // Assertion
+    EXPECT_EQ(21, dictionary['a']);
+}
+
+// Existing Keys
+
+TEST(Dictionary, hits_do_not_allocate) {
+    // Setup
+    CountedDictionary dictionary = CountedDictionary(7);
+    for (int i = 0; i < 100; ++i) {
+        dictionary[i] = i;
+    }
+
+    size_t before = NodeAllocations;
+    for (int i = 0; i < 100; ++i) {
+        dictionary[i] += 1;
+        dictionary.getOrInsert(i, []() { return 0; });
+        dictionary.upsert(i, [](int& value) { value += 1; });
+        dictionary.insertOrAssign(i, dictionary[i] + 1);
+    }
+    size_t hits = NodeAllocations - before;
+    dictionary[100] += 1;
+    size_t misses = NodeAllocations - before;
+
+    // Assertion
+    EXPECT_EQ(0, hits);
+    EXPECT_EQ(1, misses);
+    EXPECT_EQ(3, dictionary[0]);
+    EXPECT_EQ(8, dictionary[100]);
+    EXPECT_ANY_THROW(dictionary.addObject(5, 0));
+}
+
 
 //////////////////////
 // Removing Objects //
@@ -589,6 +834,100 @@ TEST(Dictionary, swap_objects_invalid) {
 }
 
 
+//////////////////////
+// Batch Operations //
+//////////////////////
+
+// AddAll
+
+TEST(Dictionary, add_all) {
+    // Setup
+    Dictionary<char, int> dictionary = {{'b', 1}, {'d', 2}};
+    std::vector<std::pair<char, int>> batch = {{'e', 3}, {'a', 4}, {'d', 5}, {'c', 6}, {'a', 7}};
+    dictionary.addAll(batch).addAll({{'f', 8}});
+    std::map<char, int> expect = {{'a', 7}, {'b', 1}, {'c', 6}, {'d', 5}, {'e', 3}, {'f', 8}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary._data);
+}
+
+TEST(Dictionary, add_all_large) {
+    // Setup
+    Dictionary<int, int> dictionary = Dictionary<int, int>();
+    std::vector<std::pair<int, int>> batch = std::vector<std::pair<int, int>>();
+    for (int i = 0; i < 1000; ++i) {
+        dictionary[i * 10] = 0;
+        batch.push_back(std::make_pair((i * 7919) % 10000, i));
+    }
+    dictionary.addAll(batch.begin(), batch.end());
+
+    // Assertion
+    EXPECT_EQ(1900, dictionary.size());
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(i, dictionary.objectForKey((i * 7919) % 10000));
+    }
+}
+
+// GetMany
+
+TEST(Dictionary, get_many) {
+    // Setup
+    Dictionary<char, int> dictionary = {{'a', 1}, {'b', 2}, {'c', 3}};
+    const Dictionary<char, int>& constant = dictionary;
+    std::vector<int*> values = dictionary.getMany({'c', 'z', 'a', 'c'});
+    std::vector<const int*> const_values = constant.getMany({});
+
+    // Assertion
+    ASSERT_EQ(4, values.size());
+    EXPECT_EQ(3, *values[0]);
+    EXPECT_EQ(nullptr, values[1]);
+    EXPECT_EQ(1, *values[2]);
+    EXPECT_EQ(values[0], values[3]);
+    EXPECT_TRUE(const_values.empty());
+}
+
+// RemoveMany
+
+TEST(Dictionary, remove_many) {
+    // Setup
+    Dictionary<int, int> dictionary = Dictionary<int, int>();
+    std::vector<int> keys = std::vector<int>();
+    for (int i = 0; i < 100; ++i) {
+        dictionary[i] = i;
+        keys.push_back(99 - i * 3);
+    }
+    dictionary.removeMany(keys);
+
+    // Assertion
+    EXPECT_EQ(66, dictionary.size());
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i % 3 != 0, dictionary.containsKey(i));
+    }
+}
+
+// Merge
+
+TEST(Dictionary, merge_sorted) {
+    // Setup
+    Dictionary<int, int> dictionary1 = Dictionary<int, int>();
+    Dictionary<int, int> dictionary2 = Dictionary<int, int>();
+    for (int i = 0; i < 100; ++i) {
+        dictionary1[i * 2] = 1;
+        dictionary2[i * 3] = 2;
+    }
+    Dictionary<int, int> sum = dictionary1 + dictionary2;
+
+    // Assertion
+    EXPECT_EQ(166, sum.size());
+    EXPECT_EQ(2, sum[0]);
+    EXPECT_EQ(1, sum[2]);
+    EXPECT_EQ(2, sum[3]);
+    EXPECT_EQ(2, sum[6]);
+    EXPECT_EQ(1, sum[196]);
+    EXPECT_EQ(2, sum[297]);
+}
+
+
 ///////////////////////
 // Comparing Objects //
 ///////////////////////
@@ -678,6 +1017,16 @@ TEST(Dictionary, description_empty) {
     EXPECT_EQ(expect, desc);
 }
 
+TEST(Dictionary, description_truncated) {
+    // Setup
+    Dictionary<char, int> dictionary = {{'a', 1}, {'b', 2}, {'c', 3}, {'d', 4}};
+    std::string desc = dictionary.description(1, 2);
+    std::string expect = "{a => 1, ..., c => 3, d => 4}";
+
+    // Assertion
+    EXPECT_EQ(expect, desc);
+}
+
 // Inspect
 
 TEST(Dictionary, inspect) {
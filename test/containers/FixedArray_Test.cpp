@@ -0,0 +1,80 @@
+//
+// FixedArray_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "FixedArray.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+TEST(FixedArray, default_constructor) {
+    // Setup
+    FixedArray<int, 4> array = FixedArray<int, 4>();
+
+    // Assertion
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_EQ(4, array._data.capacity());
+}
+
+TEST(FixedArray, no_heap_storage) {
+    // Setup
+    FixedArray<int, 4> array = {1, 2, 3, 4};
+    const char* begin = reinterpret_cast<const char*>(&array);
+    const char* data = reinterpret_cast<const char*>(array._data.data());
+
+    // Assertion
+    EXPECT_TRUE(data >= begin && data < begin + sizeof(array));
+}
+
+TEST(FixedArray, capacity_exceeded) {
+    // Setup
+    FixedArray<int, 3> array = {1, 2, 3};
+    std::vector<int> expect = {1, 2, 3};
+
+    // Assertion
+    EXPECT_ANY_THROW(array.add(4));
+    EXPECT_ANY_THROW(array.addFirst(0));
+    EXPECT_ANY_THROW((FixedArray<int, 2>{1, 2, 3}));
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+TEST(FixedArray, capacity_exceeded_range) {
+    // Setup
+    FixedArray<int, 4> array = {1, 2, 3};
+    std::vector<int> more = {7, 8, 9};
+    std::vector<int> expect = {1, 2, 3};
+
+    // Assertion
+    EXPECT_ANY_THROW(array.insertAll(more.begin(), more.end(), 1));
+    EXPECT_ANY_THROW(array.addAll(more.begin(), more.end()));
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_TRUE(array._data.isInline());
+}
+
+TEST(FixedArray, reuse_after_remove) {
+    // Setup
+    FixedArray<int, 3> array = {1, 2, 3};
+    array.popFirst();
+    array.add(4);
+    std::vector<int> expect = {2, 3, 4};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+TEST(FixedArray, array_api) {
+    // Setup
+    FixedArray<int, 8> array = {4, 2, 3};
+    array.insert(1, 0).sort();
+    FixedArray<int, 8> evens = array.filter([](int n) { return n % 2 == 0; });
+
+    // Assertion
+    EXPECT_EQ("[1, 2, 3, 4]", array.description());
+    EXPECT_EQ("[2, 4]", evens.description());
+    EXPECT_TRUE(array.contains(3));
+    EXPECT_EQ(10, array.reduce(0, [](int a, int b) { return a + b; }));
+}
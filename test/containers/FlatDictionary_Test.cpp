@@ -0,0 +1,247 @@
+//
+// FlatDictionary_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "FlatDictionary.hpp"
+#include "gtest.h"
+
+#include <string>
+
+using namespace mrlib;
+
+
+//////////////////
+// Constructors //
+//////////////////
+
+TEST(FlatDictionary, default_constructor) {
+    // Setup
+    FlatDictionary<char, int> dictionary = FlatDictionary<char, int>();
+
+    // Assertion
+    EXPECT_TRUE(dictionary.isEmpty());
+    EXPECT_FALSE(dictionary.containsKey('a'));
+    EXPECT_EQ(nullptr, dictionary.tryGet('a'));
+    EXPECT_EQ("{}", dictionary.description());
+}
+
+TEST(FlatDictionary, initializer_list_constructor) {
+    // Setup
+    FlatDictionary<char, int> dictionary = {{'c', 3}, {'a', 1}, {'b', 2}, {'a', 4}};
+    std::map<char, int> expect = {{'c', 3}, {'a', 1}, {'b', 2}, {'a', 4}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary.std_map());
+    EXPECT_EQ("{a => 1, b => 2, c => 3}", dictionary.description());
+}
+
+TEST(FlatDictionary, map_constructor) {
+    // Setup
+    std::map<char, int> map = {{'a', 1}, {'b', 2}};
+    std::unordered_map<char, int> unordered_map = {{'b', 2}, {'a', 1}};
+    FlatDictionary<char, int> dictionary1 = FlatDictionary<char, int>(map);
+    FlatDictionary<char, int> dictionary2 = FlatDictionary<char, int>(unordered_map);
+
+    // Assertion
+    EXPECT_EQ(map, dictionary1.std_map());
+    EXPECT_EQ(unordered_map, dictionary2.std_unordered_map());
+    EXPECT_TRUE(dictionary1 == dictionary2);
+    std::vector<char> keys = {'a', 'b'};
+    EXPECT_EQ(keys, dictionary1._data._keys);
+    EXPECT_EQ(keys, dictionary2._data._keys);
+}
+
+
+/////////////////
+// Sorted Data //
+/////////////////
+
+TEST(FlatDictionary, bulk_construction) {
+    // Setup
+    std::unordered_map<int, int> map = std::unordered_map<int, int>();
+    for (int i = 0; i < 10000; ++i) {
+        map[(i * 7919) % 10007] = i;
+    }
+    FlatDictionary<int, int> dictionary = FlatDictionary<int, int>(map);
+
+    // Assertion
+    EXPECT_EQ(10000, dictionary.size());
+    EXPECT_TRUE(std::is_sorted(dictionary._data._keys.begin(), dictionary._data._keys.end()));
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(i, dictionary.objectForKey((i * 7919) % 10007));
+    }
+}
+
+TEST(FlatDictionary, lookup) {
+    // Setup
+    FlatDictionary<int, int> dictionary = FlatDictionary<int, int>();
+    for (int i = 0; i < 100; ++i) {
+        dictionary[i * 2] = i;
+    }
+
+    // Every size of search, between, before and after the keys
+    for (int i = -1; i <= 200; ++i) {
+        ASSERT_EQ(i >= 0 && i < 200 && i % 2 == 0, dictionary.containsKey(i));
+    }
+
+    // Assertion
+    EXPECT_EQ(0, dictionary._data.lower_bound(-5)->first);
+    EXPECT_EQ(12, dictionary._data.lower_bound(11)->first);
+    EXPECT_TRUE(dictionary._data.lower_bound(199) == dictionary._data.end());
+}
+
+TEST(FlatDictionary, insert_and_remove) {
+    // Setup
+    FlatDictionary<std::string, int> dictionary = FlatDictionary<std::string, int>();
+    dictionary["m"] = 1;
+    dictionary["z"] = 2;
+    dictionary["a"] = 3;
+    dictionary["q"] = 4;
+    dictionary.remove("z").remove("b");
+
+    // Assertion
+    EXPECT_EQ(3, dictionary.size());
+    EXPECT_EQ("{a => 3, m => 1, q => 4}", dictionary.description());
+    EXPECT_EQ(dictionary._data._keys.size(), dictionary._data._values.size());
+    dictionary.removeAll();
+    EXPECT_TRUE(dictionary.isEmpty());
+}
+
+TEST(FlatDictionary, iteration) {
+    // Setup
+    FlatDictionary<char, int> dictionary = {{'b', 2}, {'a', 1}, {'c', 3}};
+    for (auto&& entry : dictionary) {
+        entry.second *= 10;
+    }
+
+    std::string keys;
+    int sum = 0;
+    for (const auto& entry : dictionary) {
+        keys += entry.first;
+        sum += entry.second;
+    }
+
+    // Assertion
+    EXPECT_EQ("abc", keys);
+    EXPECT_EQ(60, sum);
+    EXPECT_EQ(3, std::distance(dictionary.begin(), dictionary.end()));
+    EXPECT_EQ('c', (dictionary.begin() + 2)->first);
+}
+
+
+//////////////////////
+// Batch Operations //
+//////////////////////
+
+TEST(FlatDictionary, add_all_merges) {
+    // Setup
+    FlatDictionary<int, int> dictionary = FlatDictionary<int, int>();
+    for (int i = 0; i < 100; ++i) {
+        dictionary[i * 2] = 0;
+    }
+    std::vector<std::pair<int, int>> batch = std::vector<std::pair<int, int>>();
+    for (int i = 99; i >= 0; --i) {
+        batch.push_back(std::make_pair(i * 3, 1));
+    }
+    batch.push_back(std::make_pair(0, 2));
+    dictionary.addAll(batch);
+
+    // Assertion
+    EXPECT_EQ(166, dictionary.size());
+    EXPECT_TRUE(std::is_sorted(dictionary._data._keys.begin(), dictionary._data._keys.end()));
+    EXPECT_EQ(2, dictionary[0]);
+    EXPECT_EQ(0, dictionary[2]);
+    EXPECT_EQ(1, dictionary[6]);
+    EXPECT_EQ(1, dictionary[297]);
+}
+
+TEST(FlatDictionary, get_and_remove_many) {
+    // Setup
+    FlatDictionary<std::string, int> dictionary = {{"a", 1}, {"b", 2}, {"c", 3}, {"d", 4}};
+    std::vector<int*> values = dictionary.getMany({"d", "x", "a", "b"});
+
+    // Assertion
+    ASSERT_EQ(4, values.size());
+    EXPECT_EQ(4, *values[0]);
+    EXPECT_EQ(nullptr, values[1]);
+    EXPECT_EQ(1, *values[2]);
+    EXPECT_EQ(2, *values[3]);
+    dictionary.removeMany({"d", "b", "x", "b"});
+    EXPECT_EQ("{a => 1, c => 3}", dictionary.description());
+    EXPECT_EQ(2, dictionary._data._values.size());
+}
+
+
+////////////////////
+// Dictionary API //
+////////////////////
+
+TEST(FlatDictionary, dictionary_api) {
+    // Setup
+    FlatDictionary<char, int> dictionary = {{'a', 1}, {'b', 2}, {'c', 3}};
+    dictionary.addObject('d', 4).replace('a', 5).swap('b', 'c').remove('d');
+
+    // Assertion
+    EXPECT_EQ(5, dictionary['a']);
+    EXPECT_EQ(3, dictionary['b']);
+    EXPECT_EQ(2, dictionary['c']);
+    EXPECT_FALSE(dictionary.containsKey('d'));
+    EXPECT_ANY_THROW(dictionary.addObject('a', 1));
+    EXPECT_ANY_THROW(dictionary.objectForKey('z'));
+}
+
+TEST(FlatDictionary, single_lookup_api) {
+    // Setup
+    FlatDictionary<std::string, int> dictionary = {{"a", 1}};
+    dictionary.insertOrAssign("a", 2).insertOrAssign("b", 3);
+    dictionary.upsert("c", [](int& value) { value = 4; });
+    dictionary.getOrInsert("d", []() { return 5; });
+
+    // Assertion
+    ASSERT_NE(nullptr, dictionary.tryGet("a"));
+    EXPECT_EQ(2, *dictionary.tryGet("a"));
+    EXPECT_EQ(3, dictionary.objectForKey("b"));
+    EXPECT_EQ(4, dictionary.objectForKey("c"));
+    EXPECT_EQ(5, dictionary.getOrInsert("d", []() { return 6; }));
+    EXPECT_EQ(nullptr, dictionary.tryGet("e"));
+}
+
+TEST(FlatDictionary, insert_value_from_same_dictionary) {
+    // Setup, every new key sorts first, so adding it shifts the object being copied
+    FlatDictionary<int, std::string> dictionary = FlatDictionary<int, std::string>();
+    for (int i = 10; i < 20; ++i) {
+        dictionary[i] = "value" + std::to_string(i);
+    }
+
+    dictionary.insertOrAssign(1, dictionary[15]);
+    dictionary.addObject(0, dictionary[16]);
+    dictionary.getOrInsert(-1, [&dictionary]() -> const std::string& { return dictionary[17]; });
+
+    // Assertion
+    EXPECT_EQ("value15", dictionary[1]);
+    EXPECT_EQ("value16", dictionary[0]);
+    EXPECT_EQ("value17", dictionary[-1]);
+    EXPECT_EQ(13, dictionary.size());
+}
+
+TEST(FlatDictionary, operators) {
+    // Setup
+    FlatDictionary<char, int> dictionary1 = {{'a', 1}, {'b', 2}};
+    FlatDictionary<char, int> dictionary2 = {{'b', 3}, {'c', 4}};
+    FlatDictionary<char, int> sum = dictionary1 + dictionary2;
+    FlatDictionary<char, int> moved = dictionary1.copy();
+    moved += dictionary2.copy();
+    dictionary1 += dictionary2;
+    std::map<char, int> expect = {{'a', 1}, {'b', 3}, {'c', 4}};
+
+    // Assertion
+    EXPECT_EQ(expect, sum.std_map());
+    EXPECT_TRUE(sum == dictionary1);
+    EXPECT_TRUE(sum == moved);
+    EXPECT_TRUE(sum != dictionary2);
+    EXPECT_EQ(std::vector<char>({'a', 'b', 'c'}), sum.getKeys());
+    EXPECT_EQ(std::vector<int>({1, 3, 4}), sum.getValues());
+}
@@ -0,0 +1,137 @@
+//
+// FrozenDictionary_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "FrozenDictionary.hpp"
+#include "gtest.h"
+
+#include <string>
+
+using namespace mrlib;
+
+// Gives two different keys the same hash
+struct FrozenCollidingHash {
+    size_t operator()(int key) const { return key == 2 ? 1 : size_t(key); }
+};
+
+
+//////////////////
+// Constructors //
+//////////////////
+
+TEST(FrozenDictionary, default_constructor) {
+    // Setup
+    FrozenDictionary<int, int> dictionary = FrozenDictionary<int, int>();
+
+    // Assertion
+    EXPECT_TRUE(dictionary.isEmpty());
+    EXPECT_FALSE(dictionary.containsKey(1));
+    EXPECT_EQ(nullptr, dictionary.tryGet(1));
+    EXPECT_EQ("{}", dictionary.description());
+}
+
+TEST(FrozenDictionary, initializer_list_constructor) {
+    // Setup
+    FrozenDictionary<std::string, int> dictionary = {{"a", 1}, {"b", 2}, {"a", 3}};
+    std::map<std::string, int> expect = {{"a", 1}, {"b", 2}};
+
+    // Assertion
+    EXPECT_EQ(2, dictionary.size());
+    EXPECT_EQ(expect, dictionary.std_map());
+    EXPECT_EQ(1, dictionary.objectForKey("a"));
+    EXPECT_ANY_THROW(dictionary.objectForKey("c"));
+}
+
+TEST(FrozenDictionary, dictionary_constructor) {
+    // Setup
+    Dictionary<int, std::string> source = {{1, "one"}, {2, "two"}, {3, "three"}};
+    HashDictionary<int, std::string> hash_source = {{1, "one"}, {2, "two"}, {3, "three"}};
+    FrozenDictionary<int, std::string> dictionary1 = FrozenDictionary<int, std::string>(source);
+    FrozenDictionary<int, std::string> dictionary2 = FrozenDictionary<int, std::string>(hash_source);
+
+    // Assertion
+    EXPECT_EQ(source.std_map(), dictionary1.std_map());
+    EXPECT_EQ(source.std_map(), dictionary2.std_map());
+    std::vector<int> keys = dictionary1.getKeys();
+    std::sort(keys.begin(), keys.end());
+    EXPECT_EQ(source.getKeys(), keys);
+    EXPECT_EQ(3, dictionary1.getValues().size());
+}
+
+
+//////////////////
+// Perfect Hash //
+//////////////////
+
+TEST(FrozenDictionary, every_key_in_one_slot) {
+    // Setup
+    Dictionary<int, int> source = Dictionary<int, int>();
+    for (int i = 0; i < 20000; ++i) {
+        source[i * 3] = i;
+    }
+    FrozenDictionary<int, int> dictionary = FrozenDictionary<int, int>(source);
+
+    // Assertion
+    EXPECT_EQ(20000, dictionary._entries.size());
+    EXPECT_EQ(20000 / FROZEN_DICTIONARY_BUCKET_SIZE + 1, dictionary._seeds.size());
+    for (int i = 0; i < 20000; ++i) {
+        ASSERT_EQ(i, dictionary.objectForKey(i * 3));
+        ASSERT_FALSE(dictionary.containsKey(i * 3 + 1));
+    }
+}
+
+TEST(FrozenDictionary, large_key_set) {
+    // Setup
+    HashDictionary<int, int> source = HashDictionary<int, int>();
+    for (int i = 0; i < 200000; ++i) {
+        source[i * 7 + 3] = i;
+    }
+    FrozenDictionary<int, int> dictionary = FrozenDictionary<int, int>(source);
+
+    // Assertion
+    EXPECT_EQ(200000, dictionary.size());
+    EXPECT_EQ(200000 / FROZEN_DICTIONARY_SPARE_SLOTS + 1, dictionary._moved.size());
+    for (int i = 0; i < 200000; ++i) {
+        ASSERT_EQ(i, dictionary.objectForKey(i * 7 + 3));
+    }
+    EXPECT_FALSE(dictionary.containsKey(0));
+    EXPECT_FALSE(dictionary.containsKey(200000 * 7 + 3));
+}
+
+TEST(FrozenDictionary, string_keys) {
+    // Setup
+    Dictionary<std::string, size_t> source = Dictionary<std::string, size_t>();
+    for (size_t i = 0; i < 1000; ++i) {
+        source["/route/" + std::to_string(i)] = i;
+    }
+    FrozenDictionary<std::string, size_t> dictionary = FrozenDictionary<std::string, size_t>(source);
+
+    // Assertion
+    for (size_t i = 0; i < 1000; ++i) {
+        const size_t* value = dictionary.tryGet("/route/" + std::to_string(i));
+        ASSERT_NE(nullptr, value);
+        ASSERT_EQ(i, *value);
+    }
+    EXPECT_FALSE(dictionary.containsKey("/route/1000"));
+    EXPECT_FALSE(dictionary.containsKey(""));
+}
+
+TEST(FrozenDictionary, single_key) {
+    // Setup
+    FrozenDictionary<char, int> dictionary = {{'a', 1}};
+
+    // Assertion
+    EXPECT_EQ(1, dictionary.objectForKey('a'));
+    EXPECT_FALSE(dictionary.containsKey('b'));
+    EXPECT_EQ("{a => 1}", dictionary.description());
+}
+
+TEST(FrozenDictionary, hash_collision) {
+    // Assertion
+    typedef FrozenDictionary<int, int, FrozenCollidingHash> CollidingDictionary;
+    EXPECT_THROW(CollidingDictionary({{1, 1}, {2, 2}}), std::invalid_argument);
+    EXPECT_NO_THROW(CollidingDictionary({{1, 1}, {3, 3}}));
+}
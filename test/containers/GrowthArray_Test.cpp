@@ -0,0 +1,173 @@
+//
+// GrowthArray_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "GrowthArray.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+// Allocator that counts how often GrowthVector goes to the heap
+static size_t TrackedAllocations = 0;
+
+template <typename T>
+struct TrackingAllocator {
+    typedef T value_type;
+
+    TrackingAllocator() {}
+    template <typename U>
+    TrackingAllocator(const TrackingAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        ++TrackedAllocations;
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t) {
+        ::operator delete(pointer);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const TrackingAllocator<T>&, const TrackingAllocator<U>&) { return true; }
+
+template <typename T, typename U>
+bool operator!=(const TrackingAllocator<T>&, const TrackingAllocator<U>&) { return false; }
+
+
+/////////////////////
+// Growth Policies //
+/////////////////////
+
+TEST(GrowthArray, geometric_growth) {
+    // Assertion
+    EXPECT_EQ(4, GeometricGrowth<>::capacity(0, 1, 4));
+    EXPECT_EQ(16, GeometricGrowth<>::capacity(8, 9, 4));
+    EXPECT_EQ(12, (GeometricGrowth<3, 2>::capacity(8, 9, 4)));
+    EXPECT_EQ(100, (GeometricGrowth<3, 2>::capacity(8, 100, 4)));
+}
+
+TEST(GrowthArray, page_growth) {
+    // Setup
+    typedef PageGrowth<GeometricGrowth<3, 2>, 4096> Growth;
+
+    // Assertion
+    EXPECT_EQ(12, Growth::capacity(8, 9, 8));
+    EXPECT_EQ(1024, Growth::capacity(400, 401, 8));
+    EXPECT_EQ(1536, Growth::capacity(1000, 1001, 8));
+}
+
+
+////////////////
+// Capacities //
+////////////////
+
+TEST(GrowthArray, add_uses_policy) {
+    // Setup
+    GrowthArray<int, GeometricGrowth<3, 2>> array = GrowthArray<int, GeometricGrowth<3, 2>>();
+    std::vector<size_t> capacities;
+
+    for (int i = 0; i < 20; ++i) {
+        array.add(i);
+        if (capacities.empty() || capacities.back() != array.capacity()) {
+            capacities.push_back(array.capacity());
+        }
+    }
+
+    std::vector<size_t> expect = {4, 6, 9, 13, 19, 28};
+
+    // Assertion
+    EXPECT_EQ(expect, capacities);
+}
+
+TEST(GrowthArray, add_all_uses_policy) {
+    // Setup
+    GrowthArray<int> array = {1, 2, 3, 4};
+    array.addAll(GrowthArray<int>({5}));
+    array.insertAll(GrowthArray<int>({6, 7, 8, 9, 10, 11, 12, 13, 14}), 0);
+
+    // Assertion
+    EXPECT_EQ(8, array.size() - 6);
+    EXPECT_EQ(16, array.capacity());
+}
+
+TEST(GrowthArray, page_rounding) {
+    // Setup
+    GrowthArray<double, PageGrowth<GeometricGrowth<>, 4096>> array = GrowthArray<double, PageGrowth<GeometricGrowth<>, 4096>>();
+
+    for (int i = 0; i < 600; ++i) {
+        array.add(i);
+    }
+
+    // Assertion
+    EXPECT_EQ(0, (array.capacity() * sizeof(double)) % 4096);
+}
+
+TEST(GrowthArray, shrink_to_fit) {
+    // Setup
+    GrowthArray<int> array = {1, 2, 3, 4, 5};
+    array.add(6).shrinkToFit();
+
+    // Assertion
+    EXPECT_EQ(6, array.capacity());
+}
+
+TEST(GrowthArray, allocator) {
+    // Setup
+    TrackedAllocations = 0;
+    GrowthArray<int, GeometricGrowth<>, TrackingAllocator<int>> array = GrowthArray<int, GeometricGrowth<>, TrackingAllocator<int>>();
+
+    for (int i = 0; i < 64; ++i) {
+        array.add(i);
+    }
+
+    // Assertion
+    EXPECT_EQ(5, TrackedAllocations);
+    EXPECT_EQ(64, array.capacity());
+}
+
+
+///////////////
+// Array API //
+///////////////
+
+TEST(GrowthArray, array_api) {
+    // Setup
+    GrowthArray<int> array = {5, 3, 1};
+    array.add(4).insert(2, 1).addFirst(0).remove(3).sort();
+    std::vector<int> expect = {0, 1, 2, 4, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_EQ(2, array.indexOf(2));
+    EXPECT_EQ("[1, 2, 4]", array.slice(1, 3).description());
+    EXPECT_EQ(12, array.reduce(0, [](int a, int b) { return a + b; }));
+    EXPECT_TRUE(array == array.copy());
+}
+
+TEST(GrowthArray, self_add) {
+    // Setup
+    GrowthArray<std::string> array = {"a", "b", "c", "d"};
+    array.add(array[0]);
+    array.insert(array[1], 0);
+    std::vector<std::string> expect = {"b", "a", "b", "c", "d", "a"};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+TEST(GrowthArray, self_move_at_capacity) {
+    // Setup
+    GrowthArray<std::string> array = {"first string, longer than the inline buffer", "b"};
+    array.shrinkToFit();
+    ASSERT_EQ(array.size(), array.capacity());
+    array._data.push_back(std::move(array._data[0]));
+
+    // Assertion
+    EXPECT_EQ(3, array.size());
+    EXPECT_EQ("first string, longer than the inline buffer", array[2]);
+}
@@ -0,0 +1,448 @@
+//
+// HashDictionary_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "HashDictionary.hpp"
+#include "gtest.h"
+
+#include <algorithm>
+
+using namespace mrlib;
+
+// Counts how often a table hashes a key, a table that grows hashes all of its keys again
+static size_t HashCalls = 0;
+
+struct CountingHash {
+    size_t operator()(int key) const {
+        ++HashCalls;
+        return std::hash<int>()(key);
+    }
+};
+
+// Counts how often a String is hashed, a lookup that makes a temporary key hashes one
+static size_t StringKeyHashes = 0;
+
+struct CountingStringHash : StringHash {
+    using StringHash::operator();
+
+    size_t operator()(const String& string) const {
+        ++StringKeyHashes;
+        return StringHash::operator()(string);
+    }
+};
+
+// Object that counts its copies, moving it is free
+static size_t ObjectCopies = 0;
+
+struct CountedObject {
+    std::string text;
+
+    CountedObject() {}
+    CountedObject(const std::string& text) : text(text) {}
+    CountedObject(const CountedObject& object) : text(object.text) { ++ObjectCopies; }
+    CountedObject(CountedObject&& object) : text(std::move(object.text)) {}
+
+    CountedObject& operator=(const CountedObject& object) { this->text = object.text; ++ObjectCopies; return *this; }
+    CountedObject& operator=(CountedObject&& object) { this->text = std::move(object.text); return *this; }
+};
+
+// Sends every key to the same group, so lookups have to probe past full groups
+struct CollidingHash {
+    size_t operator()(int) const { return 0; }
+};
+
+
+//////////////////
+// Constructors //
+//////////////////
+
+TEST(HashDictionary, default_constructor) {
+    // Setup
+    HashDictionary<char, int> dictionary = HashDictionary<char, int>();
+
+    // Assertion
+    EXPECT_TRUE(dictionary.isEmpty());
+    EXPECT_EQ(0, dictionary._data.capacity());
+    EXPECT_FALSE(dictionary.containsKey('a'));
+    EXPECT_EQ("{}", dictionary.description());
+}
+
+TEST(HashDictionary, initializer_list_constructor) {
+    // Setup
+    HashDictionary<char, int> dictionary = {{'a', 1}, {'b', 2}};
+    std::map<char, int> expect = {{'a', 1}, {'b', 2}};
+
+    // Assertion
+    EXPECT_EQ(expect, dictionary.std_map());
+    EXPECT_EQ(HASH_GROUP_WIDTH, dictionary._data.capacity());
+}
+
+TEST(HashDictionary, map_constructor) {
+    // Setup
+    std::map<char, int> map = {{'a', 1}, {'b', 2}};
+    std::unordered_map<char, int> unordered_map = {{'a', 1}, {'b', 2}};
+    HashDictionary<char, int> dictionary1 = HashDictionary<char, int>(map);
+    HashDictionary<char, int> dictionary2 = HashDictionary<char, int>(unordered_map);
+
+    // Assertion
+    EXPECT_EQ(map, dictionary1.std_map());
+    EXPECT_EQ(unordered_map, dictionary2.std_unordered_map());
+    EXPECT_TRUE(dictionary1 == dictionary2);
+}
+
+
+////////////////
+// Hash Table //
+////////////////
+
+TEST(HashDictionary, grows) {
+    // Setup
+    HashDictionary<int, int> dictionary = HashDictionary<int, int>();
+    for (int i = 0; i < 10000; ++i) {
+        dictionary[i] = i * 2;
+    }
+
+    // Assertion
+    EXPECT_EQ(10000, dictionary.size());
+    EXPECT_GE(dictionary._data.capacity() - dictionary._data.capacity() / 8, dictionary.size());
+    for (int i = 0; i < 10000; ++i) {
+        ASSERT_EQ(i * 2, dictionary.objectForKey(i));
+    }
+    EXPECT_FALSE(dictionary.containsKey(10000));
+}
+
+TEST(HashDictionary, remove_and_reuse) {
+    // Setup
+    HashDictionary<int, int> dictionary = HashDictionary<int, int>();
+    for (int i = 0; i < 1000; ++i) {
+        dictionary[i] = i;
+    }
+
+    size_t capacity = dictionary._data.capacity();
+
+    // Removing and adding the same number of keys reuses the table
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 1000; i += 2) {
+            dictionary.remove(i + round * 1000);
+        }
+        for (int i = 0; i < 1000; i += 2) {
+            dictionary[i + (round + 1) * 1000] = i;
+        }
+    }
+
+    // Assertion
+    EXPECT_EQ(1000, dictionary.size());
+    EXPECT_EQ(capacity, dictionary._data.capacity());
+    EXPECT_TRUE(dictionary.containsKey(999));
+    EXPECT_TRUE(dictionary.containsKey(20000));
+    EXPECT_FALSE(dictionary.containsKey(19000));
+}
+
+TEST(HashDictionary, colliding_hash) {
+    // Setup
+    HashDictionary<int, int, CollidingHash> dictionary = HashDictionary<int, int, CollidingHash>();
+    for (int i = 0; i < 100; ++i) {
+        dictionary[i] = i;
+    }
+    for (int i = 0; i < 100; i += 3) {
+        dictionary.remove(i);
+    }
+
+    // Assertion
+    EXPECT_EQ(66, dictionary.size());
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(i % 3 != 0, dictionary.containsKey(i));
+    }
+}
+
+TEST(HashDictionary, iteration) {
+    // Setup
+    HashDictionary<int, int> dictionary = HashDictionary<int, int>();
+    for (int i = 0; i < 100; ++i) {
+        dictionary[i] = i;
+    }
+    dictionary.remove(50);
+
+    std::vector<int> keys = dictionary.getKeys();
+    std::sort(keys.begin(), keys.end());
+
+    // Assertion
+    EXPECT_EQ(99, keys.size());
+    EXPECT_EQ(49, keys[49]);
+    EXPECT_EQ(51, keys[50]);
+    EXPECT_EQ(99, std::distance(dictionary._data.begin(), dictionary._data.end()));
+}
+
+TEST(HashDictionary, string_keys) {
+    // Setup
+    HashDictionary<std::string, std::string> dictionary = HashDictionary<std::string, std::string>();
+    for (int i = 0; i < 200; ++i) {
+        dictionary[std::to_string(i)] = std::string(40, char('a' + i % 26));
+    }
+    dictionary.remove("7");
+    dictionary.removeAll();
+    dictionary["a"] = "b";
+
+    // Assertion
+    EXPECT_EQ(1, dictionary.size());
+    EXPECT_EQ("{a => b}", dictionary.description());
+}
+
+
+////////////////////
+// Dictionary API //
+////////////////////
+
+TEST(HashDictionary, dictionary_api) {
+    // Setup
+    HashDictionary<char, int> dictionary = {{'a', 1}, {'b', 2}, {'c', 3}};
+    dictionary.addObject('d', 4).replace('a', 5).swap('b', 'c').remove('d');
+
+    // Assertion
+    EXPECT_EQ(5, dictionary['a']);
+    EXPECT_EQ(3, dictionary['b']);
+    EXPECT_EQ(2, dictionary['c']);
+    EXPECT_FALSE(dictionary.containsKey('d'));
+    EXPECT_ANY_THROW(dictionary.addObject('a', 1));
+    EXPECT_ANY_THROW(dictionary.objectForKey('z'));
+}
+
+TEST(HashDictionary, single_lookup_api) {
+    // Setup
+    HashDictionary<std::string, int> dictionary = {{"a", 1}};
+    dictionary.insertOrAssign("a", 2).insertOrAssign("b", 3);
+    dictionary.upsert("c", [](int& value) { value = 4; });
+    dictionary.getOrInsert("d", []() { return 5; });
+
+    // Assertion
+    ASSERT_NE(nullptr, dictionary.tryGet("a"));
+    EXPECT_EQ(2, *dictionary.tryGet("a"));
+    EXPECT_EQ(3, dictionary.objectForKey("b"));
+    EXPECT_EQ(4, dictionary.objectForKey("c"));
+    EXPECT_EQ(5, dictionary.getOrInsert("d", []() { return 6; }));
+    EXPECT_EQ(nullptr, dictionary.tryGet("e"));
+}
+
+TEST(HashDictionary, insert_value_from_same_dictionary) {
+    // Setup, fourteen entries fill sixteen slots, so the next key grows the table
+    HashDictionary<int, std::string> dictionary = HashDictionary<int, std::string>();
+    for (int i = 0; i < 14; ++i) {
+        dictionary[i] = "value" + std::to_string(i);
+    }
+
+    dictionary.insertOrAssign(100, dictionary[3]);
+    dictionary.addObject(101, dictionary[4]);
+    for (int i = 102; i < 200; ++i) {
+        dictionary.getOrInsert(i, [&dictionary]() -> const std::string& { return dictionary[5]; });
+    }
+
+    // Assertion
+    EXPECT_EQ("value3", dictionary[100]);
+    EXPECT_EQ("value4", dictionary[101]);
+    EXPECT_EQ("value5", dictionary[102]);
+    EXPECT_EQ("value5", dictionary[199]);
+}
+
+TEST(HashDictionary, default_value) {
+    // Setup
+    HashDictionary<char, int> dictionary = HashDictionary<char, int>(10);
+    dictionary['a'] += 1;
+
+    // Assertion
+    EXPECT_EQ(11, dictionary['a']);
+    EXPECT_EQ(10, dictionary['b']);
+    EXPECT_EQ(2, dictionary.size());
+}
+
+TEST(HashDictionary, operators) {
+    // Setup
+    HashDictionary<char, int> dictionary1 = {{'a', 1}, {'b', 2}};
+    HashDictionary<char, int> dictionary2 = {{'b', 3}, {'c', 4}};
+    HashDictionary<char, int> sum = dictionary1 + dictionary2;
+    HashDictionary<char, int> copy = sum.copy();
+    dictionary1 += dictionary2;
+    std::map<char, int> expect = {{'a', 1}, {'b', 3}, {'c', 4}};
+
+    // Assertion
+    EXPECT_EQ(expect, sum.std_map());
+    EXPECT_TRUE(sum == dictionary1);
+    EXPECT_TRUE(sum == copy);
+    EXPECT_TRUE(sum != dictionary2);
+    copy['a'] = 0;
+    EXPECT_TRUE(sum != copy);
+}
+
+TEST(HashDictionary, copy_move) {
+    // Setup
+    HashDictionary<std::string, int> dictionary1 = {{"a", 1}, {"b", 2}};
+    HashDictionary<std::string, int> dictionary2 = dictionary1;
+    HashMap<std::string, int> map = std::move(dictionary1._data);
+    dictionary2["c"] = 3;
+
+    // Assertion
+    EXPECT_EQ(3, dictionary2.size());
+    EXPECT_EQ(2, map.size());
+    EXPECT_EQ(1, map.count("a"));
+    EXPECT_TRUE(dictionary1.isEmpty());
+    EXPECT_FALSE(dictionary1.containsKey("a"));
+}
+
+
+//////////////////////
+// Batch Operations //
+//////////////////////
+
+TEST(HashDictionary, batch_operations) {
+    // Setup
+    HashDictionary<int, int> dictionary = HashDictionary<int, int>();
+    std::vector<std::pair<int, int>> batch = std::vector<std::pair<int, int>>();
+    std::vector<int> keys = std::vector<int>();
+    for (int i = 0; i < 1000; ++i) {
+        batch.push_back(std::make_pair(i, i * 2));
+        keys.push_back(i * 2);
+    }
+    dictionary.addAll(batch);
+    size_t capacity = dictionary._data.capacity();
+
+    std::vector<int*> values = dictionary.getMany(keys);
+    dictionary.removeMany(keys);
+
+    // Assertion
+    ASSERT_EQ(1000, values.size());
+    EXPECT_EQ(0, *values[0]);
+    EXPECT_EQ(1000, *values[250]);
+    EXPECT_EQ(nullptr, values[999]);
+    EXPECT_EQ(500, dictionary.size());
+    EXPECT_EQ(capacity, dictionary._data.capacity());
+    EXPECT_FALSE(dictionary.containsKey(998));
+    EXPECT_TRUE(dictionary.containsKey(999));
+}
+
+TEST(HashDictionary, add_all_grows_once) {
+    // Setup
+    HashDictionary<int, int, CountingHash> dictionary = HashDictionary<int, int, CountingHash>();
+    std::vector<std::pair<int, int>> batch = std::vector<std::pair<int, int>>();
+    for (int i = 0; i < 5000; ++i) {
+        batch.push_back(std::make_pair(i, i));
+    }
+
+    size_t before = HashCalls;
+    dictionary.addAll(batch);
+    size_t hashes = HashCalls - before;
+
+    // Assertion
+    EXPECT_EQ(5000, dictionary.size());
+    EXPECT_EQ(5000, hashes);   // Every key is hashed once, the table is grown before any key is added
+}
+
+
+//////////////////////////
+// Heterogeneous Lookup //
+//////////////////////////
+
+TEST(HashDictionary, string_hash) {
+    // Setup
+    const char* key = "a key that is too long for the small string buffer";
+    StringHash hash = StringHash();
+    StringEqual equal = StringEqual();
+
+    // Assertion
+    EXPECT_EQ(hash(key), hash(std::string(key)));
+    EXPECT_EQ(hash(key), hash(String(key)));
+    EXPECT_TRUE(equal(String(key), key));
+    EXPECT_TRUE(equal(std::string(key), String(key)));
+    EXPECT_FALSE(equal(String("abc"), "abd"));
+    EXPECT_FALSE(equal(String("abc"), "ab"));
+}
+
+TEST(HashDictionary, lookup_without_temporary_key) {
+    // Setup
+    const char* key = "a key that is too long for the small string buffer";
+    HashDictionary<String, int, CountingStringHash, StringEqual> dictionary = HashDictionary<String, int, CountingStringHash, StringEqual>();
+    dictionary[String(key)] = 1;
+    dictionary[String("short")] = 2;
+
+    size_t before = StringKeyHashes;
+    bool contains = dictionary.containsKey(key);
+    bool missing = dictionary.containsKey("a different key that is also too long for the buffer");
+    int value = dictionary.objectForKey(key);
+    int* pointer = dictionary.tryGet(std::string("short"));
+    size_t hashes = StringKeyHashes - before;
+
+    // Assertion
+    EXPECT_TRUE(contains);
+    EXPECT_FALSE(missing);
+    EXPECT_EQ(1, value);
+    ASSERT_NE(nullptr, pointer);
+    EXPECT_EQ(2, *pointer);
+    EXPECT_EQ(0, hashes);
+}
+
+
+////////////////////
+// Move Semantics //
+////////////////////
+
+TEST(HashDictionary, move_does_not_copy) {
+    // Setup
+    HashDictionary<std::string, CountedObject> dictionary1 = HashDictionary<std::string, CountedObject>();
+    for (int i = 0; i < 100; ++i) {
+        dictionary1[std::to_string(i)] = CountedObject(std::string(40, 'x'));
+    }
+    std::pair<const std::string, CountedObject>* slots = dictionary1._data._slots;
+
+    size_t before = ObjectCopies;
+    HashDictionary<std::string, CountedObject> dictionary2 = std::move(dictionary1);
+    HashDictionary<std::string, CountedObject> dictionary3 = HashDictionary<std::string, CountedObject>();
+    dictionary3 = std::move(dictionary2);
+    HashDictionary<std::string, CountedObject> dictionary4 = HashDictionary<std::string, CountedObject>();
+    dictionary4 += std::move(dictionary3);
+    size_t copies = ObjectCopies - before;
+
+    // Assertion
+    EXPECT_EQ(0, copies);
+    EXPECT_EQ(slots, dictionary4._data._slots);
+    EXPECT_EQ(100, dictionary4.size());
+    EXPECT_TRUE(dictionary1.isEmpty());
+    EXPECT_TRUE(dictionary3.isEmpty());
+}
+
+TEST(HashDictionary, merge_moves_values) {
+    // Setup
+    HashDictionary<std::string, CountedObject> dictionary1 = HashDictionary<std::string, CountedObject>();
+    dictionary1["a"] = CountedObject("1");
+    HashDictionary<std::string, CountedObject> dictionary2 = HashDictionary<std::string, CountedObject>();
+    dictionary2["a"] = CountedObject(std::string(40, 'x'));
+
+    size_t before = ObjectCopies;
+    dictionary1 += std::move(dictionary2);
+    size_t copies = ObjectCopies - before;
+
+    // Assertion
+    EXPECT_EQ(0, copies);
+    EXPECT_EQ(std::string(40, 'x'), dictionary1["a"].text);
+}
+
+TEST(HashDictionary, merge_sizes_table_once) {
+    // Setup
+    HashDictionary<int, int> dictionary1 = HashDictionary<int, int>();
+    HashDictionary<int, int> dictionary2 = HashDictionary<int, int>();
+    for (int i = 0; i < 1000; ++i) {
+        dictionary1[i] = 1;
+        dictionary2[i + 500] = 2;
+    }
+
+    HashMap<int, int> reserved = HashMap<int, int>();
+    reserved.reserve(2000);
+    HashDictionary<int, int> merged = dictionary1 + dictionary2;
+
+    // Assertion
+    EXPECT_EQ(1500, merged.size());
+    EXPECT_EQ(1, merged[0]);
+    EXPECT_EQ(2, merged[500]);
+    EXPECT_EQ(2, merged[1499]);
+    EXPECT_EQ(reserved.capacity(), merged._data.capacity());
+}
@@ -0,0 +1,156 @@
+//
+// MultiDictionary_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "MultiDictionary.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+//////////////////
+// Constructors //
+//////////////////
+
+TEST(MultiDictionary, constructor_initializer_list) {
+    // Setup
+    MultiDictionary<std::string, int> dictionary = {{"a", 1}, {"b", 2}, {"a", 3}};
+
+    // Assertion
+    EXPECT_EQ(2, dictionary.size());
+    EXPECT_EQ(3, dictionary.objectCount());
+    EXPECT_EQ(2, dictionary.countForKey("a"));
+    EXPECT_EQ("[1, 3]", dictionary.objectsForKey("a").description());
+}
+
+
+//////////////////////
+// Querying Objects //
+//////////////////////
+
+TEST(MultiDictionary, objects_for_key) {
+    // Setup
+    MultiDictionary<int, std::string> dictionary = MultiDictionary<int, std::string>();
+    dictionary.addObject(1, "one").addObject(1, "uno").addObject(2, "two");
+
+    ArraySlice<std::string> objects = dictionary.objectsForKey(1);
+
+    // Assertion
+    ASSERT_EQ(2, objects.size());
+    EXPECT_EQ("one", objects[0]);
+    EXPECT_EQ("uno", objects[1]);
+    EXPECT_EQ("one", *dictionary.firstObject(1));
+    EXPECT_TRUE(dictionary.objectsForKey(3).isEmpty());
+    EXPECT_EQ(nullptr, dictionary.firstObject(3));
+    EXPECT_TRUE(dictionary.containsObject(1, "uno"));
+    EXPECT_FALSE(dictionary.containsObject(2, "uno"));
+    EXPECT_FALSE(dictionary.containsKey(3));
+}
+
+TEST(MultiDictionary, iteration_read_only) {
+    // Setup
+    MultiDictionary<int, int> dictionary = {{1, 1}, {1, 2}, {2, 3}};
+    size_t objects = 0;
+    for (const auto& pair : dictionary) {
+        objects += pair.second.size();
+    }
+
+    // Assertion, a vector can only be changed through the dictionary, which keeps the object count
+    EXPECT_TRUE((std::is_same<MultiDictionary<int, int>::const_iterator, MultiDictionary<int, int>::iterator>::value));
+    EXPECT_TRUE((std::is_const<std::remove_reference<decltype(*dictionary.begin())>::type>::value));
+    EXPECT_EQ(dictionary.objectCount(), objects);
+}
+
+TEST(MultiDictionary, contiguous_objects) {
+    // Setup
+    MultiDictionary<int, int> dictionary = MultiDictionary<int, int>();
+    for (int i = 0; i < 1000; ++i) {
+        dictionary.addObject(i % 3, i);
+    }
+
+    ArraySlice<int> objects = dictionary.objectsForKey(1);
+
+    // Assertion
+    ASSERT_EQ(333, objects.size());
+    EXPECT_EQ(objects.begin() + 333, objects.end());
+    EXPECT_EQ(1, objects[0]);
+    EXPECT_EQ(997, objects[332]);
+    EXPECT_EQ(1000, dictionary.objectCount());
+}
+
+
+////////////////////
+// Adding Objects //
+////////////////////
+
+TEST(MultiDictionary, add_objects) {
+    // Setup
+    MultiDictionary<std::string, int> dictionary = MultiDictionary<std::string, int>();
+    std::vector<int> objects = {4, 5};
+    dictionary.addObjects("key", {1, 2, 3}).addObjects("key", objects.begin(), objects.end()).addObjects("empty", {});
+
+    // Assertion
+    EXPECT_EQ(1, dictionary.size());
+    EXPECT_EQ(5, dictionary.objectCount());
+    EXPECT_EQ("[1, 2, 3, 4, 5]", dictionary.objectsForKey("key").description());
+    EXPECT_FALSE(dictionary.containsKey("empty"));
+}
+
+TEST(MultiDictionary, merge) {
+    // Setup
+    MultiDictionary<std::string, int> dictionary1 = {{"a", 1}, {"b", 2}};
+    MultiDictionary<std::string, int> dictionary2 = {{"a", 3}, {"c", 4}};
+    dictionary1.merge(dictionary2);
+
+    MultiDictionary<std::string, int> dictionary3 = {{"x", 1}};
+    dictionary3.merge(dictionary3);
+
+    // Assertion
+    EXPECT_EQ(3, dictionary1.size());
+    EXPECT_EQ(4, dictionary1.objectCount());
+    EXPECT_EQ("[1, 3]", dictionary1.objectsForKey("a").description());
+    EXPECT_EQ("[1, 1]", dictionary3.objectsForKey("x").description());
+    EXPECT_EQ(2, dictionary3.objectCount());
+}
+
+
+//////////////////////
+// Removing Objects //
+//////////////////////
+
+TEST(MultiDictionary, remove_object) {
+    // Setup
+    MultiDictionary<std::string, int> dictionary = {{"a", 1}, {"a", 2}, {"a", 1}, {"b", 3}};
+    dictionary.removeObject("a", 1).removeObject("a", 9).removeObject("c", 1);
+
+    // Assertion
+    EXPECT_EQ("[2, 1]", dictionary.objectsForKey("a").description());
+    EXPECT_EQ(3, dictionary.objectCount());
+
+    dictionary.removeObject("b", 3);
+    EXPECT_FALSE(dictionary.containsKey("b"));
+    EXPECT_EQ(1, dictionary.size());
+
+    dictionary.remove("a");
+    EXPECT_TRUE(dictionary.isEmpty());
+    EXPECT_EQ(0, dictionary.objectCount());
+}
+
+TEST(MultiDictionary, equality_copy) {
+    // Setup
+    MultiDictionary<int, int> dictionary1 = {{1, 1}, {1, 2}};
+    MultiDictionary<int, int> dictionary2 = dictionary1.copy();
+    MultiDictionary<int, int> dictionary3 = {{1, 2}, {1, 1}};
+
+    // Assertion
+    EXPECT_EQ(dictionary1, dictionary2);
+    EXPECT_NE(dictionary1, dictionary3);
+    EXPECT_EQ("{1 => [1, 2]}", dictionary1.description());
+
+    dictionary2.removeAll();
+    EXPECT_TRUE(dictionary2.isEmpty());
+    EXPECT_EQ(2, dictionary1.objectCount());
+}
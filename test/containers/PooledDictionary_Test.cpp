@@ -0,0 +1,150 @@
+//
+// PooledDictionary_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "PooledDictionary.hpp"
+#include "FlatDictionary.hpp"
+#include "HashDictionary.hpp"
+#include "gtest.h"
+
+#include <string>
+
+using namespace mrlib;
+
+
+///////////////////
+// Pool Resource //
+///////////////////
+
+TEST(PooledDictionary, pool_reuses_blocks) {
+    // Setup
+    PoolResource pool;
+    void* first = pool.allocate(40);
+    void* second = pool.allocate(36);
+    pool.deallocate(first, 40);
+    void* third = pool.allocate(33);
+
+    // Assertion
+    EXPECT_EQ(first, third);
+    EXPECT_EQ(static_cast<char*>(first) + 40, second);
+    EXPECT_EQ(80, pool.used());
+    EXPECT_EQ(POOL_SLAB_SIZE, pool.reserved());
+    pool.deallocate(second, 36);
+    pool.deallocate(third, 33);
+    EXPECT_EQ(0, pool.used());
+}
+
+TEST(PooledDictionary, pool_large_blocks) {
+    // Setup
+    PoolResource pool;
+    void* block = pool.allocate(POOL_MAX_BLOCK + 1);
+
+    // Assertion
+    EXPECT_EQ(POOL_MAX_BLOCK + POOL_ALIGNMENT, pool.used());
+    EXPECT_EQ(POOL_MAX_BLOCK + POOL_ALIGNMENT, pool.reserved());
+    pool.deallocate(block, POOL_MAX_BLOCK + 1);
+    EXPECT_EQ(0, pool.reserved());
+}
+
+
+////////////////
+// Dictionary //
+////////////////
+
+TEST(PooledDictionary, dictionary_api) {
+    // Setup
+    PooledDictionary<std::string, int> dictionary = {{"b", 2}, {"a", 1}};
+    dictionary.addObject("c", 3).insertOrAssign("a", 4).remove("b");
+    dictionary.addAll({{"d", 5}, {"e", 6}});
+
+    // Assertion
+    EXPECT_EQ("{a => 4, c => 3, d => 5, e => 6}", dictionary.description());
+    EXPECT_EQ(4, dictionary.objectForKey("a"));
+    EXPECT_FALSE(dictionary.containsKey("b"));
+    EXPECT_ANY_THROW(dictionary.addObject("c", 0));
+}
+
+TEST(PooledDictionary, copies_have_own_pool) {
+    // Setup
+    PooledDictionary<int, int> dictionary1 = PooledDictionary<int, int>();
+    for (int i = 0; i < 100; ++i) {
+        dictionary1[i] = i;
+    }
+    PooledDictionary<int, int> dictionary2 = dictionary1;
+    PooledDictionary<int, int> dictionary3 = dictionary1 + dictionary2;
+    PooledDictionary<int, int> dictionary4 = std::move(dictionary3);
+    dictionary1.removeAll();
+
+    // Assertion
+    EXPECT_TRUE(dictionary1._data.get_allocator() != dictionary2._data.get_allocator());
+    EXPECT_EQ(100, dictionary2.size());
+    EXPECT_EQ(100, dictionary4.size());
+    EXPECT_EQ(99, dictionary4[99]);
+}
+
+TEST(PooledDictionary, moved_from_is_reusable) {
+    // Setup
+    PooledDictionary<int, int> dictionary1 = {{1, 1}};
+    PooledDictionary<int, int> dictionary2 = std::move(dictionary1);
+    size_t moved_usage = dictionary1.memoryUsage();
+    dictionary1.addObject(2, 2);
+    PooledDictionary<int, int> dictionary3 = PooledDictionary<int, int>();
+    dictionary3 = std::move(dictionary2);
+    dictionary2[3] = 3;
+
+    // Assertion
+    EXPECT_EQ(sizeof(dictionary1), moved_usage);
+    EXPECT_EQ("{2 => 2}", dictionary1.description());
+    EXPECT_EQ("{3 => 3}", dictionary2.description());
+    EXPECT_EQ("{1 => 1}", dictionary3.description());
+    EXPECT_TRUE(dictionary1._data.get_allocator() != dictionary3._data.get_allocator());
+}
+
+TEST(PooledDictionary, removed_nodes_are_reused) {
+    // Setup
+    PooledDictionary<int, int> dictionary = PooledDictionary<int, int>();
+    for (int i = 0; i < 10000; ++i) {
+        dictionary[i] = i;
+    }
+    size_t usage = dictionary.memoryUsage();
+
+    for (int i = 0; i < 10000; ++i) {
+        dictionary.remove(i);
+        dictionary[i + 10000] = i;
+    }
+
+    // Assertion
+    EXPECT_EQ(usage, dictionary.memoryUsage());
+}
+
+
+//////////////////
+// Memory Usage //
+//////////////////
+
+TEST(PooledDictionary, memory_usage) {
+    // Setup
+    Dictionary<int, int> tree = Dictionary<int, int>();
+    PooledDictionary<int, int> pooled = PooledDictionary<int, int>();
+    HashDictionary<int, int> hash = HashDictionary<int, int>();
+    FlatDictionary<int, int> flat = FlatDictionary<int, int>();
+
+    std::vector<std::pair<int, int>> entries = std::vector<std::pair<int, int>>();
+    for (int i = 0; i < 100000; ++i) {
+        entries.push_back(std::make_pair(i, i));
+    }
+    tree.addAll(entries);
+    pooled.addAll(entries);
+    hash.addAll(entries);
+    flat.addAll(entries);
+
+    // Assertion
+    EXPECT_EQ(sizeof(tree) + 100000 * 48, tree.memoryUsage());
+    EXPECT_LT(pooled.memoryUsage(), tree.memoryUsage());
+    EXPECT_LT(hash.memoryUsage(), pooled.memoryUsage());
+    EXPECT_EQ(sizeof(flat) + 100000 * 8, flat.memoryUsage());
+    EXPECT_EQ(sizeof(hash) + hash._data.capacity() * 9, hash.memoryUsage());
+}
@@ -0,0 +1,262 @@
+//
+// RadixDictionary_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "RadixDictionary.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+//////////////////
+// Constructors //
+//////////////////
+
+TEST(RadixDictionary, constructor_initializer_list) {
+    // Setup
+    RadixDictionary<int> dictionary = {{"one", 1}, {"two", 2}, {"one", 3}};
+
+    // Assertion
+    EXPECT_EQ(2, dictionary.size());
+    EXPECT_EQ(1, dictionary.objectForKey("one"));
+    EXPECT_EQ(2, dictionary.objectForKey("two"));
+}
+
+TEST(RadixDictionary, constructor_dictionary) {
+    // Setup
+    Dictionary<String, int> source = {{String("b"), 2}, {String("a"), 1}};
+    RadixDictionary<int> dictionary = RadixDictionary<int>(source);
+
+    // Assertion
+    EXPECT_EQ(2, dictionary.size());
+    EXPECT_EQ(source.std_map(), dictionary.std_map());
+}
+
+TEST(RadixDictionary, constructor_copy_move) {
+    // Setup
+    RadixDictionary<int> dictionary1 = {{"apple", 1}, {"apply", 2}, {"ape", 3}};
+    RadixDictionary<int> dictionary2 = dictionary1;
+    dictionary2["apple"] = 10;
+    RadixDictionary<int> dictionary3 = std::move(dictionary2);
+
+    // Assertion
+    EXPECT_EQ(1, dictionary1.objectForKey("apple"));
+    EXPECT_EQ(10, dictionary3.objectForKey("apple"));
+    EXPECT_TRUE(dictionary2.isEmpty());
+    EXPECT_NE(dictionary1, dictionary3);
+    EXPECT_EQ(dictionary1, dictionary1.copy());
+}
+
+
+//////////////////////
+// Querying Objects //
+//////////////////////
+
+TEST(RadixDictionary, split_prefixes) {
+    // Setup
+    RadixDictionary<int> dictionary = RadixDictionary<int>();
+    dictionary["romane"] = 1;
+    dictionary["romanus"] = 2;
+    dictionary["romulus"] = 3;
+    dictionary["rom"] = 4;
+    dictionary[""] = 5;
+
+    // Assertion
+    EXPECT_EQ(5, dictionary.size());
+    EXPECT_EQ(1, dictionary.objectForKey("romane"));
+    EXPECT_EQ(2, dictionary.objectForKey("romanus"));
+    EXPECT_EQ(3, dictionary.objectForKey("romulus"));
+    EXPECT_EQ(4, dictionary.objectForKey("rom"));
+    EXPECT_EQ(5, dictionary.objectForKey(""));
+    EXPECT_FALSE(dictionary.containsKey("roman"));
+    EXPECT_FALSE(dictionary.containsKey("ro"));
+    EXPECT_FALSE(dictionary.containsKey("romanes"));
+    EXPECT_EQ(nullptr, dictionary.tryGet("x"));
+    EXPECT_ANY_THROW(dictionary.objectForKey("roman"));
+}
+
+TEST(RadixDictionary, ordered_iteration) {
+    // Setup
+    RadixDictionary<int> dictionary = {{"b", 1}, {"ab", 2}, {"a", 3}, {"abc", 4}, {"\xff", 5}, {"B", 6}};
+
+    // Assertion
+    std::vector<String> keys = {"B", "a", "ab", "abc", "b", "\xff"};
+    EXPECT_EQ(keys, dictionary.getKeys());
+    EXPECT_EQ(std::vector<int>({6, 3, 2, 4, 1, 5}), dictionary.getValues());
+    EXPECT_EQ("{B => 6, a => 3, ab => 2, abc => 4, b => 1, \xff => 5}", dictionary.description());
+}
+
+TEST(RadixDictionary, node_growth) {
+    // Setup
+    RadixDictionary<int> dictionary = RadixDictionary<int>();
+    for (int i = 0; i < 256; ++i) {
+        dictionary[String(std::string(1, char(i)) + "key")] = i;
+    }
+
+    // Assertion
+    EXPECT_EQ(256, dictionary.size());
+    EXPECT_EQ(RADIX_NODE_256, dictionary._root->_kind);
+    for (int i = 0; i < 256; ++i) {
+        EXPECT_EQ(i, dictionary.objectForKey(String(std::string(1, char(i)) + "key")));
+    }
+
+    int expected = 0;
+    for (const auto& pair : dictionary) {
+        EXPECT_EQ(expected++, pair.second);
+    }
+}
+
+
+////////////////////
+// Prefix Queries //
+////////////////////
+
+TEST(RadixDictionary, with_prefix) {
+    // Setup
+    RadixDictionary<int> dictionary = {{"/api/users", 1}, {"/api/users/1", 2}, {"/api/orders", 3}, {"/static/app.js", 4}};
+
+    // Assertion
+    EXPECT_EQ(std::vector<String>({"/api/orders", "/api/users", "/api/users/1"}), dictionary.getKeysWithPrefix("/api/"));
+    EXPECT_EQ(std::vector<String>({"/api/users", "/api/users/1"}), dictionary.getKeysWithPrefix("/api/us"));
+    EXPECT_EQ(std::vector<String>({"/api/users/1"}), dictionary.getKeysWithPrefix("/api/users/"));
+    EXPECT_EQ(4, dictionary.getKeysWithPrefix("").size());
+    EXPECT_TRUE(dictionary.withPrefix("/apx").isEmpty());
+    EXPECT_TRUE(dictionary.withPrefix("/api/users/12").isEmpty());
+}
+
+TEST(RadixDictionary, with_prefix_modify) {
+    // Setup
+    RadixDictionary<int> dictionary = {{"log.error", 1}, {"log.warn", 2}, {"metric.cpu", 3}};
+    for (auto& pair : dictionary.withPrefix("log.")) {
+        pair.second *= 10;
+    }
+
+    // Assertion
+    EXPECT_EQ(10, dictionary.objectForKey("log.error"));
+    EXPECT_EQ(20, dictionary.objectForKey("log.warn"));
+    EXPECT_EQ(3, dictionary.objectForKey("metric.cpu"));
+}
+
+TEST(RadixDictionary, longest_prefix_of) {
+    // Setup
+    RadixDictionary<String> routes = {{"/", "root"}, {"/api", "api"}, {"/api/users", "users"}};
+
+    // Assertion
+    EXPECT_EQ("users", routes.longestPrefixOf("/api/users/42")->second._data);
+    EXPECT_EQ("api", routes.longestPrefixOf("/api/user")->second._data);
+    EXPECT_EQ("api", routes.longestPrefixOf("/api")->second._data);
+    EXPECT_EQ("root", routes.longestPrefixOf("/static")->second._data);
+    EXPECT_EQ(nullptr, routes.longestPrefixOf("api"));
+}
+
+
+///////////////////////////////
+// Adding / Removing Objects //
+///////////////////////////////
+
+TEST(RadixDictionary, add_object) {
+    // Setup
+    RadixDictionary<int> dictionary = RadixDictionary<int>();
+    dictionary.addObject("key", 1);
+    dictionary.insertOrAssign("key", 2).insertOrAssign("other", 3);
+    dictionary.upsert("other", [](int& value) { value += 1; });
+    int& created = dictionary.getOrInsert("new", []() { return 5; });
+
+    // Assertion
+    EXPECT_ANY_THROW(dictionary.addObject("key", 1));
+    EXPECT_EQ(2, dictionary.objectForKey("key"));
+    EXPECT_EQ(4, dictionary.objectForKey("other"));
+    EXPECT_EQ(5, created);
+    EXPECT_ANY_THROW(dictionary.replace("missing", 1));
+}
+
+TEST(RadixDictionary, get_or_insert_throwing_factory) {
+    // Setup, the missing keys would split a prefix, end inside one, and add a child
+    RadixDictionary<int> dictionary = {{"test", 1}, {"team", 2}};
+    std::vector<std::string> missing = {"toast", "te", "tea", "tests", "x", ""};
+    size_t thrown = 0;
+    for (const std::string& key : missing) {
+        try {
+            dictionary.getOrInsert(key, []() -> int { throw std::runtime_error("factory"); });
+        }
+        catch (const std::runtime_error&) {
+            ++thrown;
+        }
+    }
+
+    // Assertion, the tree is left as it was
+    EXPECT_EQ(missing.size(), thrown);
+    EXPECT_EQ(2, dictionary.size());
+    EXPECT_EQ("te", dictionary._root->_prefix);
+    EXPECT_EQ(2, dictionary._root->_count);
+    EXPECT_EQ(nullptr, dictionary._root->_leaf);
+    EXPECT_EQ(std::vector<String>({"team", "test"}), dictionary.getKeys());
+    EXPECT_EQ(2, dictionary.getOrInsert("team", []() -> int { throw std::runtime_error("factory"); }));
+}
+
+TEST(RadixDictionary, remove_merges_nodes) {
+    // Setup
+    RadixDictionary<int> dictionary = {{"test", 1}, {"team", 2}, {"toast", 3}};
+    dictionary.remove("team").remove("missing").remove("te");
+
+    // Assertion
+    EXPECT_EQ(2, dictionary.size());
+    EXPECT_EQ(1, dictionary.objectForKey("test"));
+    EXPECT_EQ(3, dictionary.objectForKey("toast"));
+
+    dictionary.remove("toast");
+    EXPECT_EQ("test", dictionary._root->_prefix);
+    EXPECT_EQ(0, dictionary._root->_count);
+
+    dictionary.removeObjects({"test"});
+    EXPECT_TRUE(dictionary.isEmpty());
+    EXPECT_EQ(nullptr, dictionary._root);
+}
+
+TEST(RadixDictionary, matches_dictionary) {
+    // Setup
+    RadixDictionary<int> dictionary = RadixDictionary<int>();
+    Dictionary<String, int> expected = Dictionary<String, int>();
+
+    // Keys with long shared prefixes and bytes that grow and shrink every node size
+    uint32_t state = 12345;
+    for (int i = 0; i < 20000; ++i) {
+        state = state * 1103515245u + 12345u;
+        std::string key = "/host/" + std::to_string((state >> 8) % 7) + "/" + std::string(1, char((state >> 12) % 200)) + std::to_string((state >> 16) % 50);
+
+        if ((state >> 4) % 3 == 0) {
+            dictionary.remove(key);
+            expected.remove(key);
+        }
+        else {
+            dictionary[key] = i;
+            expected[key] = i;
+        }
+    }
+
+    // Assertion
+    EXPECT_EQ(expected.size(), dictionary.size());
+    EXPECT_EQ(expected.std_map(), dictionary.std_map());
+    for (const auto& pair : expected) {
+        EXPECT_EQ(pair.second, dictionary.objectForKey(pair.first));
+    }
+
+    // Removing every key shrinks each node back down through the smaller sizes
+    std::vector<String> keys = expected.getKeys();
+    for (size_t i = 0; i < keys.size(); i += 2) {
+        dictionary.remove(keys[i]);
+        expected.remove(keys[i]);
+    }
+
+    EXPECT_EQ(expected.std_map(), dictionary.std_map());
+
+    for (size_t i = 1; i < keys.size(); i += 2) {
+        dictionary.remove(keys[i]);
+    }
+
+    EXPECT_TRUE(dictionary.isEmpty());
+    EXPECT_EQ(nullptr, dictionary._root);
+}
@@ -0,0 +1,190 @@
+//
+// RingArray_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "RingArray.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+//////////////////
+// CONSTRUCTORS //
+//////////////////
+
+TEST(RingArray, default_constructor) {
+    // Setup
+    RingArray<int> array = RingArray<int>();
+
+    // Assertion
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_EQ(0, array._data.capacity());
+}
+
+TEST(RingArray, initializer_list) {
+    // Setup
+    RingArray<int> array = {1, 2, 3};
+    std::vector<int> expect = {1, 2, 3};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+TEST(RingArray, size_constructor) {
+    // Setup
+    RingArray<int> array = RingArray<int>(3);
+    std::vector<int> expect = {0, 0, 0};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+
+//////////////////////
+// Queue Operations //
+//////////////////////
+
+TEST(RingArray, add_pop_both_ends) {
+    // Setup
+    RingArray<int> array = RingArray<int>();
+    array.add(2).add(3).addFirst(1).addFirst(0);
+    std::vector<int> expect = {0, 1, 2, 3};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_EQ(0, array.popFirst());
+    EXPECT_EQ(3, array.pop());
+    EXPECT_EQ(1, array.firstObject());
+    EXPECT_EQ(2, array.lastObject());
+}
+
+TEST(RingArray, queue_wraps_around) {
+    // Setup
+    RingArray<int> array = RingArray<int>();
+    for (int i = 0; i < 6; ++i) {
+        array.add(i);
+    }
+
+    // Front removal moves the head, so later adds wrap to the start of the buffer
+    for (int i = 6; i < 100; ++i) {
+        array.add(i);
+        array.removeIndex(0);
+    }
+
+    std::vector<int> expect = {94, 95, 96, 97, 98, 99};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_EQ(8, array._data.capacity());
+}
+
+TEST(RingArray, sliding_window) {
+    // Setup
+    RingArray<int> window = RingArray<int>();
+    int sum = 0;
+    int max_sum = 0;
+    int values[] = {1, 5, 2, 8, 3, 1, 9, 4};
+
+    for (int value : values) {
+        window.add(value);
+        sum += value;
+
+        if (window.size() > 3) {
+            sum -= window.popFirst();
+        }
+
+        max_sum = std::max(max_sum, sum);
+    }
+
+    // Assertion
+    EXPECT_EQ(15, max_sum);
+    EXPECT_EQ(3, window.size());
+}
+
+TEST(RingArray, grow_while_wrapped) {
+    // Setup
+    RingArray<int> array = {3, 4, 5, 6, 7};
+    array.addFirst(2).addFirst(1).addFirst(0);
+    array.add(8);
+    std::vector<int> expect = {0, 1, 2, 3, 4, 5, 6, 7, 8};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_EQ(16, array._data.capacity());
+}
+
+
+///////////////
+// Array API //
+///////////////
+
+TEST(RingArray, insert_remove_middle) {
+    // Setup
+    RingArray<int> array = {1, 2, 4, 5, 7};
+    array.insert(3, 2).insert(6, 5).insert(0, 0);
+    std::vector<int> expect1 = {0, 1, 2, 3, 4, 5, 6, 7};
+    std::vector<int> expect2 = {0, 3, 4, 5, 7};
+
+    // Assertion
+    EXPECT_EQ(expect1, array.std_vector());
+    array.removeRange(1, 3).removeIndex(4);
+    EXPECT_EQ(expect2, array.std_vector());
+}
+
+TEST(RingArray, querying) {
+    // Setup
+    RingArray<int> array = {3, 1, 2, 1};
+    array.popFirst();
+    array.addFirst(7);
+
+    // Assertion
+    EXPECT_EQ(7, array[0]);
+    EXPECT_TRUE(array.contains(2));
+    EXPECT_EQ(3, array.indexOfLast(1));
+    EXPECT_EQ(NO_INDEX, array.indexOf(3));
+    EXPECT_ANY_THROW(array[4]);
+}
+
+TEST(RingArray, algorithms) {
+    // Setup
+    RingArray<int> array = {5, 1, 4, 1};
+    array.addFirst(3).add(2);
+    array.removeAll(1).sort().reverse().replace(4, 6);
+    std::vector<int> expect1 = {2, 3, 5, 6};
+    std::vector<int> expect2 = {5, 6, 3, 2};
+
+    // Assertion
+    EXPECT_EQ(expect2, array.std_vector());
+    EXPECT_EQ("[5, 6, 3, 2]", array.description());
+    EXPECT_EQ(expect1, array.copy().sort().std_vector());
+}
+
+TEST(RingArray, copy_move) {
+    // Setup
+    RingArray<std::string> array1 = {"b", "c"};
+    array1.addFirst("a");
+    RingArray<std::string> array2 = array1;
+    RingArray<std::string> array3 = std::move(array1);
+    array2.pop();
+
+    // Assertion
+    EXPECT_EQ(2, array2.size());
+    EXPECT_EQ(3, array3.size());
+    EXPECT_EQ("a", array3.firstObject());
+    EXPECT_TRUE(array1.isEmpty());
+}
+
+TEST(RingArray, equality) {
+    // Setup
+    RingArray<int> array1 = {1, 2, 3};
+    RingArray<int> array2 = {0, 2, 3};
+    array2.popFirst();
+    array2.addFirst(1);
+
+    // Assertion
+    EXPECT_TRUE(array1 == array2);
+    EXPECT_TRUE(array1.isEqualTo(array2));
+}
@@ -0,0 +1,260 @@
+//
+// SmallArray_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "SmallArray.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+// Allocator that counts how often SmallBuffer goes to the heap
+static size_t Allocations = 0;
+
+template <typename T>
+struct CountingAllocator {
+    typedef T value_type;
+
+    CountingAllocator() {}
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(size_t n) {
+        ++Allocations;
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* pointer, size_t) {
+        ::operator delete(pointer);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T>&, const CountingAllocator<U>&) { return true; }
+
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T>&, const CountingAllocator<U>&) { return false; }
+
+typedef SmallArray<int, 4, CountingAllocator<int>> CountedArray;
+
+
+//////////////////
+// CONSTRUCTORS //
+//////////////////
+
+TEST(SmallArray, default_constructor) {
+    // Setup
+    Allocations = 0;
+    CountedArray array = CountedArray();
+
+    // Assertion
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_TRUE(array._data.isInline());
+    EXPECT_EQ(4, array._data.capacity());
+    EXPECT_EQ(0, Allocations);
+}
+
+TEST(SmallArray, initializer_list) {
+    // Setup
+    Allocations = 0;
+    CountedArray array = {1, 2, 3, 4};
+    std::vector<int> expect = {1, 2, 3, 4};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_TRUE(array._data.isInline());
+    EXPECT_EQ(0, Allocations);
+}
+
+TEST(SmallArray, size_constructor) {
+    // Setup
+    CountedArray array = CountedArray(3);
+    std::vector<int> expect = {0, 0, 0};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+TEST(SmallArray, vector_constructor) {
+    // Setup
+    std::vector<int> expect = {1, 2, 3, 4, 5, 6};
+    CountedArray array = CountedArray(expect);
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_FALSE(array._data.isInline());
+}
+
+
+/////////////////
+// Allocations //
+/////////////////
+
+TEST(SmallArray, inline_no_allocation) {
+    // Setup
+    Allocations = 0;
+    CountedArray array = CountedArray();
+    array.add(1).add(2).add(3).add(4);
+    array.removeIndex(0).insert(5, 1);
+
+    // Assertion
+    EXPECT_EQ(0, Allocations);
+    EXPECT_TRUE(array._data.isInline());
+}
+
+TEST(SmallArray, spill_to_heap) {
+    // Setup
+    Allocations = 0;
+    CountedArray array = {1, 2, 3, 4};
+    array.add(5);
+    std::vector<int> expect = {1, 2, 3, 4, 5};
+
+    // Assertion
+    EXPECT_EQ(1, Allocations);
+    EXPECT_FALSE(array._data.isInline());
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+TEST(SmallArray, shrink_back_inline) {
+    // Setup
+    CountedArray array = {1, 2, 3, 4, 5, 6};
+    array.removeRange(0, 3);
+    array._data.shrink_to_fit();
+    std::vector<int> expect = {4, 5, 6};
+
+    // Assertion
+    EXPECT_TRUE(array._data.isInline());
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+TEST(SmallArray, copy_inline_no_allocation) {
+    // Setup
+    CountedArray array1 = {1, 2, 3};
+    Allocations = 0;
+    CountedArray array2 = array1;
+    array2.add(4);
+
+    // Assertion
+    EXPECT_EQ(0, Allocations);
+    EXPECT_EQ(3, array1.size());
+    EXPECT_EQ(4, array2.size());
+}
+
+TEST(SmallArray, move_heap_no_allocation) {
+    // Setup
+    CountedArray array1 = {1, 2, 3, 4, 5, 6};
+    const int* storage = array1._data.data();
+    Allocations = 0;
+    CountedArray array2 = std::move(array1);
+
+    // Assertion
+    EXPECT_EQ(0, Allocations);
+    EXPECT_EQ(storage, array2._data.data());
+    EXPECT_EQ(6, array2.size());
+    EXPECT_TRUE(array1.isEmpty());
+}
+
+
+////////////////
+// Array API  //
+////////////////
+
+TEST(SmallArray, operators) {
+    // Setup
+    SmallArray<int> array1 = {1, 2, 3};
+    SmallArray<int> array2 = {4, 5};
+    SmallArray<int> array3 = array1 + array2;
+    array1 += array2;
+    array2[0] = 7;
+    std::vector<int> expect = {1, 2, 3, 4, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, array3.std_vector());
+    EXPECT_TRUE(array1 == array3);
+    EXPECT_TRUE(array1 != array2);
+    EXPECT_EQ(7, array2[0]);
+    EXPECT_ANY_THROW(array2[2]);
+}
+
+TEST(SmallArray, querying) {
+    // Setup
+    SmallArray<int> array = {3, 1, 2, 1};
+
+    // Assertion
+    EXPECT_EQ(3, array.firstObject());
+    EXPECT_EQ(1, array.lastObject());
+    EXPECT_TRUE(array.contains(2));
+    EXPECT_EQ(3, array.indexOfLast(1));
+    EXPECT_EQ(NO_INDEX, array.indexOf(5));
+}
+
+TEST(SmallArray, modifying) {
+    // Setup
+    SmallArray<int, 2> array = {5, 1, 4};
+    array.add(2).insert(3, 1).removeAll(4);
+    array.replaceAll(1, 6).sort().reverse();
+    std::vector<int> expect = {6, 5, 3, 2};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_EQ(2, array.pop());
+}
+
+TEST(SmallArray, retain_all) {
+    // Setup
+    SmallArray<int> array = {1, 2, 3, 4, 5};
+    array.retainAll({2, 4, 6});
+    std::vector<int> expect = {2, 4};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+TEST(SmallArray, subarray) {
+    // Setup
+    SmallArray<int> array = {1, 2, 3, 4, 5};
+    SmallArray<int> sub = array.subarray(1, 3);
+    std::vector<int> expect = {2, 3, 4};
+
+    // Assertion
+    EXPECT_EQ(expect, sub.std_vector());
+    EXPECT_EQ(expect, array.slice(1, 3).std_vector());
+}
+
+TEST(SmallArray, functional) {
+    // Setup
+    SmallArray<int> array = {1, 2, 3, 4};
+    SmallArray<int> doubled = array.map([](int n) { return n * 2; });
+    std::pair<SmallArray<int>, SmallArray<int>> parts = array.partition([](int n) { return n > 2; });
+    std::vector<int> expect1 = {2, 4, 6, 8};
+    std::vector<int> expect2 = {3, 4};
+
+    // Assertion
+    EXPECT_EQ(expect1, doubled.std_vector());
+    EXPECT_EQ(expect2, parts.first.std_vector());
+    EXPECT_EQ(10, array.reduce(0, [](int a, int b) { return a + b; }));
+}
+
+TEST(SmallArray, non_trivial_type) {
+    // Setup
+    SmallArray<std::string, 2> array = {"a", "b"};
+    array.add("c").insert("d", 0).remove("b");
+    SmallArray<std::string, 2> copy = array.copy();
+    std::vector<std::string> expect = {"d", "a", "c"};
+
+    // Assertion
+    EXPECT_EQ(expect, copy.std_vector());
+    EXPECT_EQ("[d, a, c]", array.description());
+}
+
+TEST(SmallArray, description) {
+    // Setup
+    SmallArray<int> array = {1, 2, 3};
+
+    // Assertion
+    EXPECT_EQ("[1, 2, 3]", array.description());
+    EXPECT_EQ("[]", SmallArray<int>().description());
+}
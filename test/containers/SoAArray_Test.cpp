@@ -0,0 +1,218 @@
+//
+// SoAArray_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "SoAArray.hpp"
+#include "gtest.h"
+
+using namespace mrlib;
+
+
+struct Record {
+    int     id;
+    long    timestamp;
+    double  value;
+};
+
+typedef SoAArray<int, long, double> RecordArray;
+
+// Field that throws when it is copied while FieldThrows is set
+static bool FieldThrows = false;
+
+struct ThrowingField {
+    ThrowingField() {}
+    ThrowingField(const ThrowingField&) {
+        if (FieldThrows) throw std::runtime_error("ThrowingField: Copy failed");
+    }
+};
+
+
+//////////////////
+// CONSTRUCTORS //
+//////////////////
+
+TEST(SoAArray, default_constructor) {
+    // Setup
+    RecordArray array = RecordArray();
+
+    // Assertion
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_EQ(0, array.size());
+}
+
+TEST(SoAArray, from_array) {
+    // Setup
+    Array<Record> records = Array<Record>();
+    records.add({1, 100, 1.5}).add({2, 200, 2.5});
+    RecordArray array = RecordArray::fromArray(records, &Record::id, &Record::timestamp, &Record::value);
+    std::vector<int> expect1 = {1, 2};
+    std::vector<long> expect2 = {100, 200};
+    std::vector<double> expect3 = {1.5, 2.5};
+
+    // Assertion
+    EXPECT_EQ(expect1, array.column<0>()._data);
+    EXPECT_EQ(expect2, array.column<1>()._data);
+    EXPECT_EQ(expect3, array.column<2>()._data);
+}
+
+
+////////////////////
+// Adding Objects //
+////////////////////
+
+TEST(SoAArray, add) {
+    // Setup
+    RecordArray array = RecordArray();
+    array.add(1, 100, 1.5).add(std::make_tuple(2, 200L, 2.5));
+
+    // Assertion
+    EXPECT_EQ(2, array.size());
+    EXPECT_TRUE(std::make_tuple(2, 200L, 2.5) == array[1]);
+    EXPECT_TRUE(std::make_tuple(1, 100L, 1.5) == array.objectAtIndex(0));
+    EXPECT_ANY_THROW(array.objectAtIndex(2));
+}
+
+TEST(SoAArray, remove) {
+    // Setup
+    RecordArray array = RecordArray();
+    array.add(1, 100, 1.5).add(2, 200, 2.5).add(3, 300, 3.5);
+    array.removeIndex(1);
+    std::vector<int> expect = {1, 3};
+
+    // Assertion
+    EXPECT_EQ(expect, array.column<0>()._data);
+    EXPECT_EQ(2, array.column<2>().size());
+    EXPECT_ANY_THROW(array.removeIndex(2));
+    EXPECT_TRUE(array.removeAll().isEmpty());
+}
+
+TEST(SoAArray, add_throws) {
+    // Setup
+    SoAArray<int, ThrowingField, int> array = SoAArray<int, ThrowingField, int>();
+    array.add(1, ThrowingField(), 2);
+    std::tuple<int, ThrowingField, int> record = std::make_tuple(3, ThrowingField(), 4);
+    FieldThrows = true;
+
+    // Assertion
+    EXPECT_ANY_THROW(array.add(record));
+    FieldThrows = false;
+    EXPECT_EQ(1, array.column<0>().size());
+    EXPECT_EQ(1, array.column<1>().size());
+    EXPECT_EQ(1, array.column<2>().size());
+}
+
+
+////////////////////
+// Column Access  //
+////////////////////
+
+TEST(SoAArray, column_slice) {
+    // Setup
+    RecordArray array = RecordArray();
+    array.add(1, 100, 1.5).add(2, 200, 2.5);
+    ArraySlice<long> timestamps = array.columnSlice<1>();
+
+    // Assertion
+    EXPECT_EQ(array.column<1>()._data.data(), timestamps._begin);
+    EXPECT_EQ("[100, 200]", timestamps.description());
+}
+
+TEST(SoAArray, column_modify) {
+    // Setup
+    RecordArray array = RecordArray();
+    array.add(1, 100, 1.5);
+    array.columnData<2>()[0] = 9.5;
+
+    // Assertion
+    EXPECT_EQ(9.5, std::get<2>(array[0]));
+}
+
+
+//////////////////
+// Column Scans //
+//////////////////
+
+TEST(SoAArray, sum) {
+    // Setup
+    RecordArray array = RecordArray();
+    for (int i = 1; i <= 10; ++i) {
+        array.add(i, i * 10, i * 0.5);
+    }
+
+    // Assertion
+    EXPECT_EQ(55, array.sum<0>());
+    EXPECT_EQ(550, array.sum<1>());
+    EXPECT_DOUBLE_EQ(27.5, array.sum<2>());
+    EXPECT_EQ(0, RecordArray().sum<0>());
+}
+
+TEST(SoAArray, count_and_indices) {
+    // Setup
+    RecordArray array = RecordArray();
+    for (int i = 0; i < 10; ++i) {
+        array.add(i, i * 10, i * 0.5);
+    }
+
+    Array<size_t> indices = array.indicesWhere<1>([](long t) { return t >= 70; });
+    std::vector<size_t> expect = {7, 8, 9};
+
+    // Assertion
+    EXPECT_EQ(5, array.count<2>([](double v) { return v < 2.5; }));
+    EXPECT_EQ(expect, indices._data);
+}
+
+
+///////////////////////////
+// Conversion and String //
+///////////////////////////
+
+TEST(SoAArray, to_array) {
+    // Setup
+    RecordArray array = RecordArray();
+    array.add(1, 100, 1.5).add(2, 200, 2.5);
+    Array<Record> records = array.toArray<Record>(&Record::id, &Record::timestamp, &Record::value);
+
+    // Assertion
+    ASSERT_EQ(2, records.size());
+    EXPECT_EQ(2, records[1].id);
+    EXPECT_EQ(200, records[1].timestamp);
+    EXPECT_EQ(2.5, records[1].value);
+}
+
+TEST(SoAArray, equality) {
+    // Setup
+    RecordArray array1 = RecordArray();
+    RecordArray array2 = RecordArray();
+    array1.add(1, 100, 1.5);
+    array2.add(1, 100, 1.5);
+
+    // Assertion
+    EXPECT_TRUE(array1 == array2);
+    array2.add(2, 200, 2.5);
+    EXPECT_TRUE(array1 != array2);
+}
+
+TEST(SoAArray, description) {
+    // Setup
+    RecordArray array = RecordArray();
+    array.add(1, 100, 1.5).add(2, 200, 2.5);
+
+    // Assertion
+    EXPECT_EQ("[(1, 100, 1.5), (2, 200, 2.5)]", array.description());
+    EXPECT_EQ("[]", RecordArray().description());
+}
+
+TEST(SoAArray, describe_to) {
+    // Setup
+    RecordArray array = RecordArray();
+    array.add(1, 100, 1.5);
+    DescriptionWriter writer;
+    writer.describe(RecordArray());
+
+    // Assertion
+    EXPECT_EQ("[(1, 100, 1.5)]", writer.describe(array));
+    EXPECT_EQ("[]", writer.describe(RecordArray()));
+}
@@ -0,0 +1,246 @@
+//
+// SortedArray_Test.cpp
+// mrlib
+//
+// Created by Matthew Remmel on 10/19/26.
+// Copyright (c) 2026 Matthew Remmel. All rights reserved.
+
+#include "SortedArray.hpp"
+#include "gtest.h"
+
+#include <string>
+
+using namespace mrlib;
+
+
+//////////////////
+// CONSTRUCTORS //
+//////////////////
+
+TEST(SortedArray, default_constructor) {
+    // Setup
+    SortedArray<int> array = SortedArray<int>();
+
+    // Assertion
+    EXPECT_TRUE(array.isEmpty());
+    EXPECT_EQ("[]", array.description());
+}
+
+TEST(SortedArray, initializer_list) {
+    // Setup
+    SortedArray<int> array = {5, 1, 4, 2, 3};
+    std::vector<int> expect = {1, 2, 3, 4, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+TEST(SortedArray, array_constructor) {
+    // Setup
+    Array<int> source = {3, 1, 2};
+    SortedArray<int, std::greater<int>> array = SortedArray<int, std::greater<int>>(source);
+    std::vector<int> expect = {3, 2, 1};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_EQ(3, array.firstObject());
+    EXPECT_EQ(1, array.lastObject());
+}
+
+
+////////////////////
+// Adding Objects //
+////////////////////
+
+TEST(SortedArray, add) {
+    // Setup
+    SortedArray<int> array = SortedArray<int>();
+    array.add(3).add(1).add(2).add(2);
+    std::vector<int> expect = {1, 2, 2, 3};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+TEST(SortedArray, add_all_array) {
+    // Setup
+    SortedArray<int> array = {1, 5, 9};
+    array.addAll(Array<int>({8, 2, 6}));
+    std::vector<int> expect = {1, 2, 5, 6, 8, 9};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+}
+
+TEST(SortedArray, add_all_sorted) {
+    // Setup
+    SortedArray<int> array1 = {1, 3, 5};
+    SortedArray<int> array2 = {2, 3, 4};
+    array1.addAll(array2);
+    array2.addAll(array2);
+    std::vector<int> expect1 = {1, 2, 3, 3, 4, 5};
+    std::vector<int> expect2 = {2, 2, 3, 3, 4, 4};
+
+    // Assertion
+    EXPECT_EQ(expect1, array1.std_vector());
+    EXPECT_EQ(expect2, array2.std_vector());
+}
+
+TEST(SortedArray, add_all_self) {
+    // Setup
+    SortedArray<std::string> array1 = SortedArray<std::string>();
+    for (int i = 0; i < 100; ++i) {
+        array1.add("key" + std::to_string(i));
+    }
+    SortedArray<std::string> array2 = array1;
+    array1._array._data.shrink_to_fit();
+    array1.addAll(array1);
+    array2.addAll(array2._array);
+
+    // Assertion
+    ASSERT_EQ(200, array1.size());
+    for (size_t i = 0; i < 200; i += 2) {
+        EXPECT_EQ(array1[i], array1[i + 1]);
+    }
+    EXPECT_EQ(array1.std_vector(), array2.std_vector());
+}
+
+
+//////////////////////
+// Removing Objects //
+//////////////////////
+
+TEST(SortedArray, remove) {
+    // Setup
+    SortedArray<int> array = {1, 2, 2, 3, 4};
+    array.remove(2).remove(7);
+    std::vector<int> expect = {1, 2, 3, 4};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_EQ(4, array.pop());
+    EXPECT_EQ(1, array.popFirst());
+}
+
+TEST(SortedArray, remove_all) {
+    // Setup
+    SortedArray<int> array = {2, 1, 2, 3, 2};
+    array.removeAll(2);
+    std::vector<int> expect = {1, 3};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_TRUE(array.removeAll().isEmpty());
+    EXPECT_ANY_THROW(array.pop());
+}
+
+TEST(SortedArray, remove_index) {
+    // Setup
+    SortedArray<int> array = {1, 2, 3, 4, 5};
+    array.removeIndex(0).removeRange(1, 3);
+    std::vector<int> expect = {2, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, array.std_vector());
+    EXPECT_ANY_THROW(array.removeIndex(2));
+    EXPECT_ANY_THROW(array.removeRange(2, 1));
+}
+
+
+/////////////////////
+// Finding Objects //
+/////////////////////
+
+TEST(SortedArray, index_of) {
+    // Setup
+    SortedArray<int> array = {1, 3, 3, 3, 5};
+
+    // Assertion
+    EXPECT_EQ(1, array.indexOf(3));
+    EXPECT_EQ(3, array.indexOfLast(3));
+    EXPECT_EQ(NO_INDEX, array.indexOf(4));
+    EXPECT_EQ(NO_INDEX, array.indexOfLast(0));
+    EXPECT_TRUE(array.contains(5));
+    EXPECT_FALSE(array.contains(6));
+}
+
+TEST(SortedArray, bounds) {
+    // Setup
+    SortedArray<int> array = {1, 3, 3, 3, 5};
+    std::pair<size_t, size_t> range = array.equalRange(3);
+
+    // Assertion
+    EXPECT_EQ(1, array.lowerBound(3));
+    EXPECT_EQ(4, array.upperBound(3));
+    EXPECT_EQ(1, range.first);
+    EXPECT_EQ(4, range.second);
+    EXPECT_EQ(3, array.count(3));
+    EXPECT_EQ(5, array.lowerBound(9));
+}
+
+TEST(SortedArray, custom_compare) {
+    // Setup
+    auto by_length = [](const std::string& a, const std::string& b) { return a.size() < b.size(); };
+    SortedArray<std::string, decltype(by_length)> array = SortedArray<std::string, decltype(by_length)>(by_length);
+    array.add("ccc").add("a").add("bb");
+
+    // Assertion
+    EXPECT_EQ("[a, bb, ccc]", array.description());
+    EXPECT_EQ(1, array.indexOf("xx"));
+}
+
+
+////////////////////
+// Set Operations //
+////////////////////
+
+TEST(SortedArray, union_with) {
+    // Setup
+    SortedArray<int> array1 = {1, 2, 4};
+    SortedArray<int> array2 = {2, 3, 5};
+    std::vector<int> expect = {1, 2, 3, 4, 5};
+
+    // Assertion
+    EXPECT_EQ(expect, array1.unionWith(array2).std_vector());
+}
+
+TEST(SortedArray, intersection_with) {
+    // Setup
+    SortedArray<int> array1 = {1, 2, 3, 4};
+    SortedArray<int> array2 = {2, 4, 6};
+    std::vector<int> expect = {2, 4};
+
+    // Assertion
+    EXPECT_EQ(expect, array1.intersectionWith(array2).std_vector());
+    EXPECT_TRUE(array1.containsAll(array1.intersectionWith(array2)));
+    EXPECT_FALSE(array1.containsAll(array2));
+}
+
+TEST(SortedArray, difference_with) {
+    // Setup
+    SortedArray<int> array1 = {1, 2, 3, 4};
+    SortedArray<int> array2 = {2, 4, 6};
+    std::vector<int> expect = {1, 3};
+
+    // Assertion
+    EXPECT_EQ(expect, array1.differenceWith(array2).std_vector());
+    EXPECT_TRUE(array1.differenceWith(array1).isEmpty());
+}
+
+
+////////////////
+// Containers //
+////////////////
+
+TEST(SortedArray, slice_and_array) {
+    // Setup
+    SortedArray<int> array = {4, 3, 2, 1};
+
+    // Assertion
+    EXPECT_EQ("[2, 3]", array.slice(1, 2).description());
+    EXPECT_EQ(4, array.array().size());
+    EXPECT_EQ(3, array[2]);
+    EXPECT_ANY_THROW(array[4]);
+    EXPECT_TRUE(array == SortedArray<int>({1, 2, 3, 4}));
+    EXPECT_TRUE(array != SortedArray<int>({1, 2, 3}));
+}
@@ -317,6 +317,23 @@ TEST(String, operator_inequality_self) {
     EXPECT_FALSE(string != string);
 }
 
+// Operator< > <= >=
+
+TEST(String, operator_ordering) {
+    // Setup
+    String string1 = String("apple");
+    String string2 = String("banana");
+    String string3 = String("apple");
+
+    // Assertion
+    EXPECT_TRUE(string1 < string2);
+    EXPECT_FALSE(string2 < string1);
+    EXPECT_TRUE(string2 > string1);
+    EXPECT_TRUE(string1 <= string3);
+    EXPECT_TRUE(string1 >= string3);
+    EXPECT_FALSE(string1 >= string2);
+}
+
 
 //////////////////////////////
 // User Defined Conversions //